@@ -12,10 +12,12 @@
  ********************************************************************************/
 
 #include "analyze.h"
+#include <atomic>
+#include <condition_variable>
 #include <iostream>
-#ifdef wxVERSION_NUMBER
-    #include <wx/file.h>
-#endif
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 namespace i18n_check
     {
@@ -23,94 +25,32 @@ namespace i18n_check
     bool valid_utf8_file(const std::filesystem::path& filePath, bool& startsWithBom)
         {
         startsWithBom = false;
-        std::ifstream ifs(filePath);
-        if (!ifs)
+        const mapped_file fileData(filePath);
+        if (!fileData.is_open())
             {
             return false;
             }
 
-        std::istreambuf_iterator<char> it(ifs.rdbuf());
-        std::istreambuf_iterator<char> eos;
-
-        if (utf8::starts_with_bom(it, eos))
+        std::string_view content{ fileData.get_data() };
+        if (has_utf8_bom(content))
             {
             startsWithBom = true;
-            std::advance(it, std::size(utf8::bom));
+            content.remove_prefix(3);
             }
 
-        return utf8::is_valid(it, eos);
+        return is_valid_utf8(content);
         }
 
     //------------------------------------------------------
-    std::pair<bool, std::wstring> read_utf16_file(const std::filesystem::path& filePath)
+    decoded_text read_text(std::string_view fileData, const text_encoding legacyEncoding)
         {
-        std::ifstream fs8(filePath);
-        if (!fs8.is_open())
-            {
-            std::wcout << L"Could not open " << filePath << L"\n";
-            return std::make_pair(false, std::wstring{});
-            }
-
-        std::string buffer;
-        buffer.reserve(static_cast<size_t>(std::filesystem::file_size(filePath)));
-
-        fs8.seekg(0, std::ios_base::end);
-        const auto fileLength = fs8.tellg();
-        fs8.seekg(0);
-        std::vector<char> fileData(static_cast<size_t>(fileLength));
-        fs8.read(&fileData[0], fileLength);
-
-        if (lily_of_the_valley::unicode_extract_text::is_unicode(&fileData[0]))
+        decoded_text fileText{ decode_text(fileData, legacyEncoding) };
+        // the analyzers expect the last line to be terminated
+        if (!fileText.m_text.empty() && fileText.m_text.back() != L'\n')
             {
-            lily_of_the_valley::unicode_extract_text uExtract;
-            uExtract(&fileData[0], fileData.size(),
-                     lily_of_the_valley::unicode_extract_text::is_little_endian(&fileData[0]));
-            return std::make_pair(true, std::wstring{ uExtract.get_filtered_text() });
+            fileText.m_text += L'\n';
             }
-        return std::make_pair(false, std::wstring{});
-        }
-
-    //------------------------------------------------------
-    std::pair<bool, std::wstring> read_utf8_file(const std::filesystem::path& filePath,
-                                                 bool& startsWithBom)
-        {
-        if (!valid_utf8_file(filePath, startsWithBom))
-            {
-            return std::make_pair(false, std::wstring{});
-            }
-
-        std::ifstream fs8(filePath);
-        if (!fs8.is_open())
-            {
-            std::wcout << L"Could not open " << filePath << L"\n";
-            return std::make_pair(false, std::wstring{});
-            }
-
-        unsigned line_count = 1;
-        std::string line;
-        std::wstring buffer;
-        buffer.reserve(static_cast<size_t>(std::filesystem::file_size(filePath)));
-
-        while (std::getline(fs8, line))
-            {
-            if (auto end_it = utf8::find_invalid(line.begin(), line.end()); end_it != line.cend())
-                {
-                std::cout << "Invalid UTF-8 encoding detected at line " << line_count << "\n";
-                std::cout << "This part is OK: " << std::string(line.begin(), end_it) << "\n";
-                }
-
-            // Convert it to utf-16
-            std::u16string utf16line = utf8::utf8to16(line);
-            for (const auto& ch : utf16line)
-                {
-                buffer += static_cast<wchar_t>(ch);
-                }
-            buffer += L"\n";
-
-            ++line_count;
-            }
-
-        return std::make_pair(true, buffer);
+        return fileText;
         }
 
     //------------------------------------------------------
@@ -125,13 +65,7 @@ namespace i18n_check
         const auto outputFile =
             [this](const std::filesystem::path filePath, const std::wstring& content)
         {
-            std::u32string outBuffer;
-            outBuffer.reserve(content.size());
-            for (const auto& chr : content)
-                {
-                outBuffer += static_cast<char32_t>(chr);
-                }
-            std::string utfBuffer{ utf8::utf32to8(outBuffer) };
+            const std::string utfBuffer{ encode_utf8(content) };
 
             std::ofstream out(filePath);
             if (out.is_open())
@@ -168,37 +102,23 @@ namespace i18n_check
                 outPath.replace_extension(L".po");
                 }
 
+            const mapped_file fileData(file);
+            if (!fileData.is_open())
+                {
+                m_logReport.append(L"Could not open ").append(file.wstring()).append(L"\n");
+                std::wcout << L"Could not open " << file << L"\n";
+                continue;
+                }
+
             try
                 {
-                bool startsWithBom{ false };
-                if (auto [readUtf8Ok, fileUtf8Text] = read_utf8_file(file, startsWithBom);
-                    readUtf8Ok)
-                    {
-                    if (fileType == file_review_type::po)
-                        {
-                        trans.translate_po_file(fileUtf8Text);
-                        outputFile(outPath, fileUtf8Text);
-                        }
-                    }
-                else if (auto [readUtf16Ok, fileUtf16Text] = read_utf16_file(file); readUtf16Ok)
-                    {
-                    // UTF-16 may not be supported consistently on all platforms and compilers
-                    if (fileType == file_review_type::po)
-                        {
-                        trans.translate_po_file(fileUtf16Text);
-                        outputFile(outPath, fileUtf16Text);
-                        }
-                    }
-                else
+                if (fileType == file_review_type::po)
                     {
-                    std::wifstream ifs(file);
-                    std::wstring str((std::istreambuf_iterator<wchar_t>(ifs)),
-                                     std::istreambuf_iterator<wchar_t>());
-                    if (fileType == file_review_type::po)
-                        {
-                        trans.translate_po_file(str);
-                        outputFile(outPath, str);
-                        }
+                    std::wstring fileText{
+                        read_text(fileData.get_data(), m_legacyEncoding).m_text
+                    };
+                    trans.translate_po_file(fileText);
+                    outputFile(outPath, fileText);
                     }
                 }
             catch (const std::exception& expt)
@@ -211,153 +131,433 @@ namespace i18n_check
         }
 
     //------------------------------------------------------
-    void batch_analyze::analyze(const std::vector<std::filesystem::path>& filesToAnalyze,
-                                analyze_callback_reset resetCallback, analyze_callback callback)
+    std::unique_ptr<i18n_review> batch_analyze::review_file_text(const i18n_review& analyzer,
+                                                                 decoded_text& fileText,
+                                                                 const std::filesystem::path& file,
+                                                                 std::string& results)
         {
-        m_filesThatShouldBeConvertedToUTF8.clear();
-        m_filesThatContainUTF8Signature.clear();
-        m_cpp->clear_results();
-        m_rc->clear_results();
-        m_plist->clear_results();
-        m_po->clear_results();
-        m_csharp->clear_results();
+        auto fileAnalyzer = analyzer.clone();
+            {
+            I18N_PROFILE_SCOPE(analyzer.get_profile(), profile_phase::scan, 1);
+            // the decoded text isn't needed after the review, so the analyzer can parse it
+            // directly rather than making its own copy of it
+            fileAnalyzer->review_buffer(fileText.m_text, file);
+            }
 
-        size_t currentFileIndex{ 0 };
+        std::ostringstream resultsStream;
+        write_cache_value(resultsStream, static_cast<uint64_t>(fileText.m_encoding));
+        write_cache_value(resultsStream, fileText.m_has_utf8_bom ? 1 : 0);
+        fileAnalyzer->write_results(resultsStream, file);
+        results = std::move(resultsStream).str();
 
-        resetCallback(filesToAnalyze.size());
-        // load file content into analyzers
-        for (const auto& file : filesToAnalyze)
-            {
-            if (!callback(++currentFileIndex, file))
+        return fileAnalyzer;
+        }
+
+    //------------------------------------------------------
+    batch_analyze::file_load_info
+    batch_analyze::load_file(const std::filesystem::path& file, i18n_review& cpp, i18n_review& rc,
+                             i18n_review& po, i18n_review& csharp, i18n_review& plist,
+                             const text_encoding legacyEncoding, const results_cache* cache,
+                             const std::string* residentResults, const bool keepResults)
+        {
+        file_load_info loadInfo;
+
+        const file_review_type fileType = get_file_type(file);
+        i18n_review& analyzer = (fileType == file_review_type::rc)        ? rc :
+                                (fileType == file_review_type::infoplist) ? plist :
+                                (fileType == file_review_type::po)        ? po :
+                                (fileType == file_review_type::cs)        ? csharp :
+                                                                            cpp;
+
+        const auto logEncoding = [&](const text_encoding encoding, const bool hasUtf8Bom)
+        {
+            if (hasUtf8Bom && cpp.get_style() & check_utf8_with_signature)
                 {
-                return;
+                loadInfo.m_containsUTF8Signature = true;
+                }
+            // RC files are usually encoded in ANSI given their age,
+            // so don't check those files.
+            if (encoding != text_encoding::utf8 && fileType != file_review_type::rc &&
+                cpp.get_style() & check_utf8_encoded)
+                {
+                loadInfo.m_shouldBeConvertedToUTF8 = true;
                 }
+            loadInfo.m_encoding = encoding;
+        };
 
-            const file_review_type fileType = get_file_type(file);
+        // reads results written by the code below, which start with the file's encoding info
+        const auto readResults = [&](std::string results)
+        {
+            std::istringstream resultsStream(std::move(results));
+            const auto encoding{ static_cast<text_encoding>(read_cache_value(resultsStream)) };
+            const bool hasUtf8Bom{ read_cache_value(resultsStream) != 0 };
+            analyzer.read_results(resultsStream, file);
+            logEncoding(encoding, hasUtf8Bom);
+        };
 
-            try
+        try
+            {
+            if (residentResults != nullptr)
                 {
-                bool startsWithBom{ false };
-                if (const auto [readUtf8Ok, fileUtf8Text] = read_utf8_file(file, startsWithBom);
-                    readUtf8Ok)
+                readResults(*residentResults);
+                loadInfo.m_loadedFromMemory = true;
+                return loadInfo;
+                }
+
+            decoded_text fileText;
+            uint64_t contentHash{ 0 };
+                {
+                I18N_PROFILE_SCOPE(analyzer.get_profile(), profile_phase::read_decode, 1);
+                // the file is only read once, and its encoding is detected from that content;
+                // it is then unmapped so that only the decoded text is held during the review
+                const mapped_file fileData(file);
+                if (!fileData.is_open())
                     {
-                    if (startsWithBom && m_cpp->get_style() & check_utf8_with_signature)
-                        {
-                        m_filesThatContainUTF8Signature.push_back(file);
-                        }
-                    if (fileType == file_review_type::rc)
-                        {
-                        (*m_rc)(fileUtf8Text, file);
-                        }
-                    else if (fileType == file_review_type::infoplist)
-                        {
-                        (*m_plist)(fileUtf8Text, file);
-                        }
-                    else if (fileType == file_review_type::po)
-                        {
-                        (*m_po)(fileUtf8Text, file);
-                        }
-                    else if (fileType == file_review_type::cs)
-                        {
-                        (*m_csharp)(fileUtf8Text, file);
-                        }
-                    else
-                        {
-                        (*m_cpp)(fileUtf8Text, file);
-                        }
+                    loadInfo.m_errorMessage = L"Could not open " + file.wstring();
+                    return loadInfo;
                     }
-                else if (const auto [readUtf16Ok, fileUtf16Text] = read_utf16_file(file);
-                         readUtf16Ok)
+                if (cache != nullptr)
                     {
-                    // UTF-16 or ANSI may not be supported consistently on
-                    // all platforms and compilers.
-                    // RC files are usually encoded in ANSI given their age,
-                    // so don't check those files.
-                    if (fileType != file_review_type::rc && m_cpp->get_style() & check_utf8_encoded)
-                        {
-                        m_filesThatShouldBeConvertedToUTF8.push_back(file);
-                        }
-                    if (fileType == file_review_type::rc)
-                        {
-                        (*m_rc)(fileUtf16Text, file);
-                        }
-                    else if (fileType == file_review_type::infoplist)
-                        {
-                        (*m_plist)(fileUtf16Text, file);
-                        }
-                    else if (fileType == file_review_type::po)
-                        {
-                        (*m_po)(fileUtf16Text, file);
-                        }
-                    else if (fileType == file_review_type::cs)
-                        {
-                        (*m_csharp)(fileUtf16Text, file);
-                        }
-                    else
+                    // line-level checks depend on which of the file's lines were changed
+                    contentHash = analyzer.combine_changed_lines_hash(
+                        results_cache::hash_content(fileData.get_data()), file);
+                    if (auto cachedResults = cache->load(fileType, contentHash))
                         {
-                        (*m_cpp)(fileUtf16Text, file);
+                        if (keepResults)
+                            {
+                            loadInfo.m_results = cachedResults;
+                            }
+                        readResults(std::move(cachedResults.value()));
+                        loadInfo.m_loadedFromCache = true;
+                        return loadInfo;
                         }
                     }
-                else
+                fileText = read_text(fileData.get_data(), legacyEncoding);
+                }
+            logEncoding(fileText.m_encoding, fileText.m_has_utf8_bom);
+
+            if (cache != nullptr || keepResults)
+                {
+                // analyze the file by itself, so that only its results are cached
+                std::string results;
+                const auto fileAnalyzer = review_file_text(analyzer, fileText, file, results);
+                if (cache != nullptr)
                     {
-                    if (fileType != file_review_type::rc && m_cpp->get_style() & check_utf8_encoded)
-                        {
-                        m_filesThatShouldBeConvertedToUTF8.push_back(file);
-                        }
-#ifdef wxVERSION_NUMBER
-                    const std::wstring str = [&file]()
+                    cache->store(fileType, contentHash, results);
+                    }
+                if (keepResults)
                     {
-                        wxFile ifs(file.wstring());
-                        wxString fileContents;
-                        if (ifs.IsOpened())
+                    loadInfo.m_results = std::move(results);
+                    }
+
+                analyzer.merge_results({ fileAnalyzer.get() },
+                                       []([[maybe_unused]] const std::filesystem::path&)
+                                       { return static_cast<size_t>(0); });
+                }
+            else
+                {
+                I18N_PROFILE_SCOPE(analyzer.get_profile(), profile_phase::scan, 1);
+                analyzer.review_buffer(fileText.m_text, file);
+                }
+            }
+        catch (const std::exception& expt)
+            {
+            loadInfo.m_errorMessage = i18n_string_util::lazy_string_to_wstring(expt.what());
+            }
+
+        return loadInfo;
+        }
+
+    //------------------------------------------------------
+    uint64_t batch_analyze::get_settings_hash() const
+        {
+        uint64_t settingsHash{ results_cache::HASH_SEED };
+        for (const i18n_review* analyzer :
+             std::initializer_list<const i18n_review*>{ m_cpp, m_rc, m_po, m_csharp, m_plist })
+            {
+            const uint64_t analyzerHash{ analyzer->get_settings_hash() };
+            settingsHash = combine_cache_hash(
+                settingsHash, std::string_view{ reinterpret_cast<const char*>(&analyzerHash),
+                                                sizeof(analyzerHash) });
+            }
+        // the legacy encoding changes how files are read
+        return combine_cache_hash(settingsHash, encode_utf8(get_encoding_name(m_legacyEncoding)));
+        }
+
+    //------------------------------------------------------
+    const std::string*
+    batch_analyze::find_resident_results(const std::filesystem::path& file) const
+        {
+        if (!m_keepResultsResident)
+            {
+            return nullptr;
+            }
+        const auto residentFile = m_residentResults.find(file.native());
+        return (residentFile != m_residentResults.cend()) ? &residentFile->second : nullptr;
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::invalidate_files(const std::vector<std::filesystem::path>& files)
+        {
+        for (const auto& file : files)
+            {
+            if (m_residentResults.erase(file.native()) == 0)
+                {
+                // a folder that was removed, so remove all of the files that were in it
+                const std::filesystem::path::string_type folderPrefix{
+                    (file / std::filesystem::path{}).native()
+                };
+                std::erase_if(m_residentResults, [&folderPrefix](const auto& residentFile)
+                              { return residentFile.first.starts_with(folderPrefix); });
+                }
+            }
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::log_file_load_info(const std::filesystem::path& file,
+                                           file_load_info& loadInfo)
+        {
+        if (loadInfo.m_loadedFromCache)
+            {
+            ++m_cachedFileCount;
+            }
+        if (loadInfo.m_loadedFromMemory)
+            {
+            ++m_residentFileCount;
+            }
+        if (loadInfo.m_results)
+            {
+            m_residentResults.insert_or_assign(file.native(),
+                                               std::move(loadInfo.m_results.value()));
+            }
+        if (loadInfo.m_containsUTF8Signature)
+            {
+            m_filesThatContainUTF8Signature.push_back(file);
+            }
+        if (loadInfo.m_shouldBeConvertedToUTF8)
+            {
+            m_filesThatShouldBeConvertedToUTF8.emplace_back(file, loadInfo.m_encoding);
+            }
+        if (!loadInfo.m_errorMessage.empty())
+            {
+            m_logReport.append(loadInfo.m_errorMessage).append(L"\n");
+            std::wcout << loadInfo.m_errorMessage << L"\n";
+            }
+        }
+
+    //------------------------------------------------------
+    bool
+    batch_analyze::analyze_in_parallel(const std::vector<std::filesystem::path>& filesToAnalyze,
+                                       const size_t jobCount, const results_cache* cache,
+                                       analyze_callback callback)
+        {
+        // each thread loads its files into its own copies of the analyzers,
+        // which are merged back into the main analyzers afterwards
+        struct worker_analyzers
+            {
+            std::unique_ptr<i18n_review> m_cpp;
+            std::unique_ptr<i18n_review> m_rc;
+            std::unique_ptr<i18n_review> m_po;
+            std::unique_ptr<i18n_review> m_csharp;
+            std::unique_ptr<i18n_review> m_plist;
+            };
+
+        std::vector<worker_analyzers> workers;
+        workers.reserve(jobCount);
+        for (size_t i = 0; i < jobCount; ++i)
+            {
+            workers.push_back(worker_analyzers{ m_cpp->clone(), m_rc->clone(), m_po->clone(),
+                                                m_csharp->clone(), m_plist->clone() });
+            }
+
+        std::vector<file_load_info> loadInfos(filesToAnalyze.size());
+        std::atomic<size_t> nextFile{ 0 };
+        std::atomic<bool> cancelled{ false };
+
+        std::mutex progressMutex;
+        std::condition_variable progressChanged;
+        size_t filesCompleted{ 0 };
+        std::filesystem::path lastFileCompleted;
+
+            {
+            std::vector<std::jthread> threads;
+            threads.reserve(workers.size());
+            for (auto& worker : workers)
+                {
+                threads.emplace_back(
+                    [&, &currentWorker = worker]()
+                    {
+                        // files are handed out one at a time, so that threads which finish
+                        // their files early will take on more of the remaining ones
+                        for (size_t i = nextFile++; i < filesToAnalyze.size() && !cancelled;
+                             i = nextFile++)
                             {
-                            if (ifs.ReadAll(&fileContents))
+                            loadInfos[i] = load_file(
+                                filesToAnalyze[i], *currentWorker.m_cpp, *currentWorker.m_rc,
+                                *currentWorker.m_po, *currentWorker.m_csharp,
+                                *currentWorker.m_plist, m_legacyEncoding, cache,
+                                find_resident_results(filesToAnalyze[i]), m_keepResultsResident);
                                 {
-                                return std::wstring{ fileContents.wc_str() };
+                                std::lock_guard<std::mutex> lock(progressMutex);
+                                ++filesCompleted;
+                                lastFileCompleted = filesToAnalyze[i];
                                 }
+                            progressChanged.notify_one();
                             }
-                        return std::wstring{};
-                    }();
-#else
-                    std::wifstream ifs(file);
-                    const std::wstring str((std::istreambuf_iterator<wchar_t>(ifs)),
-                                           std::istreambuf_iterator<wchar_t>());
-#endif
-                    if (fileType == file_review_type::rc)
-                        {
-                        (*m_rc)(str, file);
-                        }
-                    else if (fileType == file_review_type::infoplist)
-                        {
-                        (*m_plist)(str, file);
-                        }
-                    else if (fileType == file_review_type::po)
-                        {
-                        (*m_po)(str, file);
-                        }
-                    else if (fileType == file_review_type::cs)
-                        {
-                        (*m_csharp)(str, file);
-                        }
-                    else
-                        {
-                        (*m_cpp)(str, file);
-                        }
+                    });
+                }
+
+            // progress is reported from the calling thread, as the callback may be updating a UI
+            size_t filesReported{ 0 };
+            while (filesReported < filesToAnalyze.size())
+                {
+                std::filesystem::path currentFile;
+                    {
+                    std::unique_lock<std::mutex> lock(progressMutex);
+                    progressChanged.wait(lock, [&]() { return filesCompleted > filesReported; });
+                    filesReported = filesCompleted;
+                    currentFile = lastFileCompleted;
+                    }
+                if (!callback(filesReported, currentFile))
+                    {
+                    cancelled = true;
+                    break;
                     }
                 }
-            catch (const std::exception& expt)
+            } // threads are joined here
+
+        // merge the results, in the same order as if the files were analyzed sequentially
+        std::unordered_map<std::filesystem::path::string_type, size_t> fileIndices;
+        fileIndices.reserve(filesToAnalyze.size());
+        for (size_t i = 0; i < filesToAnalyze.size(); ++i)
+            {
+            fileIndices.try_emplace(filesToAnalyze[i].native(), i);
+            }
+        const file_index_callback fileIndex =
+            [&fileIndices, fileCount = filesToAnalyze.size()](const std::filesystem::path& file)
+        {
+            const auto foundPos = fileIndices.find(file.native());
+            return (foundPos != fileIndices.cend()) ? foundPos->second : fileCount;
+        };
+
+        const auto mergeResults =
+            [&workers, &fileIndex](i18n_review& analyzer,
+                                   std::unique_ptr<i18n_review> worker_analyzers::*workerAnalyzer)
+        {
+            std::vector<i18n_review*> analyzers;
+            analyzers.reserve(workers.size());
+            for (auto& worker : workers)
                 {
-                m_logReport.append(i18n_string_util::lazy_string_to_wstring(expt.what()))
-                    .append(L"\n");
-                std::wcout << i18n_string_util::lazy_string_to_wstring(expt.what()) << L"\n";
+                analyzers.push_back((worker.*workerAnalyzer).get());
+                }
+            analyzer.merge_results(analyzers, fileIndex);
+        };
+        mergeResults(*m_cpp, &worker_analyzers::m_cpp);
+        mergeResults(*m_rc, &worker_analyzers::m_rc);
+        mergeResults(*m_po, &worker_analyzers::m_po);
+        mergeResults(*m_csharp, &worker_analyzers::m_csharp);
+        mergeResults(*m_plist, &worker_analyzers::m_plist);
+
+        for (size_t i = 0; i < filesToAnalyze.size(); ++i)
+            {
+            log_file_load_info(filesToAnalyze[i], loadInfos[i]);
+            }
+
+        return !cancelled;
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::analyze(const std::vector<std::filesystem::path>& filesToAnalyze,
+                                analyze_callback_reset resetCallback, analyze_callback callback)
+        {
+        m_filesThatShouldBeConvertedToUTF8.clear();
+        m_filesThatContainUTF8Signature.clear();
+        m_cpp->clear_results();
+        m_rc->clear_results();
+        m_plist->clear_results();
+        m_po->clear_results();
+        m_csharp->clear_results();
+        m_cpp->set_changed_lines(m_changedLines);
+        m_rc->set_changed_lines(m_changedLines);
+        m_plist->set_changed_lines(m_changedLines);
+        m_po->set_changed_lines(m_changedLines);
+        m_csharp->set_changed_lines(m_changedLines);
+        // the worker analyzers are cloned from these, so they will share the profile also
+        m_profile.clear();
+        check_profile* const profile{ m_profiling ? &m_profile : nullptr };
+        m_cpp->set_profile(profile);
+        m_rc->set_profile(profile);
+        m_plist->set_profile(profile);
+        m_po->set_profile(profile);
+        m_csharp->set_profile(profile);
+        // Verdicts about strings are only valid for the settings that they were made with,
+        // so each analyzer gets a new cache for every run (which its clones will share).
+        m_cpp->set_classification_cache(std::make_shared<classification_cache>());
+        m_rc->set_classification_cache(std::make_shared<classification_cache>());
+        m_plist->set_classification_cache(std::make_shared<classification_cache>());
+        m_po->set_classification_cache(std::make_shared<classification_cache>());
+        m_csharp->set_classification_cache(std::make_shared<classification_cache>());
+
+        const size_t jobCount{ std::min<size_t>(
+            filesToAnalyze.size(),
+            (m_jobs == 0) ? std::max<size_t>(std::thread::hardware_concurrency(), 1) : m_jobs) };
+
+        m_cachedFileCount = 0;
+        m_residentFileCount = 0;
+        const uint64_t settingsHash{ (m_cacheFolder.empty() && !m_keepResultsResident) ?
+                                         0 :
+                                         get_settings_hash() };
+        const std::unique_ptr<const results_cache> cache{
+            m_cacheFolder.empty() ? nullptr :
+                                    std::make_unique<results_cache>(m_cacheFolder, settingsHash)
+        };
+        // results from different settings can't be reused
+        if (settingsHash != m_residentSettingsHash)
+            {
+            m_residentResults.clear();
+            m_residentSettingsHash = settingsHash;
+            }
+
+        resetCallback(filesToAnalyze.size());
+        // load file content into analyzers
+        if (jobCount > 1)
+            {
+            if (!analyze_in_parallel(filesToAnalyze, jobCount, cache.get(), callback))
+                {
+                return;
+                }
+            }
+        else
+            {
+            size_t currentFileIndex{ 0 };
+            for (const auto& file : filesToAnalyze)
+                {
+                if (!callback(++currentFileIndex, file))
+                    {
+                    return;
+                    }
+
+                auto loadInfo{ load_file(file, *m_cpp, *m_rc, *m_po, *m_csharp, *m_plist,
+                                         m_legacyEncoding, cache.get(),
+                                         find_resident_results(file), m_keepResultsResident) };
+                log_file_load_info(file, loadInfo);
                 }
             }
 
         // analyze the content
         try
             {
+            I18N_PROFILE_SCOPE(profile, profile_phase::review,
+                               m_cpp->get_localizable_strings().size() +
+                                   m_po->get_catalog_entries().size());
             m_cpp->review_strings(resetCallback, callback);
             m_po->review_strings(resetCallback, callback);
+            // if reviewing a patch, only report what is on the changed lines
+            m_cpp->remove_results_outside_changed_lines();
+            m_rc->remove_results_outside_changed_lines();
+            m_plist->remove_results_outside_changed_lines();
+            m_po->remove_results_outside_changed_lines();
+            m_csharp->remove_results_outside_changed_lines();
             }
         catch (const std::exception& expt)
             {
@@ -369,6 +569,7 @@ namespace i18n_check
     //------------------------------------------------------
     std::wstringstream batch_analyze::format_summary(const bool verbose)
         {
+        I18N_PROFILE_SCOPE(m_profiling ? &m_profile : nullptr, profile_phase::format, 1);
         std::wstringstream report;
         if (verbose)
             {
@@ -429,6 +630,14 @@ namespace i18n_check
                << m_rc->get_localizable_strings().size() << L"\n"
                << _(L"Translation entries within PO message catalog files: ")
                << m_po->get_catalog_entries().size() << L"\n";
+        if (!m_cacheFolder.empty())
+            {
+            report << _(L"Files loaded from the cache: ") << m_cachedFileCount << L"\n";
+            }
+        if (m_keepResultsResident)
+            {
+            report << _(L"Files reused from memory: ") << m_residentFileCount << L"\n";
+            }
 
         return report;
         }
@@ -436,585 +645,673 @@ namespace i18n_check
     //------------------------------------------------------
     std::wstringstream batch_analyze::format_results(const bool verbose /*= false*/)
         {
-        const auto replaceSpecialSpaces = [](const std::wstring& str)
+        std::wstringstream report;
+        format_results(report, verbose);
+        return report;
+        }
+
+    //------------------------------------------------------
+    /// @returns A string with its tabs and newlines replaced with spaces,
+    ///     so that it fits in a column of the report.
+    static std::wstring replace_special_spaces(std::wstring str)
         {
-            auto newStr{ str };
-            string_util::replace_all(newStr, L'\t', L' ');
-            string_util::replace_all(newStr, L'\n', L' ');
-            string_util::replace_all(newStr, L'\r', L' ');
-            return newStr;
-        };
+        string_util::replace_all(str, L'\t', L' ');
+        string_util::replace_all(str, L'\n', L' ');
+        string_util::replace_all(str, L'\r', L' ');
+        return str;
+        }
 
-        std::wstringstream report;
-        report << // TRANSLATORS: Column header in output
-                  _("File") << L"\t" <<
-                  // TRANSLATORS: Column header in output
-                  _(L"Line") << L"\t" <<
-                  // TRANSLATORS: Column header in output
-                  _(L"Column") << L"\t" <<
-                  // TRANSLATORS: Column header in output
-                  _(L"Value") << L"\t" <<
-                  // TRANSLATORS: Column header in output
-                  _(L"Explanation") << L"\t" <<
-                  // TRANSLATORS: Column header in output
-                  _(L"Warning ID") << L"\n";
+    //------------------------------------------------------
+    /// @returns An issue for a string from one of the analyzers' results.
+    static analysis_issue make_string_issue(const i18n_review::string_info& val,
+                                            const bool includeColumn, std::wstring explanation,
+                                            const std::wstring_view warningId)
+        {
+        return analysis_issue{ val.m_file_name.get(),
+                               val.m_line,
+                               includeColumn ? std::optional<size_t>{ val.m_column } :
+                                               std::nullopt,
+                               replace_special_spaces(val.m_string),
+                               true,
+                               std::move(explanation),
+                               warningId };
+        }
 
-        // Windows resource file warnings
-        for (const auto& val : m_rc->get_unsafe_localizable_strings())
+    //------------------------------------------------------
+    static void for_each_rc_issue(const rc_file_review& rc, const issue_callback& callback)
+        {
+        for (const auto& val : rc.get_unsafe_localizable_strings())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                   << _(L"String available for translation that probably should not be.")
-                   << L"\"\t[suspectL10NString]\n";
+            callback(make_string_issue(
+                val, false,
+                _WXTRANS_WSTR(L"String available for translation that probably should not be."),
+                L"suspectL10NString"));
             }
 
-        for (const auto& val : m_rc->get_localizable_strings_with_urls())
+        for (const auto& val : rc.get_localizable_strings_with_urls())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                   << _(L"String available for translation that contains an URL or email address.")
-                   << L"\"\t[urlInL10NString]\n";
+            callback(make_string_issue(val, false,
+                                       _WXTRANS_WSTR(L"String available for translation that "
+                                                     "contains an URL or email address."),
+                                       L"urlInL10NString"));
             }
 
-        for (const auto& val : m_rc->get_localizable_strings_with_unlocalizable_content())
+        for (const auto& val : rc.get_localizable_strings_with_unlocalizable_content())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                   << _(L"String available for translation that contains a "
-                        "large amount of non-translatable content")
-                   << L"\"\t[excessiveNonL10NContent]\n";
+            callback(make_string_issue(val, false,
+                                       _WXTRANS_WSTR(L"String available for translation that "
+                                                     "contains a large amount of "
+                                                     "non-translatable content"),
+                                       L"excessiveNonL10NContent"));
             }
 
-        for (const auto& val : m_rc->get_localizable_strings_being_concatenated())
+        for (const auto& val : rc.get_localizable_strings_being_concatenated())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                   << _(L"String available for translation that may be getting concatenated "
-                        "at runtime with other content.")
-                   << L"\"\t[concatenatedStrings]\n";
+            callback(make_string_issue(
+                val, false,
+                _WXTRANS_WSTR(L"String available for translation that may be getting "
+                              "concatenated at runtime with other content."),
+                L"concatenatedStrings"));
             }
 
-        for (const auto& val : m_rc->get_multipart_strings())
+        for (const auto& val : rc.get_multipart_strings())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                   << _(L"String available for translation may contain multiple sections "
-                        "being sliced at runtime. Consider splitting each section into "
-                        "a separate resource.")
-                   << L"\"\t[multipartString]\n";
+            callback(make_string_issue(
+                val, false,
+                _WXTRANS_WSTR(L"String available for translation may contain multiple sections "
+                              "being sliced at runtime. Consider splitting each section into "
+                              "a separate resource."),
+                L"multipartString"));
             }
 
-        for (const auto& val : m_rc->get_faux_plural_strings())
+        for (const auto& val : rc.get_faux_plural_strings())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                   << _(L"The same string is used for singular and plural situations. "
-                        "Consider using a pluralizing function (if available) or "
-                        "reword the message.")
-                   << L"\"\t[pluralization]\n";
+            callback(make_string_issue(
+                val, false,
+                _WXTRANS_WSTR(L"The same string is used for singular and plural situations. "
+                              "Consider using a pluralizing function (if available) or "
+                              "reword the message."),
+                L"pluralization"));
             }
 
-        for (const auto& val : m_rc->get_article_issue_strings())
+        for (const auto& val : rc.get_article_issue_strings())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                   << _(L"An article is proceeding dynamic content, or a pronoun is being "
-                         "formatted into a larger message. It is recommended to create "
-                         "multiple versions of this string for all possible contexts instead "
-                         "of using dynamic placeholders.")
-                   << L"\"\t[articleOrPronoun]\n";
+            callback(make_string_issue(
+                val, false,
+                _WXTRANS_WSTR(L"An article is proceeding dynamic content, or a pronoun is being "
+                              "formatted into a larger message. It is recommended to create "
+                              "multiple versions of this string for all possible contexts "
+                              "instead of using dynamic placeholders."),
+                L"articleOrPronoun"));
             }
 
-        for (const auto& val : m_rc->get_localizable_strings_with_halfwidths())
+        for (const auto& val : rc.get_localizable_strings_with_halfwidths())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                   << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-            report << _(L"String available for translation that contains halfwidth characters. "
-                        "Fullwidth characters are recommended.");
-            report << L"\"\t[halfWidth]\n";
+            callback(make_string_issue(
+                val, true,
+                _WXTRANS_WSTR(L"String available for translation that contains halfwidth "
+                              "characters. Fullwidth characters are recommended."),
+                L"halfWidth"));
             }
 
-        for (const auto& val : m_rc->get_bad_dialog_font_sizes())
+        // the usage provides more detailed info about these issues
+        for (const auto& val : rc.get_bad_dialog_font_sizes())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string)
-                   << L"\"\t\""
-                   // this provides more detailed info about the issue
-                   << replaceSpecialSpaces(val.m_usage.m_value) << L"\"\t[fontIssue]\n";
+            callback(make_string_issue(val, false,
+                                       replace_special_spaces(val.m_usage.m_value.get()),
+                                       L"fontIssue"));
             }
 
-        for (const auto& val : m_rc->get_non_system_dialog_fonts())
+        for (const auto& val : rc.get_non_system_dialog_fonts())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                   << replaceSpecialSpaces(val.m_usage.m_value) << L"\"\t[fontIssue]\n";
+            callback(make_string_issue(val, false,
+                                       replace_special_spaces(val.m_usage.m_value.get()),
+                                       L"fontIssue"));
             }
+        }
 
-        // macOS manifest files
-        for (const auto& val : m_plist->get_missing_localization_bundles())
+    //------------------------------------------------------
+    static void for_each_info_plist_issue(const info_plist_file_review& plist,
+                                          const issue_callback& callback)
+        {
+        for (const auto& val : plist.get_missing_localization_bundles())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                   << _(L"No languages included in macOS Info.plist file. "
-                        "This file should have a CFBundleLocalizations section with "
-                        "an array of strings under it; otherwise, no translations will be loaded "
-                        "at runtime.")
-                   << L"\"\t[suspectI18NUsage]\n";
+            callback(make_string_issue(
+                val, false,
+                _WXTRANS_WSTR(L"No languages included in macOS Info.plist file. "
+                              "This file should have a CFBundleLocalizations section with "
+                              "an array of strings under it; otherwise, no translations will be "
+                              "loaded at runtime."),
+                L"suspectI18NUsage"));
             }
+        }
 
-        // gettext catalogs
-        for (const auto& catEntry : m_po->get_catalog_entries())
+    //------------------------------------------------------
+    static void for_each_catalog_issue(const po_file_review& po, const issue_callback& callback)
+        {
+        for (const auto& catEntry : po.get_catalog_entries())
             {
             for (const auto& issue : catEntry.second.m_issues)
                 {
+                const auto addIssue = [&callback, &catEntry, &issue](
+                                          std::wstring explanation, const std::wstring_view warningId)
+                {
+                    callback(analysis_issue{ catEntry.first, catEntry.second.m_line, std::nullopt,
+                                             issue.second, true, std::move(explanation),
+                                             warningId });
+                };
+
                 if (issue.first == translation_issue::printf_issue)
                     {
-                    report
-                        << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                        << issue.second << L"\"\t\""
-                        << _(L"Mismatching printf command between source and translation strings.")
-                        << "\"\t[printfMismatch]\n";
+                    addIssue(_WXTRANS_WSTR(L"Mismatching printf command between source and "
+                                           "translation strings."),
+                             L"printfMismatch");
                     }
                 else if (issue.first == translation_issue::suspect_source_issue)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"String available for translation that probably should not be, or "
-                                "contains a hard-coded URL or email address.")
-                           << "\"\t[suspectL10NString]\n";
+                    addIssue(_WXTRANS_WSTR(L"String available for translation that probably "
+                                           "should not be, or contains a hard-coded URL or "
+                                           "email address."),
+                             L"suspectL10NString");
                     }
                 else if (issue.first == translation_issue::excessive_nonl10n_content)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"String available for translation that contains a "
-                                "large amount of non-translatable content.")
-                           << "\"\t[excessiveNonL10NContent]\n";
+                    addIssue(_WXTRANS_WSTR(L"String available for translation that contains a "
+                                           "large amount of non-translatable content."),
+                             L"excessiveNonL10NContent");
                     }
                 else if (issue.first == translation_issue::malformed_translation)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"String available for translation that is possibly malformed.")
-                           << "\"\t[malformedString]\n";
+                    addIssue(_WXTRANS_WSTR(L"String available for translation that is "
+                                           "possibly malformed."),
+                             L"malformedString");
                     }
                 else if (issue.first == translation_issue::concatenation_issue)
                     {
-                    report
-                        << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                        << issue.second << L"\"\t\""
-                        << _(L"String available for translation that may be getting concatenated "
-                             "at runtime with other content.")
-                        << "\"\t[concatenatedStrings]\n";
+                    addIssue(_WXTRANS_WSTR(L"String available for translation that may be "
+                                           "getting concatenated at runtime with other content."),
+                             L"concatenatedStrings");
                     }
                 else if (issue.first == translation_issue::source_needing_context_issue)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"Ambiguous string available for translation that is "
-                                "lacking a translator comment.")
-                           << "\"\t[L10NStringNeedsContext]\n";
+                    addIssue(_WXTRANS_WSTR(L"Ambiguous string available for translation that is "
+                                           "lacking a translator comment."),
+                             L"L10NStringNeedsContext");
                     }
                 else if (issue.first == translation_issue::multipart_string)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"String available for translation may contain multiple sections "
-                                "being sliced at runtime. Consider splitting each section into "
-                                "a separate resource.")
-                           << "\"\t[multipartString]\n";
+                    addIssue(_WXTRANS_WSTR(L"String available for translation may contain "
+                                           "multiple sections being sliced at runtime. Consider "
+                                           "splitting each section into a separate resource."),
+                             L"multipartString");
                     }
                 else if (issue.first == translation_issue::article_issue)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"An article is proceeding dynamic content, or a pronoun is being "
-                                 "formatted into a larger message. It is recommended to create "
-                                 "multiple versions of this string for all possible contexts instead "
-                                 "of using dynamic placeholders.")
-                           << "\"\t[articleOrPronoun]\n";
+                    addIssue(_WXTRANS_WSTR(L"An article is proceeding dynamic content, or a "
+                                           "pronoun is being formatted into a larger message. "
+                                           "It is recommended to create multiple versions of "
+                                           "this string for all possible contexts instead of "
+                                           "using dynamic placeholders."),
+                             L"articleOrPronoun");
                     }
                 else if (issue.first == translation_issue::pluralization)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"The same string is used for singular and plural situations. "
-                                "Consider using a pluralizing function (if available) or "
-                                "reword the message.")
-                           << "\"\t[pluralization]\n";
+                    addIssue(_WXTRANS_WSTR(L"The same string is used for singular and plural "
+                                           "situations. Consider using a pluralizing function "
+                                           "(if available) or reword the message."),
+                             L"pluralization");
                     }
                 else if (issue.first == translation_issue::accelerator_issue)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"Mismatching keyboard accelerators between source "
-                                "and translation strings.")
-                           << "\"\t[acceleratorMismatch]\n";
+                    addIssue(_WXTRANS_WSTR(L"Mismatching keyboard accelerators between source "
+                                           "and translation strings."),
+                             L"acceleratorMismatch");
                     }
                 else if (issue.first == translation_issue::number_issue)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"Mismatching numbers between source "
-                                "and translation strings.")
-                           << "\"\t[numberInconsistency]\n";
+                    addIssue(_WXTRANS_WSTR(L"Mismatching numbers between source "
+                                           "and translation strings."),
+                             L"numberInconsistency");
                     }
                 else if (issue.first == translation_issue::length_issue)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"Translation is suspiciously longer than the source string.")
-                           << "\"\t[lengthInconsistency]\n";
+                    addIssue(_WXTRANS_WSTR(L"Translation is suspiciously longer than the "
+                                           "source string."),
+                             L"lengthInconsistency");
                     }
                 else if (issue.first == translation_issue::consistency_issue)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"Mismatching first character casing, mismatching trailing "
-                                "punctuation/spaces/newlines, or mismatching number of tabs or "
-                                "pipe symbols between source and translation strings.")
-                           << "\"\t[transInconsistency]\n";
+                    addIssue(_WXTRANS_WSTR(L"Mismatching first character casing, mismatching "
+                                           "trailing punctuation/spaces/newlines, or mismatching "
+                                           "number of tabs or pipe symbols between source and "
+                                           "translation strings."),
+                             L"transInconsistency");
                     }
                 else if (issue.first == translation_issue::halfwidth)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"Halfwidth characters detected. "
-                                "Fullwidth characters are recommended.")
-                           << "\"\t[halfWidth]\n";
+                    addIssue(_WXTRANS_WSTR(L"Halfwidth characters detected. "
+                                           "Fullwidth characters are recommended."),
+                             L"halfWidth");
                     }
                 }
             }
+        }
 
-        // Source code warnings
-        const auto formatSourceFileWarnings =
-            [&replaceSpecialSpaces, &report, &verbose](const auto* sourceParser)
+    //------------------------------------------------------
+    static void for_each_source_issue(const i18n_review& sourceParser, const bool verbose,
+                                      const issue_callback& callback)
         {
-            for (const auto& val : sourceParser->get_unsafe_localizable_strings())
-                {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                if (val.m_usage.m_type ==
-                    i18n_review::string_info::usage_info::usage_type::function)
-                    {
-                    report << _(L"String available for translation that probably "
-                                "should not be in function call: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else if (val.m_usage.m_type ==
-                         i18n_review::string_info::usage_info::usage_type::variable)
-                    {
-                    report << _(L"String available for translation that probably "
-                                "should not be assigned to variable: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else
-                    {
-                    report << _(L"String available for translation that probably "
-                                "should not be within: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                report << L"[suspectL10NString]\n";
-                }
+        using usage_type = i18n_review::string_info::usage_info::usage_type;
 
-            for (const auto& val : sourceParser->get_localizable_strings_with_urls())
-                {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                if (val.m_usage.m_type ==
-                    i18n_review::string_info::usage_info::usage_type::function)
-                    {
-                    report << _(L"String available for translation that contains an "
-                                "URL or email address in function call: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else if (val.m_usage.m_type ==
-                         i18n_review::string_info::usage_info::usage_type::variable)
-                    {
-                    report << _(L"String available for translation that contains an "
-                                "URL or email address assigned to variable: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else
-                    {
-                    report << _(L"String available for translation that contains an "
-                                "URL or email address within: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                report << L"[urlInL10NString]\n";
-                }
+        for (const auto& val : sourceParser.get_unsafe_localizable_strings())
+            {
+            std::wstring explanation{
+                (val.m_usage.m_type == usage_type::function) ?
+                    _WXTRANS_WSTR(L"String available for translation that probably "
+                                  "should not be in function call: ") :
+                (val.m_usage.m_type == usage_type::variable) ?
+                    _WXTRANS_WSTR(L"String available for translation that probably "
+                                  "should not be assigned to variable: ") :
+                    _WXTRANS_WSTR(L"String available for translation that probably "
+                                  "should not be within: ")
+            };
+            explanation.append(val.m_usage.m_value.get());
+            callback(make_string_issue(val, true, std::move(explanation), L"suspectL10NString"));
+            }
 
-            for (const auto& val :
-                 sourceParser->get_localizable_strings_with_unlocalizable_content())
-                {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                report << _(L"String available for translation that contains a "
-                            "large amount of non-translatable.");
-                report << L"\t\"[excessiveNonL10NContent]\n";
-                }
+        for (const auto& val : sourceParser.get_localizable_strings_with_urls())
+            {
+            std::wstring explanation{
+                (val.m_usage.m_type == usage_type::function) ?
+                    _WXTRANS_WSTR(L"String available for translation that contains an "
+                                  "URL or email address in function call: ") :
+                (val.m_usage.m_type == usage_type::variable) ?
+                    _WXTRANS_WSTR(L"String available for translation that contains an "
+                                  "URL or email address assigned to variable: ") :
+                    _WXTRANS_WSTR(L"String available for translation that contains an "
+                                  "URL or email address within: ")
+            };
+            explanation.append(val.m_usage.m_value.get());
+            callback(make_string_issue(val, true, std::move(explanation), L"urlInL10NString"));
+            }
+
+        for (const auto& val : sourceParser.get_localizable_strings_with_unlocalizable_content())
+            {
+            callback(make_string_issue(val, true,
+                                       _WXTRANS_WSTR(L"String available for translation that "
+                                                     "contains a large amount of "
+                                                     "non-translatable."),
+                                       L"excessiveNonL10NContent"));
+            }
+
+        for (const auto& val : sourceParser.get_suspect_i18n_usuage())
+            {
+            callback(
+                make_string_issue(val, true, val.m_usage.m_value.get(), L"suspectI18NUsage"));
+            }
 
-            for (const auto& val : sourceParser->get_suspect_i18n_usuage())
+        for (const auto& val : sourceParser.get_localizable_strings_ambiguous_needing_context())
+            {
+            callback(make_string_issue(val, true,
+                                       _WXTRANS_WSTR(L"Ambiguous string available for "
+                                                     "translation that is lacking a "
+                                                     "translator comment."),
+                                       L"L10NStringNeedsContext"));
+            }
+
+        for (const auto& val : sourceParser.get_localizable_strings_being_concatenated())
+            {
+            callback(make_string_issue(
+                val, true,
+                _WXTRANS_WSTR(L"String available for translation that may be getting "
+                              "concatenated at runtime with other content."),
+                L"concatenatedStrings"));
+            }
+
+        for (const auto& val : sourceParser.get_multipart_strings())
+            {
+            callback(make_string_issue(
+                val, true,
+                _WXTRANS_WSTR(L"String available for translation may contain multiple sections "
+                              "being sliced at runtime. Consider splitting each section into "
+                              "a separate resource."),
+                L"multipartString"));
+            }
+
+        for (const auto& val : sourceParser.get_faux_plural_strings())
+            {
+            callback(make_string_issue(
+                val, true,
+                _WXTRANS_WSTR(L"The same string is used for singular and plural situations. "
+                              "Consider using a pluralizing function (if available) or "
+                              "reword the message."),
+                L"pluralization"));
+            }
+
+        for (const auto& val : sourceParser.get_article_issue_strings())
+            {
+            callback(make_string_issue(
+                val, false,
+                _WXTRANS_WSTR(L"An article is proceeding dynamic content, or a pronoun is being "
+                              "formatted into a larger message. It is recommended to create "
+                              "multiple versions of this string for all possible contexts "
+                              "instead of using dynamic placeholders."),
+                L"articleOrPronoun"));
+            }
+
+        for (const auto& val : sourceParser.get_localizable_strings_with_halfwidths())
+            {
+            callback(make_string_issue(
+                val, true,
+                _WXTRANS_WSTR(L"String available for translation that contains halfwidth "
+                              "characters. Fullwidth characters are recommended."),
+                L"halfWidth"));
+            }
+
+        for (const auto& val : sourceParser.get_localizable_strings_in_internal_call())
+            {
+            std::wstring explanation;
+            if (val.m_usage.m_type == usage_type::function)
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                report << val.m_usage.m_value;
-                report << L"\t\"[suspectI18NUsage]\n";
+                explanation.assign(_WXTRANS_WSTR(L"Localizable string being used within "
+                                                 "non-user facing function call: "))
+                    .append(val.m_usage.m_value.get());
                 }
-
-            for (const auto& val :
-                 sourceParser->get_localizable_strings_ambiguous_needing_context())
+            else if (val.m_usage.m_type == usage_type::variable)
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                report << _(L"Ambiguous string available for translation that is "
-                            "lacking a translator comment.");
-                report << L"\t\"[L10NStringNeedsContext]\n";
+                explanation.assign(_WXTRANS_WSTR(L"Localizable string being assigned to "
+                                                 "non-user facing variable: "))
+                    .append(val.m_usage.m_value.get());
                 }
-
-            for (const auto& val : sourceParser->get_localizable_strings_being_concatenated())
+            else if (!val.m_usage.m_value.empty())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                report << _(L"String available for translation that may be getting concatenated "
-                            "at runtime with other content.");
-                report << L"\"\t[concatenatedStrings]\n";
+                explanation.assign(_WXTRANS_WSTR(L"Localizable string being assigned to: "))
+                    .append(val.m_usage.m_value.get());
                 }
-
-            for (const auto& val : sourceParser->get_multipart_strings())
+            else
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                report << _(L"String available for translation may contain multiple sections "
-                            "being sliced at runtime. Consider splitting each section into "
-                            "a separate resource.");
-                report << L"\"\t[multipartString]\n";
+                explanation.assign(
+                    _WXTRANS_WSTR(L"Localizable string being used within non-user element."));
                 }
+            callback(make_string_issue(val, true, std::move(explanation), L"suspectL10NUsage"));
+            }
 
-            for (const auto& val : sourceParser->get_faux_plural_strings())
+        for (const auto& val : sourceParser.get_not_available_for_localization_strings())
+            {
+            std::wstring explanation;
+            if (val.m_usage.m_type == usage_type::function)
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                report << _(L"The same string is used for singular and plural situations. "
-                            "Consider using a pluralizing function (if available) or "
-                            "reword the message.");
-                report << L"\"\t[pluralization]\n";
+                explanation
+                    .assign(_WXTRANS_WSTR(L"String not available for translation in "
+                                          "function call: "))
+                    .append(val.m_usage.m_value.get());
                 }
-
-            for (const auto& val : sourceParser->get_article_issue_strings())
+            else if (val.m_usage.m_type == usage_type::variable)
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                    << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                    << _(L"An article is proceeding dynamic content, or a pronoun is being "
-                          "formatted into a larger message. It is recommended to create "
-                          "multiple versions of this string for all possible contexts instead "
-                          "of using dynamic placeholders.")
-                    << L"\"\t[articleOrPronoun]\n";
+                explanation
+                    .assign(_WXTRANS_WSTR(L"String not available for translation assigned to "
+                                          "variable: "))
+                    .append(val.m_usage.m_value.get());
                 }
-
-            for (const auto& val : sourceParser->get_localizable_strings_with_halfwidths())
+            else if (!val.m_usage.m_value.empty())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                report << _(L"String available for translation that contains halfwidth characters. "
-                            "Fullwidth characters are recommended.");
-                report << L"\"\t[halfWidth]\n";
+                explanation
+                    .assign(_WXTRANS_WSTR(L"String not available for translation assigned to: "))
+                    .append(val.m_usage.m_value.get());
                 }
-
-            for (const auto& val : sourceParser->get_localizable_strings_in_internal_call())
+            else
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                if (val.m_usage.m_type ==
-                    i18n_review::string_info::usage_info::usage_type::function)
-                    {
-                    report << _(L"Localizable string being used within non-user"
-                                " facing function call: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else if (val.m_usage.m_type ==
-                         i18n_review::string_info::usage_info::usage_type::variable)
-                    {
-                    report << _(L"Localizable string being assigned to non-user facing variable: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else if (!val.m_usage.m_value.empty())
-                    {
-                    report << _(L"Localizable string being assigned to: ") << val.m_usage.m_value
-                           << L"\"\t";
-                    }
-                else
-                    {
-                    report << _(L"Localizable string being used within non-user element.") << L"\"\t";
-                    }
-                report << L"[suspectL10NUsage]\n";
+                explanation.assign(_WXTRANS_WSTR(L"String not available for translation."));
                 }
+            callback(make_string_issue(val, true, std::move(explanation), L"notL10NAvailable"));
+            }
 
-            for (const auto& val : sourceParser->get_not_available_for_localization_strings())
+        for (const auto& val : sourceParser.get_deprecated_macros())
+            {
+            callback(
+                make_string_issue(val, true, val.m_usage.m_value.get(), L"deprecatedMacro"));
+            }
+
+        for (const auto& val : sourceParser.get_printf_single_numbers())
+            {
+            callback(make_string_issue(val, true,
+                                       _WXTRANS_WSTR(L"Prefer using std::to_[w]string() instead "
+                                                     "of printf() to format a number."),
+                                       L"printfSingleNumber"));
+            }
+
+        // the values of these are code, not strings
+        for (const auto& val : sourceParser.get_duplicates_value_assigned_to_ids())
+            {
+            auto issue{ make_string_issue(
+                val, false,
+                _WXTRANS_WSTR(L"Verify that duplicate assignment was intended. "
+                              "If correct, consider assigning the first ID variable by name "
+                              "to the second one to make this intention clear."),
+                L"dupValAssignedToIds") };
+            issue.m_quoted_value = false;
+            callback(issue);
+            }
+
+        for (const auto& val : sourceParser.get_ids_assigned_number())
+            {
+            auto issue{ make_string_issue(
+                val, false,
+                _WXTRANS_WSTR(L"Prefer using ID constants provided by your framework when "
+                              "assigning values to an ID variable."),
+                L"numberAssignedToId") };
+            issue.m_quoted_value = false;
+            callback(issue);
+            }
+
+        for (const auto& val : sourceParser.get_malformed_strings())
+            {
+            callback(make_string_issue(val, true, _WXTRANS_WSTR(L"Malformed syntax in string."),
+                                       L"malformedString"));
+            }
+
+        for (const auto& val : sourceParser.get_unencoded_ext_ascii_strings())
+            {
+            std::wstringstream encodingRecommendations;
+            for (const auto& ch : replace_special_spaces(val.m_string))
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                if (val.m_usage.m_type ==
-                    i18n_review::string_info::usage_info::usage_type::function)
-                    {
-                    report << _(L"String not available for translation in function call: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else if (val.m_usage.m_type ==
-                         i18n_review::string_info::usage_info::usage_type::variable)
-                    {
-                    report << _(L"String not available for translation assigned to variable: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else if (!val.m_usage.m_value.empty())
+                if (ch > 127)
                     {
-                    report << _(L"String not available for translation assigned to: ")
-                           << val.m_usage.m_value << L"\"\t";
+                    encodingRecommendations << LR"(\U)" << std::setfill(L'0') << std::setw(8)
+                                            << std::uppercase << std::hex
+                                            << static_cast<int>(ch);
                     }
                 else
                     {
-                    report << _(L"String not available for translation.") << L"\"\t";
+                    encodingRecommendations << ch;
                     }
-                report << L"[notL10NAvailable]\n";
                 }
 
-            for (const auto& val : sourceParser->get_deprecated_macros())
-                {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t\""
-                       << replaceSpecialSpaces(val.m_string) << L"\"\t\"" << val.m_usage.m_value
-                       << L"\"\t[deprecatedMacro]\n";
-                }
+            std::wstring explanation{ _WXTRANS_WSTR(
+                L"String contains extended ASCII characters that should be encoded. "
+                "Recommended change: '") };
+            explanation.append(encodingRecommendations.str()).append(L"'");
+            callback(make_string_issue(val, true, std::move(explanation), L"unencodedExtASCII"));
+            }
 
-            for (const auto& val : sourceParser->get_printf_single_numbers())
-                {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t\""
-                       << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                       << _(L"Prefer using std::to_[w]string() instead of printf() to "
-                            "format a number.")
-                       << L"\"\t[printfSingleNumber]\n";
-                }
+        for (const auto& val : sourceParser.get_trailing_spaces())
+            {
+            callback(make_string_issue(
+                val, true, _WXTRANS_WSTR(L"Trailing spaces detected at end of line."),
+                L"trailingSpaces"));
+            }
 
-            for (const auto& val : sourceParser->get_duplicates_value_assigned_to_ids())
-                {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t\t"
-                       << replaceSpecialSpaces(val.m_string) << L"\t\""
-                       << _(L"Verify that duplicate assignment was intended. "
-                            "If correct, consider assigning the first ID variable by name "
-                            "to the second one to make this intention clear.")
-                       << L"\"\t[dupValAssignedToIds]\n";
-                }
+        for (const auto& val : sourceParser.get_tabs())
+            {
+            callback(make_string_issue(
+                val, true, _WXTRANS_WSTR(L"Tab detected in file; prefer using spaces."),
+                L"tabs"));
+            }
 
-            for (const auto& val : sourceParser->get_ids_assigned_number())
-                {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t\t"
-                       << replaceSpecialSpaces(val.m_string) << L"\t\""
-                       << _(L"Prefer using ID constants provided by your framework when "
-                            "assigning values to an ID variable.")
-                       << L"\"\t[numberAssignedToId]\n";
-                }
+        for (const auto& val : sourceParser.get_wide_lines())
+            {
+            std::wstring explanation{ _WXTRANS_WSTR(L"Line length: ") };
+            explanation.append(val.m_usage.m_value.get());
+            callback(make_string_issue(val, true, std::move(explanation), L"wideLine"));
+            }
 
-            for (const auto& val : sourceParser->get_malformed_strings())
-                {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t\""
-                       << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                       << _(L"Malformed syntax in string.") << L"\"\t[malformedString]\n";
-                }
+        for (const auto& val : sourceParser.get_comments_missing_space())
+            {
+            callback(make_string_issue(
+                val, true,
+                _WXTRANS_WSTR(L"Space should be inserted between comment tag and comment."),
+                L"commentMissingSpace"));
+            }
 
-            for (const auto& val : sourceParser->get_unencoded_ext_ascii_strings())
+        if (verbose)
+            {
+            for (const auto& parseErr : sourceParser.get_error_log())
                 {
-                std::wstringstream encodingRecommendations;
-                auto untabbedStr{ replaceSpecialSpaces(val.m_string) };
-                for (const auto& ch : untabbedStr)
-                    {
-                    if (ch > 127)
-                        {
-                        encodingRecommendations << LR"(\U)" << std::setfill(L'0') << std::setw(8)
-                                                << std::uppercase << std::hex
-                                                << static_cast<int>(ch);
-                        }
-                    else
-                        {
-                        encodingRecommendations << ch;
-                        }
-                    }
-
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                       << _(L"String contains extended ASCII characters that should be encoded. "
-                            "Recommended change: '")
-                       << encodingRecommendations.str() << L"'\"\t[unencodedExtASCII]\n";
+                callback(analysis_issue{
+                    parseErr.m_file_name,
+                    (parseErr.m_line != std::wstring::npos) ?
+                        std::optional<size_t>{ parseErr.m_line } :
+                        std::nullopt,
+                    (parseErr.m_column != std::wstring::npos) ?
+                        std::optional<size_t>{ parseErr.m_column } :
+                        std::nullopt,
+                    parseErr.m_resourceString, true, parseErr.m_message, L"debugParserInfo" });
                 }
+            }
+        }
 
-            for (const auto& val : sourceParser->get_trailing_spaces())
-                {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t\""
-                       << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                       << _(L"Trailing spaces detected at end of line.")
-                       << L"\"\t[trailingSpaces]\n";
-                }
+    //------------------------------------------------------
+    void batch_analyze::for_each_issue(const issue_callback& callback,
+                                       const bool verbose /*= false*/) const
+        {
+        for_each_rc_issue(*m_rc, callback);
+        for_each_info_plist_issue(*m_plist, callback);
+        for_each_catalog_issue(*m_po, callback);
+        for_each_source_issue(*m_cpp, verbose, callback);
+        for_each_source_issue(*m_csharp, verbose, callback);
 
-            for (const auto& val : sourceParser->get_tabs())
-                {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t\""
-                       << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                       << _(L"Tab detected in file; prefer using spaces.") << L"\"\t[tabs]\n";
-                }
+        for (const auto& [file, encoding] : m_filesThatShouldBeConvertedToUTF8)
+            {
+            callback(analysis_issue{ file, std::nullopt, std::nullopt,
+                                     std::wstring{ get_encoding_name(encoding) }, true,
+                                     _WXTRANS_WSTR(L"File contains extended ASCII characters, "
+                                                   "but is not encoded as UTF-8."),
+                                     L"nonUTF8File" });
+            }
 
-            for (const auto& val : sourceParser->get_wide_lines())
-                {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t\""
-                       << replaceSpecialSpaces(val.m_string) << L"\"\t\"" << _(L"Line length: ")
-                       << val.m_usage.m_value << L"\"\t[wideLine]\n";
-                }
+        for (const auto& file : m_filesThatContainUTF8Signature)
+            {
+            callback(analysis_issue{
+                file, std::nullopt, std::nullopt, std::wstring{}, false,
+                _WXTRANS_WSTR(L"File contains UTF-8 signature; "
+                              "It is recommended to save without the file signature for "
+                              "best compiler portability."),
+                L"UTF8FileWithBOM" });
+            }
+        }
 
-            for (const auto& val : sourceParser->get_comments_missing_space())
-                {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t\""
-                       << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                       << _(L"Space should be inserted between comment tag and comment.")
-                       << L"\"\t[commentMissingSpace]\n";
-                }
+    //------------------------------------------------------
+    void batch_analyze::format_results(std::wostream& report, const bool verbose /*= false*/)
+        {
+        I18N_PROFILE_SCOPE(m_profiling ? &m_profile : nullptr, profile_phase::format, 1);
 
-            if (verbose)
-                {
-                for (const auto& parseErr : sourceParser->get_error_log())
+        report << // TRANSLATORS: Column header in output
+                  _("File") << L"\t" <<
+                  // TRANSLATORS: Column header in output
+                  _(L"Line") << L"\t" <<
+                  // TRANSLATORS: Column header in output
+                  _(L"Column") << L"\t" <<
+                  // TRANSLATORS: Column header in output
+                  _(L"Value") << L"\t" <<
+                  // TRANSLATORS: Column header in output
+                  _(L"Explanation") << L"\t" <<
+                  // TRANSLATORS: Column header in output
+                  _(L"Warning ID") << L"\n";
+
+        // each issue is written as soon as it is read, so that the report isn't built in memory
+        for_each_issue(
+            [&report](const analysis_issue& issue)
+            {
+                report << issue.m_file << L"\t";
+                if (issue.m_line)
                     {
-                    report << parseErr.m_file_name << L"\t";
-                    if (parseErr.m_line != std::wstring::npos)
-                        {
-                        report << parseErr.m_line;
-                        }
-                    report << L"\t";
-                    if (parseErr.m_column != std::wstring::npos)
-                        {
-                        report << parseErr.m_column;
-                        }
-                    report << L"\t\"" << parseErr.m_resourceString << L"\"\t\""
-                           << parseErr.m_message << L"\"\t[debugParserInfo]\n";
+                    report << issue.m_line.value();
                     }
-                }
-        };
-
-        formatSourceFileWarnings(m_cpp);
-        formatSourceFileWarnings(m_csharp);
+                report << L"\t";
+                if (issue.m_column)
+                    {
+                    report << issue.m_column.value();
+                    }
+                report << L"\t";
+                if (issue.m_quoted_value)
+                    {
+                    report << L"\"" << issue.m_value << L"\"";
+                    }
+                else
+                    {
+                    report << issue.m_value;
+                    }
+                report << L"\t\"" << issue.m_explanation << L"\"\t[" << issue.m_warning_id
+                       << L"]\n";
+            },
+            verbose);
+        }
 
-        for (const auto& file : m_filesThatShouldBeConvertedToUTF8)
+    //------------------------------------------------------
+    void batch_analyze::analyze_document(const std::filesystem::path& file, std::wstring text,
+                                         const issue_callback& callback) const
+        {
+        const file_review_type fileType = get_file_type(file);
+        const i18n_review* analyzer{ m_cpp };
+        if (fileType == file_review_type::rc)
+            {
+            analyzer = m_rc;
+            }
+        else if (fileType == file_review_type::infoplist)
+            {
+            analyzer = m_plist;
+            }
+        else if (fileType == file_review_type::po)
             {
-            report << file << L"\t\t\t\t\""
-                   << _(L"File contains extended ASCII characters, "
-                        "but is not encoded as UTF-8.")
-                   << L"\"\t[nonUTF8File]\n";
+            analyzer = m_po;
+            }
+        else if (fileType == file_review_type::cs)
+            {
+            analyzer = m_csharp;
             }
 
-        for (const auto& file : m_filesThatContainUTF8Signature)
+        // the analyzers expect the last line to be terminated
+        if (!text.empty() && text.back() != L'\n')
             {
-            report << file << L"\t\t\t\t\""
-                   << _(L"File contains UTF-8 signature; "
-                        "It is recommended to save without the file signature for "
-                        "best compiler portability.")
-                   << L"\"\t[UTF8FileWithBOM]\n";
+            text += L'\n';
+            }
+        const auto fileAnalyzer = analyzer->clone();
+        fileAnalyzer->review_buffer(text, file);
+        // only the analyzers that analyze() reviews the strings of
+        if (analyzer == m_cpp || analyzer == m_po)
+            {
+            fileAnalyzer->review_strings([]([[maybe_unused]] const size_t) {},
+                                         []([[maybe_unused]] const size_t,
+                                            [[maybe_unused]] const std::filesystem::path&)
+                                         { return true; });
             }
 
-        return report;
+        if (fileType == file_review_type::rc)
+            {
+            for_each_rc_issue(static_cast<const rc_file_review&>(*fileAnalyzer), callback);
+            }
+        else if (fileType == file_review_type::infoplist)
+            {
+            for_each_info_plist_issue(static_cast<const info_plist_file_review&>(*fileAnalyzer),
+                                      callback);
+            }
+        else if (fileType == file_review_type::po)
+            {
+            for_each_catalog_issue(static_cast<const po_file_review&>(*fileAnalyzer), callback);
+            }
+        else
+            {
+            for_each_source_issue(*fileAnalyzer, false, callback);
+            }
         }
     } // namespace i18n_check
@@ -18,31 +18,34 @@
 #ifndef __I18N_ANALYZE_H__
 #define __I18N_ANALYZE_H__
 
+#include "check_profile.h"
 #include "cpp_i18n_review.h"
 #include "csharp_i18n_review.h"
 #include "i18n_string_util.h"
 #include "info_plist_review.h"
+#include "mapped_file.h"
 #include "po_file_review.h"
 #include "pseudo_translate.h"
 #include "rc_file_review.h"
-#include "unicode_extract_text.h"
-#include "utfcpp/source/utf8.h"
+#include "results_cache.h"
+#include "text_decode.h"
 #include <filesystem>
 #include <fstream>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace i18n_check
     {
     /// @private
-    std::pair<bool, std::wstring> read_utf16_file(const std::filesystem::path& filePath);
-    /// @private
     bool valid_utf8_file(const std::filesystem::path& filePath, bool& startsWithBom);
     /// @private
-    std::pair<bool, std::wstring> read_utf8_file(const std::filesystem::path& filePath,
-                                                 bool& startsWithBom);
+    decoded_text read_text(std::string_view fileData, const text_encoding legacyEncoding);
 
     /// @brief Gets the file type of a file based on extension.
     /// @param file The file path.
@@ -90,6 +93,28 @@ namespace i18n_check
         return (fileType == file_review_type::cpp || fileType == file_review_type::cs);
         }
 
+    /// @brief An issue found by the analysis (i.e., a row of the report).
+    struct analysis_issue
+        {
+        /// @brief The file that the issue is in.
+        std::filesystem::path m_file;
+        /// @brief The (one-indexed) line of the issue, if it is for a line.
+        std::optional<size_t> m_line;
+        /// @brief The (one-indexed) column of the issue, if it is known.
+        std::optional<size_t> m_column;
+        /// @brief The string (or other content) that the issue is about.
+        std::wstring m_value;
+        /// @brief @c false if the value isn't a string, and is written without quotes.
+        bool m_quoted_value{ true };
+        /// @brief A description of the issue.
+        std::wstring m_explanation;
+        /// @brief The warning ID (e.g., @c suspectL10NString).
+        std::wstring_view m_warning_id;
+        };
+
+    /// @brief Callback that receives each issue from an analysis.
+    using issue_callback = std::function<void(const analysis_issue&)>;
+
     /// @brief Wrapper class to analyze and summarize a batch of files.
     class batch_analyze
         {
@@ -122,6 +147,160 @@ namespace i18n_check
         void analyze(const std::vector<std::filesystem::path>& filesToAnalyze,
                      analyze_callback_reset resetCallback, analyze_callback callback);
 
+        /** @brief Sets the number of files to analyze at the same time.
+            @param jobs The number of threads to analyze files with.
+                @c 0 will use the number of processor cores, and @c 1 (the default)
+                will analyze the files sequentially.
+            @note The results will be the same regardless of the number of jobs.*/
+        void set_jobs(const size_t jobs) noexcept { m_jobs = jobs; }
+
+        /// @returns The number of files to analyze at the same time.
+        [[nodiscard]]
+        size_t get_jobs() const noexcept
+            {
+            return m_jobs;
+            }
+
+        /** @brief Sets the encoding to read files with if they are not Unicode
+                (i.e., UTF-8 or UTF-16 with a BOM).
+            @param encoding The legacy (8-bit) encoding (the default is Windows-1252).*/
+        void set_legacy_encoding(const text_encoding encoding) noexcept
+            {
+            m_legacyEncoding = encoding;
+            }
+
+        /// @returns The encoding to read files with if they are not Unicode.
+        [[nodiscard]]
+        text_encoding get_legacy_encoding() const noexcept
+            {
+            return m_legacyEncoding;
+            }
+
+        /** @brief Sets the folder to cache the analysis of each file in.
+            @details When a file's content (and the analyzers' settings) haven't changed
+                since it was cached, its results are loaded from the cache rather than
+                analyzing it again. The results from all files are still reviewed
+                together afterwards, so the output is the same as without the cache.
+            @param cacheFolder The folder to store the cache in (e.g., ".quneiform-cache").\n
+                An empty path (the default) disables caching.*/
+        void set_cache_folder(std::filesystem::path cacheFolder)
+            {
+            m_cacheFolder = std::move(cacheFolder);
+            }
+
+        /// @returns The folder that analysis results are cached in, or an empty path
+        ///     if caching is disabled.
+        [[nodiscard]]
+        const std::filesystem::path& get_cache_folder() const noexcept
+            {
+            return m_cacheFolder;
+            }
+
+        /// @returns The number of files whose results were loaded from the cache
+        ///     during the last call to analyze().
+        [[nodiscard]]
+        size_t get_cached_file_count() const noexcept
+            {
+            return m_cachedFileCount;
+            }
+
+        /** @brief Keeps the results from each file in memory, so that later calls to
+                analyze() only need to analyze files that were changed.
+            @details This is meant for long-running sessions (e.g., watching a folder),
+                where files that were changed should be passed to invalidate_files()
+                before calling analyze() again. Files that are not in the list passed to
+                analyze() are left out of the results, but are still kept in memory.\n
+                The results from all files are still reviewed together afterwards,
+                so the output is the same as analyzing every file again.\n
+                If the analyzers' settings are changed, then the results kept in memory
+                are discarded on the next call to analyze().
+            @param keepResident @c true to keep the results in memory.*/
+        void keep_results_resident(const bool keepResident)
+            {
+            m_keepResultsResident = keepResident;
+            if (!keepResident)
+                {
+                m_residentResults.clear();
+                }
+            }
+
+        /// @returns @c true if the results from each file are being kept in memory.
+        [[nodiscard]]
+        bool is_keeping_results_resident() const noexcept
+            {
+            return m_keepResultsResident;
+            }
+
+        /** @brief Discards the results kept in memory for files that were changed,
+                so that they are analyzed again on the next call to analyze().
+            @param files The files that were changed (or deleted).
+                If a folder is included, then the files in it are discarded.*/
+        void invalidate_files(const std::vector<std::filesystem::path>& files);
+
+        /** @brief Analyzes a document's (unsaved) text by itself, and passes its issues
+                to a callback.
+            @details This is meant for editors, where a document is analyzed again as it is
+                being edited, without reviewing the rest of the files. The results from
+                analyze() are not changed.\n
+                Because the document is reviewed by itself, checks that look across files
+                (e.g., whether a wxWidgets application initializes its locale) only see
+                this document.
+            @param file The path of the document.
+            @param text The document's text.
+            @param callback The function to pass each issue to.*/
+        void analyze_document(const std::filesystem::path& file, std::wstring text,
+                              const issue_callback& callback) const;
+
+        /// @returns The number of files whose results were reused from memory
+        ///     during the last call to analyze().
+        [[nodiscard]]
+        size_t get_resident_file_count() const noexcept
+            {
+            return m_residentFileCount;
+            }
+
+        /** @brief Sets whether to record how long each check (and each phase of the analysis)
+                takes, along with how many strings each check examines.
+            @details The profile is reset at the start of each call to analyze(), and
+                format_results() and format_summary() add to it afterwards.
+            @param profile @c true to profile the analysis.
+            @note Profiling is only available if built with @c QUNEIFORM_PROFILING defined
+                (see check_profile::is_available()).*/
+        void set_profiling(const bool profile) noexcept { m_profiling = profile; }
+
+        /// @returns @c true if the analysis is being profiled.
+        [[nodiscard]]
+        bool is_profiling() const noexcept
+            {
+            return m_profiling;
+            }
+
+        /// @returns The timings from the last analysis (if profiling).
+        [[nodiscard]]
+        const check_profile& get_profile() const noexcept
+            {
+            return m_profile;
+            }
+
+        /** @brief Limits the analysis to the lines changed by a patch
+                (e.g., from read_unified_diff()).
+            @details Checks for a single line (e.g., trailing spaces) are skipped on unchanged
+                lines, and only issues found on changed lines are reported.\n
+                Checks that compare strings across files are still performed with all strings
+                from the analyzed files, so that an added string can be compared against the
+                existing ones.
+            @param changedLines The lines changed in each file.
+                An empty map (the default) analyzes all lines.*/
+        void set_changed_lines(changed_lines_map changedLines)
+            {
+            // results kept in memory aren't keyed by the changed lines
+            m_residentResults.clear();
+            m_changedLines =
+                changedLines.empty() ?
+                    nullptr :
+                    std::make_shared<const changed_lines_map>(std::move(changedLines));
+            }
+
         /** @brief Pseudo translates a set of files.
             @details Copies of each file are made in the same folder with
                 'pseudo_' prepended to the file name.
@@ -142,20 +321,36 @@ namespace i18n_check
                               bool addSurroundingBrackets, int8_t widthChange, bool addTrackingIds,
                               analyze_callback_reset resetCallback, analyze_callback callback);
 
+        /** @brief Passes each issue from the last call to analyze() to a callback.
+            @details The issues are in the same order as the rows written by format_results().
+            @param callback The function to pass each issue to.
+            @param verbose @c true to include debug output.*/
+        void for_each_issue(const issue_callback& callback, const bool verbose = false) const;
+
         /** @returns A formatted summary of the results.
             @param verbose @c true to include debug output.*/
         [[nodiscard]]
         std::wstringstream format_results(const bool verbose = false);
 
+        /** @brief Writes a formatted summary of the results to a stream.
+            @details Each issue is written as a tab-delimited row as it is formatted,
+                so a large report can be streamed to a file (e.g., through a report_writer)
+                without building it in memory first.
+            @param report The stream to write to.
+            @param verbose @c true to include debug output.*/
+        void format_results(std::wostream& report, const bool verbose = false);
+
         /** @returns A formatted summary of the options used.
             @param verbose Whether to include information about which checks
                 were performed in the summary.*/
         [[nodiscard]]
         std::wstringstream format_summary(const bool verbose = false);
 
-        /// @returns The files that should be converted to UTF-8 (from the last call to analyze()).
+        /// @returns The files that should be converted to UTF-8 (from the last call to analyze()),
+        ///     along with the encodings that they were read as.
         [[nodiscard]]
-        std::vector<std::filesystem::path>& get_files_that_should_be_converted_to_utf() noexcept
+        std::vector<std::pair<std::filesystem::path, text_encoding>>&
+        get_files_that_should_be_converted_to_utf() noexcept
             {
             return m_filesThatShouldBeConvertedToUTF8;
             }
@@ -175,16 +370,84 @@ namespace i18n_check
             }
 
       private:
+        /// @brief Information about loading a file that is logged by the batch analyzer.
+        struct file_load_info
+            {
+            bool m_shouldBeConvertedToUTF8{ false };
+            bool m_containsUTF8Signature{ false };
+            bool m_loadedFromCache{ false };
+            bool m_loadedFromMemory{ false };
+            text_encoding m_encoding{ text_encoding::utf8 };
+            std::wstring m_errorMessage;
+            /// @brief The file's results, to keep in memory (if requested).
+            std::optional<std::string> m_results;
+            };
+
+        /// @brief Loads a file into whichever of the analyzers is meant for its file type.
+        /// @details If @c residentResults is not null, then the file's results are read from
+        ///     that instead of the file. Otherwise, if @c cache is not null, then the file's
+        ///     results are loaded from it (if available) or are stored in it after the file
+        ///     is analyzed.\n
+        ///     If @c keepResults is @c true, then the file's results are also returned
+        ///     (so that they can be kept in memory).
+        [[nodiscard]]
+        static file_load_info load_file(const std::filesystem::path& file, i18n_review& cpp,
+                                        i18n_review& rc, i18n_review& po, i18n_review& csharp,
+                                        i18n_review& plist, const text_encoding legacyEncoding,
+                                        const results_cache* cache,
+                                        const std::string* residentResults,
+                                        const bool keepResults);
+        /// @brief Analyzes a file's text with a copy of an analyzer.
+        /// @param analyzer The analyzer to copy (the copy receives the results).
+        /// @param fileText The file's text (which is modified during the review).
+        /// @param file The file's path.
+        /// @param[out] results The file's results and encoding info, in the cache's format.
+        /// @returns The analyzer with the results.
+        [[nodiscard]]
+        static std::unique_ptr<i18n_review> review_file_text(const i18n_review& analyzer,
+                                                             decoded_text& fileText,
+                                                             const std::filesystem::path& file,
+                                                             std::string& results);
+        /// @returns The results of a file kept in memory, or null if it needs to be analyzed.
+        [[nodiscard]]
+        const std::string* find_resident_results(const std::filesystem::path& file) const;
+        /// @returns A hash of all the settings that affect analyzing a file.
+        [[nodiscard]]
+        uint64_t get_settings_hash() const;
+        /// @brief Adds information about loading a file to the results.
+        void log_file_load_info(const std::filesystem::path& file, file_load_info& loadInfo);
+        /// @brief Loads files into the analyzers using multiple threads.
+        /// @returns @c false if the analysis was cancelled.
+        bool analyze_in_parallel(const std::vector<std::filesystem::path>& filesToAnalyze,
+                                 const size_t jobCount, const results_cache* cache,
+                                 analyze_callback callback);
+
         i18n_check::cpp_i18n_review* m_cpp{ nullptr };
         i18n_check::rc_file_review* m_rc{ nullptr };
         i18n_check::po_file_review* m_po{ nullptr };
         i18n_check::cpp_i18n_review* m_csharp{ nullptr };
         i18n_check::info_plist_file_review* m_plist{ nullptr };
 
-        std::vector<std::filesystem::path> m_filesThatShouldBeConvertedToUTF8;
+        std::vector<std::pair<std::filesystem::path, text_encoding>>
+            m_filesThatShouldBeConvertedToUTF8;
         std::vector<std::filesystem::path> m_filesThatContainUTF8Signature;
 
         std::wstring m_logReport;
+
+        size_t m_jobs{ 1 };
+        text_encoding m_legacyEncoding{ text_encoding::windows_1252 };
+        std::filesystem::path m_cacheFolder;
+        size_t m_cachedFileCount{ 0 };
+        std::shared_ptr<const changed_lines_map> m_changedLines;
+
+        bool m_keepResultsResident{ false };
+        /// @brief The settings that the results kept in memory were analyzed with.
+        uint64_t m_residentSettingsHash{ 0 };
+        std::unordered_map<std::filesystem::path::string_type, std::string> m_residentResults;
+        size_t m_residentFileCount{ 0 };
+
+        bool m_profiling{ false };
+        check_profile m_profile;
         };
     } // namespace i18n_check
 
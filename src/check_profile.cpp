@@ -0,0 +1,211 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "check_profile.h"
+#include "i18n_review.h"
+#include <algorithm>
+#include <bit>
+#include <format>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace i18n_check
+    {
+    /// @brief The flags that are checks, along with their names.
+    constexpr std::array<std::pair<int64_t, std::wstring_view>, 30> CHECK_NAMES{ {
+        { check_l10n_strings, L"check_l10n_strings" },
+        { check_suspect_l10n_string_usage, L"check_suspect_l10n_string_usage" },
+        { check_not_available_for_l10n, L"check_not_available_for_l10n" },
+        { check_deprecated_macros, L"check_deprecated_macros" },
+        { check_utf8_encoded, L"check_utf8_encoded" },
+        { check_unencoded_ext_ascii, L"check_unencoded_ext_ascii" },
+        { check_printf_single_number, L"check_printf_single_number" },
+        { check_l10n_contains_url, L"check_l10n_contains_url" },
+        { check_number_assigned_to_id, L"check_number_assigned_to_id" },
+        { check_duplicate_value_assigned_to_ids, L"check_duplicate_value_assigned_to_ids" },
+        { check_malformed_strings, L"check_malformed_strings" },
+        { check_utf8_with_signature, L"check_utf8_with_signature" },
+        { check_fonts, L"check_fonts" },
+        { check_l10n_concatenated_strings, L"check_l10n_concatenated_strings" },
+        { check_needing_context, L"check_needing_context" },
+        { check_suspect_i18n_usage, L"check_suspect_i18n_usage" },
+        { check_l10n_contains_excessive_nonl10n_content,
+          L"check_l10n_contains_excessive_nonl10n_content" },
+        { check_multipart_strings, L"check_multipart_strings" },
+        { check_pluaralization, L"check_pluaralization" },
+        { check_articles_proceeding_placeholder, L"check_articles_proceeding_placeholder" },
+        { check_mismatching_printf_commands, L"check_mismatching_printf_commands" },
+        { check_accelerators, L"check_accelerators" },
+        { check_consistency, L"check_consistency" },
+        { check_numbers, L"check_numbers" },
+        { check_length, L"check_length" },
+        { check_halfwidth, L"check_halfwidth" },
+        { check_trailing_spaces, L"check_trailing_spaces" },
+        { check_tabs, L"check_tabs" },
+        { check_line_width, L"check_line_width" },
+        { check_space_after_comment, L"check_space_after_comment" },
+    } };
+
+    /// @brief The names of the phases.
+    constexpr std::array<std::wstring_view, static_cast<size_t>(profile_phase::phase_count)>
+        PHASE_NAMES{ L"read_decode", L"scan", L"review", L"format" };
+
+    /// @brief A counter's values, along with its name.
+    struct profile_row
+        {
+        std::wstring_view m_name;
+        uint64_t m_nanoseconds{ 0 };
+        uint64_t m_calls{ 0 };
+        uint64_t m_items{ 0 };
+        };
+
+    //--------------------------------------------------
+    static profile_row read_counter(std::wstring_view name, const profile_counter& counter)
+        {
+        return profile_row{ name, counter.m_nanoseconds.load(std::memory_order_relaxed),
+                            counter.m_calls.load(std::memory_order_relaxed),
+                            counter.m_items.load(std::memory_order_relaxed) };
+        }
+
+    //--------------------------------------------------
+    static std::string to_json_string(std::wstring_view name)
+        {
+        // names are ASCII identifiers, so they don't need escaping
+        std::string str{ "\"" };
+        for (const wchar_t chr : name)
+            {
+            str += static_cast<char>(chr);
+            }
+        return str + "\"";
+        }
+
+    //--------------------------------------------------
+    profile_counter& check_profile::get_counter(const int64_t check) noexcept
+        {
+        const auto flags{ static_cast<uint64_t>(check) };
+        return m_checks[(flags == 0) ? 0 : static_cast<size_t>(std::countr_zero(flags))];
+        }
+
+    //--------------------------------------------------
+    void check_profile::clear() noexcept
+        {
+        for (auto& counter : m_checks)
+            {
+            counter.m_nanoseconds = 0;
+            counter.m_calls = 0;
+            counter.m_items = 0;
+            }
+        for (auto& counter : m_phases)
+            {
+            counter.m_nanoseconds = 0;
+            counter.m_calls = 0;
+            counter.m_items = 0;
+            }
+        m_scratch_files = 0;
+        m_scratch_allocations = 0;
+        m_scratch_heap_allocations = 0;
+        }
+
+    //--------------------------------------------------
+    std::wstring check_profile::format_table() const
+        {
+        const auto formatRow = [](const profile_row& row)
+        {
+            return std::format(L"{:<48}{:>12.3f}{:>12}{:>12}\n", row.m_name,
+                               static_cast<double>(row.m_nanoseconds) / 1'000'000, row.m_calls,
+                               row.m_items);
+        };
+
+        std::wstring table{ std::format(L"{:<48}{:>12}{:>12}{:>12}\n", L"Phase", L"Time (ms)",
+                                        L"Calls", L"Items") };
+        for (size_t i = 0; i < m_phases.size(); ++i)
+            {
+            table += formatRow(read_counter(PHASE_NAMES[i], m_phases[i]));
+            }
+
+        std::vector<profile_row> checkRows;
+        for (const auto& [check, name] : CHECK_NAMES)
+            {
+            const auto row{ read_counter(name,
+                                         m_checks[static_cast<size_t>(std::countr_zero(
+                                             static_cast<uint64_t>(check)))]) };
+            if (row.m_calls > 0)
+                {
+                checkRows.push_back(row);
+                }
+            }
+        std::stable_sort(checkRows.begin(), checkRows.end(),
+                         [](const auto& lhv, const auto& rhv)
+                         { return lhv.m_nanoseconds > rhv.m_nanoseconds; });
+
+        table += std::format(L"\n{:<48}{:>12}{:>12}{:>12}\n", L"Check", L"Time (ms)", L"Calls",
+                             L"Items");
+        for (const auto& row : checkRows)
+            {
+            table += formatRow(row);
+            }
+
+        table += std::format(L"\n{:<48}{:>12}{:>12}{:>12}\n", L"Scratch memory", L"Files",
+                             L"Allocations", L"From heap");
+        table += std::format(L"{:<48}{:>12}{:>12}{:>12}\n", L"per-file arena",
+                             m_scratch_files.load(std::memory_order_relaxed),
+                             get_scratch_allocations(), get_scratch_heap_allocations());
+        return table;
+        }
+
+    //--------------------------------------------------
+    std::string check_profile::format_json() const
+        {
+        const auto formatRow = [](const profile_row& row)
+        {
+            return std::format(
+                "{{\"name\":{},\"milliseconds\":{:.3f},\"calls\":{},\"items\":{}}}",
+                to_json_string(row.m_name), static_cast<double>(row.m_nanoseconds) / 1'000'000,
+                row.m_calls, row.m_items);
+        };
+
+        std::string json{ "{\"phases\":[" };
+        for (size_t i = 0; i < m_phases.size(); ++i)
+            {
+            if (i > 0)
+                {
+                json += ',';
+                }
+            json += formatRow(read_counter(PHASE_NAMES[i], m_phases[i]));
+            }
+        json += "],\"checks\":[";
+        bool firstCheck{ true };
+        for (const auto& [check, name] : CHECK_NAMES)
+            {
+            const auto row{ read_counter(name,
+                                         m_checks[static_cast<size_t>(std::countr_zero(
+                                             static_cast<uint64_t>(check)))]) };
+            if (row.m_calls == 0)
+                {
+                continue;
+                }
+            if (!firstCheck)
+                {
+                json += ',';
+                }
+            json += formatRow(row);
+            firstCheck = false;
+            }
+        json += std::format("],\"scratch\":{{\"files\":{},\"allocations\":{},"
+                            "\"heap_allocations\":{}}}}}\n",
+                            m_scratch_files.load(std::memory_order_relaxed),
+                            get_scratch_allocations(), get_scratch_heap_allocations());
+        return json;
+        }
+    } // namespace i18n_check
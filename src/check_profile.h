@@ -0,0 +1,225 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __CHECK_PROFILE_H__
+#define __CHECK_PROFILE_H__
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/** @brief Times a block of code, adding the time to a check (or phase) in a check_profile.
+    @details This compiles to nothing unless @c QUNEIFORM_PROFILING is defined, and does
+        nothing at runtime if the profile is null.
+    @param profile A pointer to the check_profile (can be null).
+    @param key The @c review_style flag (or @c profile_phase) to add the time to.
+    @param items The number of strings (or files) being examined.*/
+#ifdef QUNEIFORM_PROFILING
+    #define I18N_PROFILE_SCOPE_NAME2(line) profileScope##line
+    #define I18N_PROFILE_SCOPE_NAME(line) I18N_PROFILE_SCOPE_NAME2(line)
+    #define I18N_PROFILE_SCOPE(profile, key, items)                                                \
+        const i18n_check::scoped_profile I18N_PROFILE_SCOPE_NAME(__LINE__)((profile), (key),     \
+                                                                           (items))
+#else
+    #define I18N_PROFILE_SCOPE(profile, key, items) static_cast<void>(0)
+#endif
+
+/** @brief Times an expression (usually a check's condition), adding the time to a
+        check in a check_profile.
+    @details This compiles to just the expression unless @c QUNEIFORM_PROFILING is defined.
+    @param profile A pointer to the check_profile (can be null).
+    @param key The @c review_style flag to add the time to.
+    @param expression The expression to evaluate (which examines one string).*/
+#ifdef QUNEIFORM_PROFILING
+    #define I18N_PROFILED(profile, key, expression)                                               \
+        i18n_check::profile_expression((profile), (key), [&]() { return (expression); })
+#else
+    #define I18N_PROFILED(profile, key, expression) (expression)
+#endif
+
+namespace i18n_check
+    {
+    /// @brief The phases of an analysis.
+    enum class profile_phase
+        {
+        /// @brief Reading files and decoding them.
+        read_decode,
+        /// @brief Scanning each file for strings (and per-file checks).
+        scan,
+        /// @brief Reviewing the strings from all files.
+        review,
+        /// @brief Formatting the results.
+        format,
+        /// @private
+        phase_count
+        };
+
+    /// @brief The wall time, number of calls, and number of items
+    ///     (e.g., strings) examined for a check or phase.
+    struct profile_counter
+        {
+        /// @brief Adds a call to the counter.
+        /// @param elapsed The call's wall time.
+        /// @param items The number of items examined.
+        void add(const std::chrono::nanoseconds elapsed, const uint64_t items) noexcept
+            {
+            m_nanoseconds.fetch_add(static_cast<uint64_t>(elapsed.count()),
+                                    std::memory_order_relaxed);
+            m_calls.fetch_add(1, std::memory_order_relaxed);
+            m_items.fetch_add(items, std::memory_order_relaxed);
+            }
+
+        std::atomic<uint64_t> m_nanoseconds{ 0 };
+        std::atomic<uint64_t> m_calls{ 0 };
+        std::atomic<uint64_t> m_items{ 0 };
+        };
+
+    /** @brief Per-check and per-phase timings, used to find which checks are slow
+            for a given set of files.
+        @details Counters are atomic, so a profile can be shared by analyzers that are
+            running on different threads.\n
+            Checks that share a scanner (e.g., the ID assignment checks) are recorded under
+            the first of their flags that is enabled.
+        @sa I18N_PROFILE_SCOPE, I18N_PROFILED.*/
+    class check_profile
+        {
+      public:
+        /// @returns @c true if this build includes the profiling instrumentation
+        ///     (i.e., was built with @c QUNEIFORM_PROFILING defined).
+        [[nodiscard]]
+        constexpr static bool is_available() noexcept
+            {
+#ifdef QUNEIFORM_PROFILING
+            return true;
+#else
+            return false;
+#endif
+            }
+
+        /// @returns The counter for a check.
+        /// @param check The @c review_style flag (if multiple flags are set,
+        ///     then the lowest is used).
+        [[nodiscard]]
+        profile_counter& get_counter(const int64_t check) noexcept;
+
+        /// @returns The counter for a phase.
+        /// @param phase The phase.
+        [[nodiscard]]
+        profile_counter& get_counter(const profile_phase phase) noexcept
+            {
+            return m_phases[static_cast<size_t>(phase)];
+            }
+
+        /// @brief Adds the scratch memory that was used while reviewing a file.
+        /// @param allocations The number of allocations served by the file's scratch arena.
+        /// @param heapAllocations The number of those allocations that had to go to the heap.
+        void add_scratch_usage(const uint64_t allocations, const uint64_t heapAllocations) noexcept
+            {
+            m_scratch_files.fetch_add(1, std::memory_order_relaxed);
+            m_scratch_allocations.fetch_add(allocations, std::memory_order_relaxed);
+            m_scratch_heap_allocations.fetch_add(heapAllocations, std::memory_order_relaxed);
+            }
+
+        /// @returns The number of allocations served by scratch arenas.
+        [[nodiscard]]
+        uint64_t get_scratch_allocations() const noexcept
+            {
+            return m_scratch_allocations.load(std::memory_order_relaxed);
+            }
+
+        /// @returns The number of scratch allocations that had to go to the heap.
+        [[nodiscard]]
+        uint64_t get_scratch_heap_allocations() const noexcept
+            {
+            return m_scratch_heap_allocations.load(std::memory_order_relaxed);
+            }
+
+        /// @brief Resets all counters.
+        void clear() noexcept;
+
+        /// @returns The counters formatted as a table, with the checks sorted by time.
+        [[nodiscard]]
+        std::wstring format_table() const;
+
+        /// @returns The counters formatted as JSON.
+        [[nodiscard]]
+        std::string format_json() const;
+
+      private:
+        std::array<profile_counter, 64> m_checks;
+        std::array<profile_counter, static_cast<size_t>(profile_phase::phase_count)> m_phases;
+        std::atomic<uint64_t> m_scratch_files{ 0 };
+        std::atomic<uint64_t> m_scratch_allocations{ 0 };
+        std::atomic<uint64_t> m_scratch_heap_allocations{ 0 };
+        };
+
+    /// @brief Adds the time spent in a scope to a check_profile.
+    /// @details Use the I18N_PROFILE_SCOPE() macro, rather than this directly.
+    class scoped_profile
+        {
+      public:
+        /// @brief Constructor, which starts the timer (if @c profile is not null).
+        /// @param profile The profile to add to.
+        /// @param key The @c review_style flag (or @c profile_phase) to add to.
+        /// @param items The number of items being examined.
+        template<typename KeyT>
+        scoped_profile(check_profile* profile, const KeyT key, const size_t items) noexcept
+            : m_counter((profile != nullptr) ? &profile->get_counter(key) : nullptr),
+              m_items(items)
+            {
+            if (m_counter != nullptr)
+                {
+                m_start = std::chrono::steady_clock::now();
+                }
+            }
+
+        /// @private
+        scoped_profile(const scoped_profile&) = delete;
+        /// @private
+        scoped_profile& operator=(const scoped_profile&) = delete;
+
+        /// @private
+        ~scoped_profile()
+            {
+            if (m_counter != nullptr)
+                {
+                m_counter->add(std::chrono::steady_clock::now() - m_start, m_items);
+                }
+            }
+
+      private:
+        profile_counter* m_counter{ nullptr };
+        size_t m_items{ 0 };
+        std::chrono::steady_clock::time_point m_start;
+        };
+
+    /// @returns The result of a function, with its time added to a check_profile.
+    /// @details Use the I18N_PROFILED() macro, rather than this directly.
+    template<typename KeyT, typename FunctionT>
+    [[nodiscard]]
+    inline auto profile_expression(check_profile* profile, const KeyT key, FunctionT&& func)
+        {
+        const scoped_profile scope{ profile, key, 1 };
+        return func();
+        }
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__CHECK_PROFILE_H__
@@ -0,0 +1,82 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "classification_cache.h"
+#include <mutex>
+
+namespace i18n_check
+    {
+    //--------------------------------------------------
+    std::optional<std::pair<bool, size_t>>
+    classification_cache::find(const std::wstring_view str, const string_verdict verdict)
+        {
+        const auto verdictIndex{ static_cast<size_t>(verdict) };
+            {
+            const std::shared_lock<std::shared_mutex> lock(m_mutex);
+            const auto classification = m_classifications.find(str);
+            if (classification != m_classifications.cend() &&
+                classification->second.m_known.test(verdictIndex))
+                {
+                m_hits.fetch_add(1, std::memory_order_relaxed);
+                return std::make_pair(
+                    classification->second.m_verdicts.test(verdictIndex),
+                    (verdict == string_verdict::untranslatable_limit_word_count) ?
+                        classification->second.m_translatable_length_limit_word_count :
+                        classification->second.m_translatable_length);
+                }
+            }
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+        }
+
+    //--------------------------------------------------
+    void classification_cache::store(const std::wstring_view str, const string_verdict verdict,
+                                     const bool result, const size_t translatableLength)
+        {
+        const auto verdictIndex{ static_cast<size_t>(verdict) };
+        const std::unique_lock<std::shared_mutex> lock(m_mutex);
+        auto classification = m_classifications.find(str);
+        if (classification == m_classifications.end())
+            {
+            classification =
+                m_classifications.try_emplace(std::wstring{ str }, string_classification{})
+                    .first;
+            }
+        classification->second.m_known.set(verdictIndex);
+        classification->second.m_verdicts.set(verdictIndex, result);
+        if (verdict == string_verdict::untranslatable_limit_word_count)
+            {
+            classification->second.m_translatable_length_limit_word_count = translatableLength;
+            }
+        else if (verdict == string_verdict::untranslatable)
+            {
+            classification->second.m_translatable_length = translatableLength;
+            }
+        }
+
+    //--------------------------------------------------
+    size_t classification_cache::size() const
+        {
+        const std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return m_classifications.size();
+        }
+
+    //--------------------------------------------------
+    void classification_cache::clear()
+        {
+        const std::unique_lock<std::shared_mutex> lock(m_mutex);
+        m_classifications.clear();
+        m_hits = 0;
+        m_misses = 0;
+        }
+    } // namespace i18n_check
@@ -0,0 +1,182 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __CLASSIFICATION_CACHE_H__
+#define __CLASSIFICATION_CACHE_H__
+
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace i18n_check
+    {
+    /// @brief The verdicts about a string's content that can be cached.
+    enum class string_verdict
+        {
+        /// @brief Whether the string should probably not be translated
+        ///     (see i18n_review::is_untranslatable_string()).
+        untranslatable,
+        /// @brief The same as @c untranslatable, but also considering the string's word count.
+        untranslatable_limit_word_count,
+        /// @brief Whether the string is ambiguous and needs context.
+        ambiguous,
+        /// @brief Whether the string is made up of multiple parts.
+        multipart,
+        /// @brief Whether the string uses a "(s)" to fake a plural.
+        faux_plural,
+        /// @brief Whether the string contains a URL, email address, or phone number.
+        url,
+        /// @private
+        verdict_count
+        };
+
+    /** @brief Remembers the verdicts about strings' content, so that strings which appear
+            many times (e.g., "OK" or "Cancel") are only classified once.
+        @details The verdicts are keyed by the string's content, so they are only valid for
+            the settings that they were classified with; use a new cache (or clear() it)
+            when the settings change.\n
+            Each verdict is classified the first time that it is asked for, so verdicts
+            for checks that are not enabled are never computed.
+        @note This is thread safe, so it can be shared by analyzers that are running on
+            different threads. If two threads classify the same string at the same time,
+            then it is classified twice (but with the same results).
+        @par Example:
+        @code
+         i18n_check::classification_cache cache;
+         const bool isAmbiguous = cache.classify(str, string_verdict::ambiguous,
+            [&str]() { return i18n_review::is_string_ambiguous(str); });
+        @endcode*/
+    class classification_cache
+        {
+      public:
+        /** @returns A verdict about a string, classifying it if needed.
+            @param str The string.
+            @param verdict The verdict to look up.
+            @param classifier The function to classify the string with if it hasn't been yet,
+                which returns the verdict.*/
+        template<typename FunctionT>
+        [[nodiscard]]
+        bool classify(const std::wstring_view str, const string_verdict verdict,
+                      FunctionT&& classifier)
+            {
+            if (const auto cachedVerdict = find(str, verdict))
+                {
+                return cachedVerdict->first;
+                }
+            const bool result{ std::invoke(std::forward<FunctionT>(classifier)) };
+            store(str, verdict, result, 0);
+            return result;
+            }
+
+        /** @returns Whether a string should probably not be translated and the length of its
+                translatable content, classifying it if needed.
+            @param str The string.
+            @param limitWordCount Which of the untranslatable verdicts to look up
+                (see i18n_review::is_untranslatable_string()).
+            @param classifier The function to classify the string with if it hasn't been yet,
+                which returns the verdict and the translatable content length.*/
+        template<typename FunctionT>
+        [[nodiscard]]
+        std::pair<bool, size_t> classify_untranslatable(const std::wstring_view str,
+                                                        const bool limitWordCount,
+                                                        FunctionT&& classifier)
+            {
+            const string_verdict verdict{ limitWordCount ?
+                                              string_verdict::untranslatable_limit_word_count :
+                                              string_verdict::untranslatable };
+            if (const auto cachedVerdict = find(str, verdict))
+                {
+                return cachedVerdict.value();
+                }
+            const std::pair<bool, size_t> result{ std::invoke(
+                std::forward<FunctionT>(classifier)) };
+            store(str, verdict, result.first, result.second);
+            return result;
+            }
+
+        /// @returns The number of unique strings that have been classified.
+        [[nodiscard]]
+        size_t size() const;
+
+        /// @returns The number of verdicts that were looked up without
+        ///     needing to classify the string.
+        [[nodiscard]]
+        uint64_t get_hit_count() const noexcept
+            {
+            return m_hits.load(std::memory_order_relaxed);
+            }
+
+        /// @returns The number of verdicts that needed the string to be classified.
+        [[nodiscard]]
+        uint64_t get_miss_count() const noexcept
+            {
+            return m_misses.load(std::memory_order_relaxed);
+            }
+
+        /// @brief Removes all verdicts.
+        void clear();
+
+      private:
+        /// @brief The verdicts about a string.
+        struct string_classification
+            {
+            // which verdicts have been classified
+            std::bitset<static_cast<size_t>(string_verdict::verdict_count)> m_known;
+            std::bitset<static_cast<size_t>(string_verdict::verdict_count)> m_verdicts;
+            // the length of the translatable content (for the untranslatable verdicts)
+            size_t m_translatable_length{ 0 };
+            size_t m_translatable_length_limit_word_count{ 0 };
+            };
+
+        /// @brief Hashes strings and string views the same way, so that the map can be
+        ///     searched without copying the string being looked up.
+        struct string_hash
+            {
+            using is_transparent = void;
+
+            [[nodiscard]]
+            size_t operator()(const std::wstring_view str) const noexcept
+                {
+                return std::hash<std::wstring_view>{}(str);
+                }
+            };
+
+        [[nodiscard]]
+        std::optional<std::pair<bool, size_t>> find(const std::wstring_view str,
+                                                    const string_verdict verdict);
+
+        void store(const std::wstring_view str, const string_verdict verdict, const bool result,
+                   const size_t translatableLength);
+
+        mutable std::shared_mutex m_mutex;
+        std::unordered_map<std::wstring, string_classification, string_hash, std::equal_to<>>
+            m_classifications;
+        std::atomic<uint64_t> m_hits{ 0 };
+        std::atomic<uint64_t> m_misses{ 0 };
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__CLASSIFICATION_CACHE_H__
@@ -12,27 +12,62 @@
  ********************************************************************************/
 
 #include "cpp_i18n_review.h"
+#include "structural_index.h"
 
 namespace i18n_check
     {
     //--------------------------------------------------
     void cpp_i18n_review::operator()(std::wstring_view srcText,
                                      const std::filesystem::path& fileName)
+        {
+            {
+            // the parser blanks out comments and such as it goes, so it needs its own copy
+            std::pmr::wstring cppBuffer{ srcText, m_scratch.get_resource() };
+            review_text(cppBuffer, fileName);
+            }
+        release_scratch();
+        }
+
+    //--------------------------------------------------
+    void cpp_i18n_review::review_buffer(std::wstring& cppBuffer,
+                                        const std::filesystem::path& fileName)
+        {
+        review_text(cppBuffer, fileName);
+        release_scratch();
+        }
+
+    //--------------------------------------------------
+    void cpp_i18n_review::review_text(std::span<wchar_t> cppBuffer,
+                                      const std::filesystem::path& fileName)
         {
         m_file_name = fileName;
         m_file_start = nullptr;
+        m_line_index.clear();
+        load_file_changed_lines();
 
-        if (srcText.empty())
+        if (cppBuffer.empty())
             {
             return;
             }
 
-        std::wstring cppBuffer{ srcText };
         wchar_t* cppText = cppBuffer.data();
+        const std::wstring_view fileText{ cppBuffer.data(), cppBuffer.size() };
 
         m_file_start = cppText;
+        m_line_index.index(fileText);
         const wchar_t* const endSentinel =
-            std::next(cppText, static_cast<ptrdiff_t>(srcText.length()));
+            std::next(cppText, static_cast<ptrdiff_t>(cppBuffer.size()));
+        // Where the characters that the loop below acts on are, so that it can step over
+        // everything else. (Assembly blocks start with "a" or "_", and a null ends the text.)
+        // The text is only blanked out as it is reviewed, so the index stays valid.
+        const structural_index structuralChars{ fileText,
+                                                std::wstring_view{ L"/#\"\t\n\r;a_\0", 10 },
+                                                m_scratch.get_resource() };
+
+        // reused for each string, so that their memory is only allocated once per file
+        std::pmr::wstring functionName{ m_scratch.get_resource() };
+        variable_info variableInfo{ m_scratch.get_resource() };
+        std::pmr::wstring deprecatedMacroEncountered{ m_scratch.get_resource() };
 
         while (cppText != nullptr && std::next(cppText) < endSentinel && *cppText != 0)
             {
@@ -69,8 +104,9 @@ namespace i18n_check
                             cppText, std::next(cppText, static_cast<ptrdiff_t>(suppresionEnd + 2)));
                         std::advance(cppText, suppresionEnd);
                         }
-                    wchar_t* end = std::wcsstr(cppText, L"*/");
-                    if (end != nullptr && end < endSentinel)
+                    wchar_t* end = string_util::find_in_range(cppText, endSentinel,
+                                                              std::wstring_view{ L"*/" });
+                    if (end != nullptr)
                         {
                         clear_section(cppText, std::next(end, 2));
                         cppText = std::next(end, 2);
@@ -93,12 +129,8 @@ namespace i18n_check
                     // if we have a translator comment to connect to it
                     if (m_context_comment_active && !isQtTransComment)
                         {
-                        const wchar_t* openingParen = std::wcschr(cppText, L'(');
-                        if (openingParen != nullptr && openingParen < endSentinel)
-                            {
-                            m_context_comment_active = is_i18n_function(
-                                { cppText, static_cast<size_t>(openingParen - cppText) });
-                            }
+                        m_context_comment_active =
+                            is_i18n_function(read_called_function_name(cppText, endSentinel));
                         }
                     else if (isQtTransComment)
                         {
@@ -131,19 +163,20 @@ namespace i18n_check
                         std::next(cppText, 2) < endSentinel &&
                         static_cast<bool>(std::iswalnum(*std::next(cppText, 2))) &&
                         // something like "//--------" is OK
-                        *std::next(cppText, 2) != L'-')
+                        *std::next(cppText, 2) != L'-' && is_changed_line(cppText - m_file_start))
                         {
-                        m_comments_missing_space.push_back(
+                        add_result(
+                            result_category::comments_missing_space,
                             string_info(std::wstring{}, string_info::usage_info{}, m_file_name,
                                         get_line_and_column((cppText - m_file_start))));
                         }
                     // move to the end of the line
-                    if (const size_t endOfLine = std::wcscspn(cppText, L"\n\r");
-                        std::next(cppText, static_cast<ptrdiff_t>(endOfLine)) < endSentinel)
+                    if (wchar_t* endOfLine = string_util::find_first_of_in_range(
+                            cppText, endSentinel, std::wstring_view{ L"\n\r" });
+                        endOfLine != nullptr)
                         {
-                        clear_section(cppText,
-                                      std::next(cppText, static_cast<ptrdiff_t>(endOfLine)));
-                        std::advance(cppText, endOfLine);
+                        clear_section(cppText, endOfLine);
+                        cppText = endOfLine;
                         }
                     // move to next character
                     while (std::next(cppText) < endSentinel && std::iswspace(*cppText))
@@ -163,31 +196,29 @@ namespace i18n_check
                                 std::next(cppText, 2) < endSentinel &&
                                 static_cast<bool>(std::iswalnum(*std::next(cppText, 2))) &&
                                 // something like "//--------" is OK
-                                *std::next(cppText, 2) != L'-')
+                                *std::next(cppText, 2) != L'-' &&
+                                is_changed_line(cppText - m_file_start))
                                 {
-                                m_comments_missing_space.push_back(string_info(
+                                add_result(
+                                    result_category::comments_missing_space,
                                     std::wstring{}, string_info::usage_info{}, m_file_name,
-                                    get_line_and_column((cppText - m_file_start))));
+                                    get_line_and_column((cppText - m_file_start)));
                                 }
                             // move to the end of the line
-                            if (const size_t endOfLine = std::wcscspn(cppText, L"\n\r");
-                                std::next(cppText, static_cast<ptrdiff_t>(endOfLine)) < endSentinel)
+                            if (wchar_t* endOfLine = string_util::find_first_of_in_range(
+                                    cppText, endSentinel, std::wstring_view{ L"\n\r" });
+                                endOfLine != nullptr)
                                 {
-                                clear_section(
-                                    cppText, std::next(cppText, static_cast<ptrdiff_t>(endOfLine)));
-                                std::advance(cppText, endOfLine);
+                                clear_section(cppText, endOfLine);
+                                cppText = endOfLine;
                                 }
                             while (std::next(cppText) < endSentinel && std::iswspace(*cppText))
                                 {
                                 std::advance(cppText, 1);
                                 }
                             }
-                        const wchar_t* openingParen = std::wcschr(cppText, L'(');
-                        if (openingParen != nullptr && openingParen < endSentinel)
-                            {
-                            m_context_comment_active = is_i18n_function(
-                                { cppText, static_cast<size_t>(openingParen - cppText) });
-                            }
+                        m_context_comment_active =
+                            is_i18n_function(read_called_function_name(cppText, endSentinel));
                         }
                     else if (isQtTransComment)
                         {
@@ -209,7 +240,8 @@ namespace i18n_check
                     }
                 }
             else if (((cppText == m_file_start) || !is_valid_name_char(*std::prev(cppText))) &&
-                     is_assembly_block(cppText))
+                     is_assembly_block(
+                         { cppText, static_cast<size_t>(endSentinel - cppText) }))
                 {
                 cppText = process_assembly_block(cppText);
                 if (cppText == nullptr || cppText >= endSentinel)
@@ -236,9 +268,9 @@ namespace i18n_check
                     }
                 // see if this string is in a function call or is a direct variable assignment
                 // and gauge whether it is meant to be translatable or not
-                std::wstring functionName;
-                variable_info variableInfo;
-                std::wstring deprecatedMacroEncountered;
+                functionName.clear();
+                variableInfo.reset();
+                deprecatedMacroEncountered.clear();
                 size_t parameterPosition{ 0 };
                 const wchar_t* startPos = std::prev(cppText, 1);
                 const wchar_t* functionVarNamePos{ nullptr };
@@ -305,7 +337,7 @@ namespace i18n_check
                     {
                     while (end != nullptr && end < endSentinel)
                         {
-                        end = std::wcschr(end, L'\"');
+                        end = string_util::find_in_range(end, endSentinel, L'\"');
                         if (end != nullptr)
                             {
                             // Watch out for escaped quotes.
@@ -354,15 +386,12 @@ namespace i18n_check
                                 *std::next(connectedQuote) == L'/')
                                 {
                                 // move to the end of the line
-                                if (const size_t endOfLine = std::wcscspn(connectedQuote, L"\n\r");
-                                    std::next(connectedQuote, static_cast<ptrdiff_t>(endOfLine)) <
-                                    endSentinel)
+                                if (wchar_t* endOfLine = string_util::find_first_of_in_range(
+                                        connectedQuote, endSentinel, std::wstring_view{ L"\n\r" });
+                                    endOfLine != nullptr)
                                     {
-                                    clear_section(
-                                        connectedQuote,
-                                                  std::next(connectedQuote,
-                                                            static_cast<ptrdiff_t>(endOfLine)));
-                                    std::advance(connectedQuote, endOfLine);
+                                    clear_section(connectedQuote, endOfLine);
+                                    connectedQuote = endOfLine;
                                     while (connectedQuote < endSentinel &&
                                            static_cast<bool>(std::iswspace(*connectedQuote)))
                                         {
@@ -374,8 +403,9 @@ namespace i18n_check
                                      *connectedQuote == L'/' && *std::next(connectedQuote) == L'*')
                                 {
                                 // move to the end of the line
-                                wchar_t* endOfLine = std::wcsstr(connectedQuote, L"*/");
-                                if (endOfLine != nullptr && endOfLine < endSentinel)
+                                wchar_t* endOfLine = string_util::find_in_range(
+                                    connectedQuote, endSentinel, std::wstring_view{ L"*/" });
+                                if (endOfLine != nullptr)
                                     {
                                     clear_section(connectedQuote, std::next(endOfLine, 2));
                                     connectedQuote = std::next(endOfLine, 2);
@@ -401,13 +431,14 @@ namespace i18n_check
                             // step over PRIu64 macro that appears between printf strings
                             // Format macros for the std::fprintf family of functions that may
                             // appear between quoted sections that will actually join the two quotes
-                            const std::wregex intPrintfMacro{
+                            static const std::wregex intPrintfMacro{
                                 LR"(PR[IN][uidoxX](8|16|32|64|FAST8|FAST16|FAST32|FAST64|LEAST8|LEAST16|LEAST32|LEAST64|MAX|PTR))"
                             };
                             constexpr size_t int64PrintfMacroLength{ 6 };
                             if (std::next(connectedQuote, int64PrintfMacroLength) < endSentinel &&
                                 std::regex_match(
-                                    std::wstring{ connectedQuote, int64PrintfMacroLength },
+                                    connectedQuote,
+                                    std::next(connectedQuote, int64PrintfMacroLength),
                                     intPrintfMacro))
                                 {
                                 clear_section(connectedQuote,
@@ -486,19 +517,24 @@ namespace i18n_check
                 }
             else
                 {
-                if (static_cast<bool>(m_review_styles & check_tabs) && *cppText == L'\t')
+                // formatting checks are only done on the changed lines (if reviewing a patch)
+                if (static_cast<bool>(m_review_styles & check_tabs) && *cppText == L'\t' &&
+                    is_changed_line(cppText - m_file_start))
                     {
-                    m_tabs.push_back(string_info(std::wstring{}, string_info::usage_info{},
-                                                 m_file_name,
-                                                 get_line_and_column((cppText - m_file_start))));
+                    add_result(result_category::tabs, std::wstring{}, string_info::usage_info{},
+                               m_file_name, get_line_and_column((cppText - m_file_start)));
                     }
                 else if (static_cast<bool>(m_review_styles & check_trailing_spaces) &&
                          *cppText == L' ' && std::next(cppText) < endSentinel &&
-                         (*std::next(cppText) == L'\n' || *std::next(cppText) == L'\r'))
+                         (*std::next(cppText) == L'\n' || *std::next(cppText) == L'\r') &&
+                         is_changed_line(cppText - m_file_start))
                     {
                     assert(cppText >= m_file_start);
-                    auto prevLineStart = std::wstring_view{ m_file_start }.find_last_of(
-                        L"\n\r", cppText - m_file_start);
+                    // (search back through just the text in front of here, not the whole file)
+                    auto prevLineStart =
+                        std::wstring_view{ m_file_start,
+                                           static_cast<size_t>(cppText - m_file_start) }
+                            .find_last_of(L"\n\r");
                     if (prevLineStart == std::wstring::npos)
                         {
                         prevLineStart = 0;
@@ -509,7 +545,8 @@ namespace i18n_check
                         std::next(m_file_start, static_cast<ptrdiff_t>(prevLineStart)),
                         (cppText - std::next(m_file_start, static_cast<ptrdiff_t>(prevLineStart))));
                     string_util::ltrim(codeLine);
-                    m_trailing_spaces.push_back(
+                    add_result(
+                        result_category::trailing_spaces,
                         string_info(codeLine, string_info::usage_info{}, m_file_name,
                                     get_line_and_column((cppText - m_file_start))));
                     }
@@ -518,13 +555,15 @@ namespace i18n_check
                     {
                     const auto currentPos{ (cppText - m_file_start) };
                     auto previousNewLine =
-                        std::wstring_view{ m_file_start }.find_last_of(L"\n\r", currentPos - 1);
+                        std::wstring_view{ m_file_start, static_cast<size_t>(currentPos) }
+                            .find_last_of(L"\n\r");
                     if (previousNewLine == std::wstring::npos)
                         {
                         previousNewLine = 0;
                         }
                     const size_t currentLineLength{ currentPos - (++previousNewLine) };
-                    if (currentLineLength > m_max_line_length)
+                    if (currentLineLength > m_max_line_length &&
+                        is_changed_line(previousNewLine))
                         {
                         // ...also, only warn if the current line doesn't have a raw
                         // string in it--those can make it complicated to break a line
@@ -537,7 +576,8 @@ namespace i18n_check
                         if (currentLine.find(L"LR") == std::wstring::npos &&
                             currentLine.find(L'|') == std::wstring::npos)
                             {
-                            m_wide_lines.emplace_back(
+                            add_result(
+                                result_category::wide_lines,
                                 // truncate and add ellipsis
                                 std::wstring{ currentLine.substr(
                                                   0, std::min<size_t>(32, currentLine.length())) }
@@ -551,16 +591,19 @@ namespace i18n_check
                             }
                         }
                     }
-                std::advance(cppText, 1);
+                // jump to the next character that one of the checks above is looking for
+                cppText = std::next(cppBuffer.data(),
+                                    static_cast<ptrdiff_t>(structuralChars.find_next(
+                                        static_cast<size_t>(cppText - m_file_start) + 1)));
                 }
             }
 
         // review full content again once comments and preprocessor blocks are cleared
         if (m_wx_info.m_app_init_info.m_file_name.empty())
             {
-            const size_t foundImplAppPos = cppBuffer.find(L"wxIMPLEMENT_APP");
-            const size_t foundPos = cppBuffer.find(L"::OnInit()");
-            if (foundImplAppPos != std::wstring::npos && foundPos != std::wstring::npos)
+            const size_t foundImplAppPos = fileText.find(L"wxIMPLEMENT_APP");
+            const size_t foundPos = fileText.find(L"::OnInit()");
+            if (foundImplAppPos != std::wstring_view::npos && foundPos != std::wstring_view::npos)
                 {
                 m_wx_info.m_app_init_info = string_info{
                     std::wstring{},
@@ -570,25 +613,34 @@ namespace i18n_check
                 };
                 }
             }
-        if (cppBuffer.find(L"wxUILocale::UseDefault()") != std::wstring::npos)
+        if (fileText.find(L"wxUILocale::UseDefault()") != std::wstring_view::npos)
             {
             m_wx_info.m_wxuilocale_initialized = true;
             }
-        if (cppBuffer.find(L"wxLocale") != std::wstring::npos)
+        if (fileText.find(L"wxLocale") != std::wstring_view::npos)
             {
             m_wx_info.m_wxlocale_initialized = true;
             }
 
-        load_id_assignments(cppBuffer, fileName);
-        load_deprecated_functions(cppBuffer, fileName);
-        load_suspect_i18n_ussage(cppBuffer, fileName);
+        if (static_cast<bool>(m_review_styles &
+                              (check_number_assigned_to_id | check_duplicate_value_assigned_to_ids |
+                               check_deprecated_macros | check_suspect_i18n_usage)))
+            {
+            // the checks that look for code constructs share one tokenization of the text
+            // (now that comments and preprocessor blocks are cleared)
+            const token_stream tokens{ fileText, m_scratch.get_resource() };
+            load_id_assignments(tokens, fileName);
+            load_deprecated_functions(tokens, fileName);
+            load_suspect_i18n_ussage(tokens, fileName);
+            }
 
         m_file_name.clear();
         m_file_start = nullptr;
+        m_line_index.clear();
         }
 
     //--------------------------------------------------
-    void cpp_i18n_review::remove_decorations(std::wstring& str) const
+    void cpp_i18n_review::remove_decorations(std::pmr::wstring& str) const
         {
         while (str.length() > 0 && str.back() == L'&')
             {
@@ -731,6 +783,25 @@ namespace i18n_check
         return std::next(asmStart);
         }
 
+    //--------------------------------------------------
+    std::wstring_view cpp_i18n_review::read_called_function_name(const wchar_t* text,
+                                                                 const wchar_t* endSentinel)
+        {
+        const wchar_t* nameEnd{ text };
+        while (nameEnd < endSentinel && is_valid_name_char_ex(*nameEnd))
+            {
+            std::advance(nameEnd, 1);
+            }
+        const wchar_t* openingParen{ nameEnd };
+        while (openingParen < endSentinel && std::iswspace(*openingParen))
+            {
+            std::advance(openingParen, 1);
+            }
+        return (nameEnd > text && openingParen < endSentinel && *openingParen == L'(') ?
+                   std::wstring_view{ text, static_cast<size_t>(nameEnd - text) } :
+                   std::wstring_view{};
+        }
+
     //--------------------------------------------------
     wchar_t* cpp_i18n_review::skip_preprocessor_define_block(wchar_t* directiveStart)
         {
@@ -773,7 +844,7 @@ namespace i18n_check
         };
 
         const std::wstring_view ifndefCommand{ L"ifndef" };
-        if (std::wstring_view{ directiveStart }.starts_with(ifndefCommand))
+        if (std::wcsncmp(directiveStart, ifndefCommand.data(), ifndefCommand.length()) == 0)
             {
             std::advance(directiveStart, ifndefCommand.length());
             while (static_cast<bool>(std::iswspace(*directiveStart)))
@@ -794,7 +865,7 @@ namespace i18n_check
                        nullptr;
             }
         const std::wstring_view ifdefCommand{ L"ifdef" };
-        if (std::wstring_view{ directiveStart }.starts_with(ifdefCommand))
+        if (std::wcsncmp(directiveStart, ifdefCommand.data(), ifdefCommand.length()) == 0)
             {
             std::advance(directiveStart, ifdefCommand.length());
             while (static_cast<bool>(std::iswspace(*directiveStart)))
@@ -811,7 +882,7 @@ namespace i18n_check
             return (std::regex_match(defSymbol, debugRE)) ? findSectionEnd(defSymbolEnd) : nullptr;
             }
         const std::wstring_view ifdefinedCommand{ _DT(L"if defined") };
-        if (std::wstring_view{ directiveStart }.starts_with(ifdefinedCommand))
+        if (std::wcsncmp(directiveStart, ifdefinedCommand.data(), ifdefinedCommand.length()) == 0)
             {
             std::advance(directiveStart, ifdefinedCommand.length());
             while (static_cast<bool>(std::iswspace(*directiveStart)))
@@ -828,7 +899,7 @@ namespace i18n_check
             return (std::regex_match(defSymbol, debugRE)) ? findSectionEnd(defSymbolEnd) : nullptr;
             }
         const std::wstring_view ifCommand{ L"if" };
-        if (std::wstring_view{ directiveStart }.starts_with(ifCommand))
+        if (std::wcsncmp(directiveStart, ifCommand.data(), ifCommand.length()) == 0)
             {
             std::advance(directiveStart, ifCommand.length());
             while (static_cast<bool>(std::iswspace(*directiveStart)))
@@ -877,7 +948,14 @@ namespace i18n_check
             }
 
         // skip directives
-        const std::wstring_view directive{ directiveStart };
+        // (just the directive's name, so that the rest of the file isn't measured)
+        const wchar_t* directiveNameEnd{ directiveStart };
+        while (is_valid_name_char(*directiveNameEnd))
+            {
+            std::advance(directiveNameEnd, 1);
+            }
+        const std::wstring_view directive{ directiveStart,
+                                           static_cast<size_t>(directiveNameEnd - directiveStart) };
         if (directive.starts_with(L"include") || directive.starts_with(L"if") ||
             directive.starts_with(L"ifdef") || directive.starts_with(L"ifndef") ||
             directive.starts_with(L"else") || directive.starts_with(L"elif") ||
@@ -921,7 +999,7 @@ namespace i18n_check
             // special parsing logic for #define sections
             // (try to review strings in here as best we can)
             const std::wstring_view defineCommand{ L"define" };
-            if (std::wstring_view{ directiveStart }.starts_with(defineCommand))
+            if (std::wcsncmp(directiveStart, defineCommand.data(), defineCommand.length()) == 0)
                 {
                 std::advance(directiveStart, defineCommand.length());
                 while (*directiveStart != 0 && string_util::is_either(*directiveStart, L' ', L'\t'))
@@ -958,9 +1036,9 @@ namespace i18n_check
                     std::advance(endOfPossibleFuncName, 1);
                     }
                 if (*endOfPossibleFuncName == L'(' && *directiveStart != 0 &&
-                    m_ctors_to_ignore.find(
-                        std::wstring(directiveStart, endOfPossibleFuncName - directiveStart)) !=
-                        m_ctors_to_ignore.cend())
+                    m_rules->m_ctors_to_ignore.contains(std::wstring_view{
+                        directiveStart,
+                        static_cast<size_t>(endOfPossibleFuncName - directiveStart) }))
                     {
                     directiveStart = std::next(endOfPossibleFuncName);
                     }
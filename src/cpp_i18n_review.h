@@ -42,10 +42,29 @@ namespace i18n_check
             @param fileName The (optional) name of source file being analyzed.*/
         void operator()(std::wstring_view srcText, const std::filesystem::path& fileName) final;
 
+        /** @brief Extracts resource text from C++ source code, parsing it in place.
+            @param cppBuffer The C++ code text to extract text from.\n
+                Comments and other sections that have been reviewed are blanked out while
+                it is parsed, so its content should not be relied upon afterwards.
+            @param fileName The (optional) name of source file being analyzed.*/
+        void review_buffer(std::wstring& cppBuffer, const std::filesystem::path& fileName) final;
+
+        /// @returns A copy of the analyzer's settings (without any results).
+        [[nodiscard]]
+        std::unique_ptr<i18n_review> clone() const override
+            {
+            return clone_settings(*this);
+            }
+
       private:
+        /// @brief Extracts resource text from C++ source code, parsing it in place.
+        /// @param cppBuffer The C++ code text to extract text from.
+        /// @param fileName The (optional) name of source file being analyzed.
+        void review_text(std::span<wchar_t> cppBuffer, const std::filesystem::path& fileName);
+
         /// @brief Strips off the trailing template and global accessor (i.e., "::")
         ///     information from a function/variable.
-        void remove_decorations(std::wstring& str) const override;
+        void remove_decorations(std::pmr::wstring& str) const override;
 
         /// @returns @c true if provided variable type is just a decorator after the real
         ///     variable type (e.g., const) and should be skipped.
@@ -108,6 +127,16 @@ namespace i18n_check
         [[nodiscard]]
         static wchar_t* skip_preprocessor_define_block(wchar_t* directiveStart);
 
+        /// @returns The name of the function called at @c text (e.g., "_" from `_("Text")`),
+        ///     or an empty string if @c text is not a function call.
+        /// @param text The start of the text, which should be the start of the function name.
+        /// @param endSentinel The end of the text.
+        /// @note Only the name (and any whitespace after it) is read, so this does not
+        ///     scan ahead through the rest of the text looking for a parenthesis.
+        [[nodiscard]]
+        static std::wstring_view read_called_function_name(const wchar_t* text,
+                                                           const wchar_t* endSentinel);
+
         /// @brief Parses and processes an inline assembly block.
         /// @param asmStart The start of the asm section.
         /// @returns The end of the current asm block.
@@ -16,7 +16,7 @@
 namespace i18n_check
     {
     //--------------------------------------------------
-    void csharp_i18n_review::remove_decorations(std::wstring& str) const
+    void csharp_i18n_review::remove_decorations(std::pmr::wstring& str) const
         {
         // get rid of any leading accessors (e.g., '>' (from "->") or '.').
         if (str.length() > 0 && (str.front() == L':' || str.front() == L'>' || str.front() == L'.'))
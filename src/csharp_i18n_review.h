@@ -34,8 +34,15 @@ namespace i18n_check
             m_collapse_double_quotes = true;
             }
 
+        /// @returns A copy of the analyzer's settings (without any results).
+        [[nodiscard]]
+        std::unique_ptr<i18n_review> clone() const final
+            {
+            return clone_settings(*this);
+            }
+
       private:
-        void remove_decorations(std::wstring& str) const final;
+        void remove_decorations(std::pmr::wstring& str) const final;
 
         /// @returns The end of a raw string.
         /// @param text The current string to parse.
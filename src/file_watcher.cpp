@@ -0,0 +1,239 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "file_watcher.h"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#ifdef __linux__
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+namespace i18n_check
+    {
+#ifdef __linux__
+    //------------------------------------------------------
+    file_watcher::file_watcher(const std::filesystem::path& folder)
+        : m_handle(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+        {
+        if (m_handle < 0)
+            {
+            throw std::runtime_error(std::string{ "Unable to watch folder: " } +
+                                     std::strerror(errno));
+            }
+        add_watch(folder, nullptr);
+        if (m_watched_folders.empty())
+            {
+            close(m_handle);
+            throw std::runtime_error("Unable to watch folder: " + folder.string());
+            }
+        }
+
+    //------------------------------------------------------
+    file_watcher::~file_watcher()
+        {
+        if (m_handle >= 0)
+            {
+            close(m_handle);
+            }
+        }
+
+    //------------------------------------------------------
+    void file_watcher::add_watch(const std::filesystem::path& folder,
+                                 std::vector<std::filesystem::path>* changedFiles)
+        {
+        constexpr uint32_t WATCH_EVENTS{ IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM |
+                                         IN_MOVED_TO | IN_DONT_FOLLOW | IN_ONLYDIR };
+        const int watchDescriptor{ inotify_add_watch(m_handle, folder.c_str(), WATCH_EVENTS) };
+        if (watchDescriptor < 0)
+            {
+            return;
+            }
+        m_watched_folders.insert_or_assign(watchDescriptor, folder);
+
+        std::error_code ec;
+        for (std::filesystem::directory_iterator folderIter(folder, ec), endIter;
+             !ec && folderIter != endIter; folderIter.increment(ec))
+            {
+            if (folderIter->is_directory(ec) && !folderIter->is_symlink(ec))
+                {
+                add_watch(folderIter->path(), changedFiles);
+                }
+            else if (changedFiles != nullptr && folderIter->is_regular_file(ec))
+                {
+                changedFiles->push_back(folderIter->path());
+                }
+            }
+        }
+
+    //------------------------------------------------------
+    void file_watcher::remove_watches(const std::filesystem::path& folder)
+        {
+        std::erase_if(m_watched_folders,
+                      [this, &folder](const auto& watchedFolder)
+                      {
+                          const auto [folderEnd, watchedEnd] = std::mismatch(
+                              folder.begin(), folder.end(), watchedFolder.second.begin(),
+                              watchedFolder.second.end());
+                          if (folderEnd != folder.end())
+                              {
+                              return false;
+                              }
+                          inotify_rm_watch(m_handle, watchedFolder.first);
+                          return true;
+                      });
+        }
+
+    //------------------------------------------------------
+    void file_watcher::read_changes(std::vector<std::filesystem::path>& changedFiles)
+        {
+        alignas(inotify_event) std::array<char, 64 * 1'024> buffer{};
+        while (true)
+            {
+            const ssize_t bytesRead{ read(m_handle, buffer.data(), buffer.size()) };
+            if (bytesRead < 0)
+                {
+                if (errno == EAGAIN || errno == EINTR)
+                    {
+                    return;
+                    }
+                throw std::runtime_error(std::string{ "Unable to read folder changes: " } +
+                                         std::strerror(errno));
+                }
+
+            for (ssize_t offset = 0; offset < bytesRead;)
+                {
+                const auto* event = reinterpret_cast<const inotify_event*>(
+                    std::next(buffer.data(), static_cast<ptrdiff_t>(offset)));
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+                const auto folder = m_watched_folders.find(event->wd);
+                if (folder == m_watched_folders.cend())
+                    {
+                    continue;
+                    }
+                // the folder was deleted (or is no longer on a mounted filesystem)
+                if (static_cast<bool>(event->mask & IN_IGNORED))
+                    {
+                    m_watched_folders.erase(folder);
+                    continue;
+                    }
+                if (event->len == 0)
+                    {
+                    continue;
+                    }
+
+                const std::filesystem::path changedPath{ folder->second / event->name };
+                if (static_cast<bool>(event->mask & IN_ISDIR))
+                    {
+                    // new folders need to be watched too, and the files already in them
+                    // (e.g., from being moved here) count as changed
+                    if (static_cast<bool>(event->mask & (IN_CREATE | IN_MOVED_TO)))
+                        {
+                        add_watch(changedPath, &changedFiles);
+                        }
+                    // the files that were in a removed folder can't be listed anymore,
+                    // so the folder itself is reported
+                    else if (static_cast<bool>(event->mask & (IN_DELETE | IN_MOVED_FROM)))
+                        {
+                        remove_watches(changedPath);
+                        changedFiles.push_back(changedPath);
+                        }
+                    }
+                else
+                    {
+                    changedFiles.push_back(changedPath);
+                    }
+                }
+            }
+        }
+
+    //------------------------------------------------------
+    std::vector<std::filesystem::path>
+    file_watcher::wait_for_changes(const std::chrono::milliseconds settleTime)
+        {
+        std::vector<std::filesystem::path> changedFiles;
+        pollfd pollInfo{ m_handle, POLLIN, 0 };
+        // wait (indefinitely) for the first change, then keep collecting changes until
+        // they settle down
+        int timeout{ -1 };
+        while (true)
+            {
+            const int pollResult{ poll(&pollInfo, 1, timeout) };
+            if (pollResult < 0)
+                {
+                if (errno == EINTR)
+                    {
+                    continue;
+                    }
+                throw std::runtime_error(std::string{ "Unable to read folder changes: " } +
+                                         std::strerror(errno));
+                }
+            if (pollResult == 0)
+                {
+                if (!changedFiles.empty())
+                    {
+                    break;
+                    }
+                // nothing that was changed was a file (e.g., an empty folder was created)
+                timeout = -1;
+                continue;
+                }
+            read_changes(changedFiles);
+            timeout = static_cast<int>(settleTime.count());
+            }
+
+        std::sort(changedFiles.begin(), changedFiles.end());
+        changedFiles.erase(std::unique(changedFiles.begin(), changedFiles.end()),
+                           changedFiles.end());
+        return changedFiles;
+        }
+#else
+    //------------------------------------------------------
+    file_watcher::file_watcher([[maybe_unused]] const std::filesystem::path& folder)
+        {
+        throw std::runtime_error("Watching folders is only supported on Linux.");
+        }
+
+    //------------------------------------------------------
+    file_watcher::~file_watcher() = default;
+
+    //------------------------------------------------------
+    void file_watcher::add_watch([[maybe_unused]] const std::filesystem::path& folder,
+                                 [[maybe_unused]] std::vector<std::filesystem::path>* changedFiles)
+        {
+        }
+
+    //------------------------------------------------------
+    void file_watcher::remove_watches([[maybe_unused]] const std::filesystem::path& folder) {}
+
+    //------------------------------------------------------
+    void
+    file_watcher::read_changes([[maybe_unused]] std::vector<std::filesystem::path>& changedFiles)
+        {
+        }
+
+    //------------------------------------------------------
+    std::vector<std::filesystem::path>
+    file_watcher::wait_for_changes([[maybe_unused]] const std::chrono::milliseconds settleTime)
+        {
+        return {};
+        }
+#endif
+    } // namespace i18n_check
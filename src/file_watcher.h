@@ -0,0 +1,101 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __FILE_WATCHER_H__
+#define __FILE_WATCHER_H__
+
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <vector>
+
+namespace i18n_check
+    {
+    /** @brief Watches a folder (and its subfolders) for files being changed.
+        @details This uses inotify, so it is only available on Linux.\n
+            Folders created after the watcher are watched as they appear,
+            and the files inside of them are reported as changed.
+        @par Example:
+        @code
+         i18n_check::file_watcher watcher(L"/home/user/src");
+         while (true)
+            {
+            const auto changedFiles = watcher.wait_for_changes(std::chrono::milliseconds{ 100 });
+            // re-analyze the changed files...
+            }
+        @endcode*/
+    class file_watcher
+        {
+      public:
+        /// @brief Constructor, which starts watching a folder.
+        /// @param folder The folder to watch.
+        /// @throws std::runtime_error If the folder can't be watched
+        ///     (or watching isn't supported on this system).
+        explicit file_watcher(const std::filesystem::path& folder);
+        /// @private
+        file_watcher(const file_watcher&) = delete;
+        /// @private
+        file_watcher& operator=(const file_watcher&) = delete;
+        /// @private
+        ~file_watcher();
+
+        /// @returns @c true if watching folders is supported on this system.
+        [[nodiscard]]
+        constexpr static bool is_supported() noexcept
+            {
+#ifdef __linux__
+            return true;
+#else
+            return false;
+#endif
+            }
+
+        /** @brief Waits for files to be changed, created, moved, or deleted.
+            @details Editors often write a file in several steps (or save several files at
+                once), so after the first change this keeps collecting changes until none
+                have occurred for @c settleTime.
+            @param settleTime How long to wait for more changes before returning.
+            @returns The files that changed (in sorted order).
+                Files that were deleted (or moved out of the folder) are included,
+                so callers should check whether each file still exists. If a subfolder
+                was deleted, then the subfolder itself is included.
+            @throws std::runtime_error If reading the changes fails.*/
+        [[nodiscard]]
+        std::vector<std::filesystem::path>
+        wait_for_changes(const std::chrono::milliseconds settleTime);
+
+      private:
+        /// @brief Watches a folder and all of its subfolders.
+        /// @param folder The folder to watch.
+        /// @param changedFiles If not null, the files already in the folder are added to this
+        ///     (used for folders that were created or moved in while being watched).
+        void add_watch(const std::filesystem::path& folder,
+                       std::vector<std::filesystem::path>* changedFiles);
+        /// @brief Stops watching a folder (that was moved or deleted) and its subfolders.
+        void remove_watches(const std::filesystem::path& folder);
+        /// @brief Reads all of the pending changes.
+        void read_changes(std::vector<std::filesystem::path>& changedFiles);
+
+        int m_handle{ -1 };
+        /// @brief The folder for each watch descriptor.
+        std::map<int, std::filesystem::path> m_watched_folders;
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__FILE_WATCHER_H__
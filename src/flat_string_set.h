@@ -0,0 +1,262 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __FLAT_STRING_SET_H__
+#define __FLAT_STRING_SET_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <cwctype>
+#include <initializer_list>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace i18n_check
+    {
+    /// @brief Key folding for a flat_string_set that compares strings exactly.
+    struct exact_key_folding
+        {
+        /// @returns The character, unchanged.
+        /// @param ch The character to fold.
+        [[nodiscard]]
+        constexpr static wchar_t fold(const wchar_t ch) noexcept
+            {
+            return ch;
+            }
+        };
+
+    /// @brief Key folding for a flat_string_set that compares strings case insensitively.
+    struct case_insensitive_key_folding
+        {
+        /// @returns The lowercased character.
+        /// @param ch The character to fold.
+        [[nodiscard]]
+        static wchar_t fold(const wchar_t ch) noexcept
+            {
+            // function and file names are nearly always ASCII, so skip the locale lookup
+            if (ch < 0x80)
+                {
+                return (ch >= L'A' && ch <= L'Z') ? static_cast<wchar_t>(ch + (L'a' - L'A')) :
+                                                    ch;
+                }
+            return static_cast<wchar_t>(std::towlower(ch));
+            }
+        };
+
+    /** @brief A set of strings that is optimized for lookups.
+        @details The keys are stored (folded) in insertion order and indexed by an
+            open-addressing hash table, so a lookup is a hash of the text being searched for
+            and (usually) a single string comparison; it does not allocate or fold a copy of
+            the text being searched for.\n
+            This is meant for the function names, keywords, and known strings that are
+            looked up for every string in a file, which are built once and then only read.
+        @tparam FoldingT How to fold the keys' characters before comparing them
+            (e.g., case_insensitive_key_folding).
+        @note Iterating over the set returns the folded keys, in the order they were added.*/
+    template<typename FoldingT = exact_key_folding>
+    class flat_string_set
+        {
+      public:
+        /// @brief An iterator to the (folded) keys.
+        using const_iterator = std::vector<std::wstring>::const_iterator;
+
+        /// @private
+        flat_string_set() = default;
+
+        /// @brief Constructs the set from a list of keys.
+        /// @param keys The keys to add (duplicates are ignored).
+        flat_string_set(std::initializer_list<std::wstring_view> keys)
+            {
+            rehash(table_size_for(keys.size()));
+            for (const auto& key : keys)
+                {
+                insert(key);
+                }
+            }
+
+        /** @brief Adds a key to the set.
+            @param key The key to add.
+            @returns @c true if the key was added, @c false if it was already in the set.*/
+        bool insert(const std::wstring_view key)
+            {
+            if (contains(key))
+                {
+                return false;
+                }
+            // keep the table at most half full, so that probe sequences stay short
+            if ((m_keys.size() + 1) * 2 > m_slots.size())
+                {
+                rehash(table_size_for(m_keys.size() + 1));
+                }
+            std::wstring& foldedKey = m_keys.emplace_back(key.length(), L'\0');
+            std::transform(key.cbegin(), key.cend(), foldedKey.begin(),
+                           [](const wchar_t ch) { return FoldingT::fold(ch); });
+            place(hash_key(key), static_cast<uint32_t>(m_keys.size() - 1));
+            return true;
+            }
+
+        /// @returns @c true if @c key is in the set.
+        /// @param key The key to search for.
+        [[nodiscard]]
+        bool contains(const std::wstring_view key) const noexcept
+            {
+            if (m_slots.empty())
+                {
+                return false;
+                }
+            const uint64_t hash{ hash_key(key) };
+            const size_t mask{ m_slots.size() - 1 };
+            for (size_t pos = static_cast<size_t>(hash) & mask; /* until an empty slot */;
+                 pos = (pos + 1) & mask)
+                {
+                const key_slot& slot{ m_slots[pos] };
+                if (slot.m_index == EMPTY_SLOT)
+                    {
+                    return false;
+                    }
+                if (slot.m_hash == static_cast<uint32_t>(hash >> 32) &&
+                    keys_equal(m_keys[slot.m_index], key))
+                    {
+                    return true;
+                    }
+                }
+            }
+
+        /// @returns The number of keys in the set.
+        [[nodiscard]]
+        size_t size() const noexcept
+            {
+            return m_keys.size();
+            }
+
+        /// @returns @c true if the set has no keys.
+        [[nodiscard]]
+        bool empty() const noexcept
+            {
+            return m_keys.empty();
+            }
+
+        /// @returns An iterator to the first (folded) key.
+        [[nodiscard]]
+        const_iterator begin() const noexcept
+            {
+            return m_keys.cbegin();
+            }
+
+        /// @returns An iterator past the last key.
+        [[nodiscard]]
+        const_iterator end() const noexcept
+            {
+            return m_keys.cend();
+            }
+
+        /// @returns An iterator to the first (folded) key.
+        [[nodiscard]]
+        const_iterator cbegin() const noexcept
+            {
+            return m_keys.cbegin();
+            }
+
+        /// @returns An iterator past the last key.
+        [[nodiscard]]
+        const_iterator cend() const noexcept
+            {
+            return m_keys.cend();
+            }
+
+      private:
+        /// @brief A slot in the hash table.
+        struct key_slot
+            {
+            // the upper half of the key's hash, to skip most string comparisons
+            uint32_t m_hash{ 0 };
+            uint32_t m_index{ EMPTY_SLOT };
+            };
+
+        constexpr static uint32_t EMPTY_SLOT{ std::numeric_limits<uint32_t>::max() };
+        constexpr static size_t MIN_TABLE_SIZE{ 16 };
+
+        /// @returns The (power of two) table size for a number of keys.
+        [[nodiscard]]
+        constexpr static size_t table_size_for(const size_t keyCount) noexcept
+            {
+            size_t tableSize{ MIN_TABLE_SIZE };
+            while (tableSize < keyCount * 2)
+                {
+                tableSize *= 2;
+                }
+            return tableSize;
+            }
+
+        /// @returns The FNV-1a hash of the folded key.
+        [[nodiscard]]
+        static uint64_t hash_key(const std::wstring_view key) noexcept
+            {
+            constexpr uint64_t FNV_OFFSET_BASIS{ 14'695'981'039'346'656'037ULL };
+            constexpr uint64_t FNV_PRIME{ 1'099'511'628'211ULL };
+            uint64_t hash{ FNV_OFFSET_BASIS };
+            for (const wchar_t ch : key)
+                {
+                hash ^= static_cast<uint64_t>(FoldingT::fold(ch));
+                hash *= FNV_PRIME;
+                }
+            return hash;
+            }
+
+        /// @returns @c true if the folded key and the text being searched for are the same.
+        [[nodiscard]]
+        static bool keys_equal(const std::wstring& foldedKey, const std::wstring_view key) noexcept
+            {
+            return foldedKey.length() == key.length() &&
+                   std::equal(key.cbegin(), key.cend(), foldedKey.cbegin(),
+                              [](const wchar_t ch, const wchar_t foldedCh)
+                              { return FoldingT::fold(ch) == foldedCh; });
+            }
+
+        void place(const uint64_t hash, const uint32_t index) noexcept
+            {
+            const size_t mask{ m_slots.size() - 1 };
+            size_t pos{ static_cast<size_t>(hash) & mask };
+            while (m_slots[pos].m_index != EMPTY_SLOT)
+                {
+                pos = (pos + 1) & mask;
+                }
+            m_slots[pos] = key_slot{ static_cast<uint32_t>(hash >> 32), index };
+            }
+
+        void rehash(const size_t tableSize)
+            {
+            m_slots.assign(tableSize, key_slot{});
+            for (size_t i = 0; i < m_keys.size(); ++i)
+                {
+                place(hash_key(m_keys[i]), static_cast<uint32_t>(i));
+                }
+            }
+
+        std::vector<std::wstring> m_keys;
+        std::vector<key_slot> m_slots;
+        };
+
+    /// @brief A flat_string_set that compares strings case insensitively.
+    using case_insensitive_flat_string_set = flat_string_set<case_insensitive_key_folding>;
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__FLAT_STRING_SET_H__
@@ -167,7 +167,7 @@ bool I18NApp::OnInit()
             {
             continue;
             }
-        i18n_check::i18n_review::add_font_name_to_ignore(fn.wc_str());
+        m_systemFontNames.push_back(fn.ToStdWstring());
         }
 
     return true;
@@ -55,6 +55,8 @@ class I18NApp : public wxApp
 
     I18NOptions m_defaultOptions;
     wxString m_optionsFilePath;
+    // the system's fonts, which analyzers ignore if found as strings
+    std::vector<std::wstring> m_systemFontNames;
     };
 
     /** @}*/
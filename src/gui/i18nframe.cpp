@@ -1508,11 +1508,15 @@ void I18NFrame::Process()
         parser.set_min_words_for_classifying_unavailable_string(
             m_activeProjectOptions.m_minWordsForClassifyingUnavailableString);
         parser.set_min_cpp_version(m_activeProjectOptions.m_minCppVersion);
+        for (const auto& fontName : wxGetApp().m_systemFontNames)
+            {
+            parser.add_font_name_to_ignore(fontName);
+            }
         for (const auto& pattern : m_activeProjectOptions.m_varsToIgnore)
             {
             try
                 {
-                parser.add_variable_name_pattern_to_ignore(std::wregex{ pattern.wc_string() });
+                parser.add_variable_name_pattern_to_ignore(pattern.ToStdWstring());
                 }
             catch (...)
                 {
@@ -1531,6 +1535,10 @@ void I18NFrame::Process()
     rc.set_style(static_cast<i18n_check::review_style>(m_activeProjectOptions.m_options));
     rc.allow_translating_punctuation_only_strings(
         m_activeProjectOptions.m_allowTranslatingPunctuationOnlyStrings);
+    for (const auto& fontName : wxGetApp().m_systemFontNames)
+        {
+        rc.add_font_name_to_ignore(fontName);
+        }
 
     i18n_check::po_file_review po(m_activeProjectOptions.m_verbose);
     po.set_style(static_cast<i18n_check::review_style>(m_activeProjectOptions.m_options));
@@ -1540,6 +1548,8 @@ void I18NFrame::Process()
     i18n_check::info_plist_file_review infoPlist(m_activeProjectOptions.m_verbose);
 
     i18n_check::batch_analyze analyzer(&cpp, &rc, &po, &csharp, &infoPlist);
+    // analyze files using all processor cores
+    analyzer.set_jobs(0);
 
     if (m_activeProjectOptions.m_pseudoTranslationMethod !=
         i18n_check::pseudo_translation_method::none)
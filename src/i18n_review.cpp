@@ -12,6 +12,7 @@
  ********************************************************************************/
 
 #include "i18n_review.h"
+#include "results_cache.h"
 
 namespace i18n_check
     {
@@ -19,23 +20,23 @@ namespace i18n_check
 
     const std::wregex i18n_review::m_halfwidth_range_regex{ LR"([\uFF61-\uFFDC]+)" };
 
-    const std::wregex i18n_review::m_url_email_regex{
+    const regex_pattern i18n_review::m_url_email_regex{
         LR"(((http|ftp)s?:\/\/)?(www\.)[-a-zA-Z0-9@:%._\+~#=]{1,256}\.[a-zA-Z0-9()]{1,6}\b([-a-zA-Z0-9()@:%_\+.~#?&//=]*))"
     };
 
-    const std::wregex i18n_review::m_us_phone_number_regex{
+    const regex_pattern i18n_review::m_us_phone_number_regex{
         LR"((\+\d{1,2}\s)?\(?\d{3}\)?[\s.-]\d{3}[\s.-]\d{4})"
     };
 
-    const std::wregex i18n_review::m_non_us_phone_number_regex{
+    const regex_pattern i18n_review::m_non_us_phone_number_regex{
         LR"((\+0?1\s)?\(?\d{3}\)?[\s.-]\d{3}[\s.-]\d{4})"
     };
 
-    const std::wregex i18n_review::m_malformed_html_tag_bad_amp{ LR"(&amp;[a-zA-Z]{3,5};)" };
+    const regex_pattern i18n_review::m_malformed_html_tag_bad_amp{ LR"(&amp;[a-zA-Z]{3,5};)" };
 
-    const std::wregex i18n_review::m_malformed_html_tag{ LR"(&(nbsp|amp|quot)[^;])" };
+    const regex_pattern i18n_review::m_malformed_html_tag{ LR"(&(nbsp|amp|quot)[^;])" };
 
-    const std::wregex i18n_review::m_sql_code{
+    const regex_pattern i18n_review::m_sql_code{
         LR"(.*(SELECT \*|CREATE TABLE|CREATE INDEX|COLLATE NOCASE|ALTER TABLE|DROP TABLE|COLLATE DATABASE_DEFAULT).*)",
         std::regex_constants::icase
     };
@@ -45,21 +46,17 @@ namespace i18n_check
         LR"((int|uint32_t|uint64_t|INT|UINT|wxWindowID|#define)( |\t|const)*([a-zA-Z0-9_]*ID[a-zA-Z0-9_]*)[ \t]*[=\({]?[ \t\({]*([a-zA-Z0-9_ \+\-\'<>:\.]+){1}(.?))"
     };
 
-    const std::wregex i18n_review::m_diagnostic_function_regex{
-        LR"(([a-zA-Z0-9_]*|^)(ASSERT|VERIFY|PROFILE|CHECK)([a-zA-Z0-9_]*|$))"
-    };
-
-    const std::wregex i18n_review::m_plural_regex{ LR"([[:alnum:]]{2,}[(]s[)])" };
-    const std::wregex i18n_review::m_open_function_signature_regex{ LR"([[:alnum:]]{2,}[(])" };
-    const std::wregex i18n_review::m_html_tag_regex{ LR"(&[a-zA-Z]{2,5};.*)" };
-    const std::wregex i18n_review::m_html_tag_unicode_regex{ LR"(&#[[:digit:]]{2,4};.*)" };
+    const regex_pattern i18n_review::m_plural_regex{ LR"([[:alnum:]]{2,}[(]s[)])" };
+    const regex_pattern i18n_review::m_open_function_signature_regex{ LR"([[:alnum:]]{2,}[(])" };
+    const regex_pattern i18n_review::m_html_tag_regex{ LR"(&[a-zA-Z]{2,5};.*)" };
+    const regex_pattern i18n_review::m_html_tag_unicode_regex{ LR"(&#[[:digit:]]{2,4};.*)" };
     // contains Western European, Czech, Polish, and Russian extended ASCII characters:
     // ŽžŸÀ-ÖØ-öø-ÿżźćńółęąśŻŹĆĄŚĘŁÓŃěščřžýáíéóúůďťňĎŇŤŠČŘŽÝÁÍÉÚŮĚÓАБВГДЕЁЖЗИЙКЛМНОПРСТУФХЦЧШЩЪЫЬЭЮЯабвгдеёжзийклмнопрстуфхцчшщъыьэюяІі
     // [:alpha:] supports all languages with MSVC, but GCC and Clang limit this to 7-bit ASCII (even
     // when calling setlocale), so we need to include other charsets explicitly here when trying to
     // include them in source strings.
     // quneiform-suppress-begin
-    const std::wregex i18n_review::m_2letter_regex{
+    const regex_pattern i18n_review::m_2letter_regex{
         LR"([[:alpha:]ŽžŸÀ-ÖØ-öø-ÿżźćńółęąśŻŹĆĄŚĘŁÓŃěščřžýáíéóúůďťňĎŇŤŠČŘŽÝÁÍÉÚŮĚÓАБВГДЕЁЖЗИЙКЛМНОПРСТУФХЦЧШЩЪЫЬЭЮЯабвгдеёжзийклмнопрстуфхцчшщъыьэюяІі]{2,})"
     };
     const std::wregex i18n_review::m_1word_regex{
@@ -67,42 +64,42 @@ namespace i18n_check
     };
     const std::wregex i18n_review::m_keyboard_accelerator_regex{ LR"((^|[^&])&[^\s&])" };
     // quneiform-suppress-end
-    const std::wregex i18n_review::m_hashtag_regex{ LR"(#[[:alnum:]]{2,})" };
-    const std::wregex i18n_review::m_key_shortcut_regex{
+    const regex_pattern i18n_review::m_hashtag_regex{ LR"(#[[:alnum:]]{2,})" };
+    const regex_pattern i18n_review::m_key_shortcut_regex{
         LR"((CTRL|SHIFT|CMD|ALT)([+](CTRL|SHIFT|CMD|ALT))*([+][[:alnum:]])+)",
         std::regex_constants::icase
     };
-    const std::wregex i18n_review::m_function_signature_regex{
+    const regex_pattern i18n_review::m_function_signature_regex{
         LR"([[:alnum:]]{2,}[(][[:alnum:]]+(,[[:space:]]*[[:alnum:]]+)*[)])"
     };
 
     // HTML, but also includes some GTK formatting tags
-    const std::wregex i18n_review::m_html_regex{
+    const regex_pattern i18n_review::m_html_regex{
         LR"([^[:alnum:]<]*<(span|object|property|div|p|ul|ol|li|img|html|[?]xml|meta|body|table|tbody|tr|td|thead|head|title|a[[:space:]]|!--|/|!DOCTYPE|br|center|dd|em|dl|dt|tt|font|form|h[[:digit:]]|hr|main|map|pre|script).*)",
         std::regex_constants::icase
     };
     // <doc-val>Some text</doc-val>
-    const std::wregex i18n_review::m_html_element_with_content_regex{
+    const regex_pattern i18n_review::m_html_element_with_content_regex{
         LR"(<[a-zA-Z0-9_\-]+>[[:print:][:cntrl:]]*</[a-zA-Z0-9_\-]+>)", std::regex_constants::icase
     };
 
     // <s:complex name=\"{{GetFunctionName}}_{{GetParameterName}}_Array\">
-    const std::wregex i18n_review::m_xml_element_regex{
+    const regex_pattern i18n_review::m_xml_element_regex{
         LR"(<\/?[a-zA-Z0-9_:'"\.\[\]\/\{\}\-\\=][a-zA-Z0-9_:'"\.\[\]\/\{\}\- \\=]+\/?>)",
         std::regex_constants::icase
     };
 
     // not really XML/HTMl ("<No Name Specified>")
-    const std::wregex i18n_review::m_not_xml_element_regex{
+    const regex_pattern i18n_review::m_not_xml_element_regex{
         LR"(<\/?(([a-zA-Z0-9]){2,}\s+){1,}([a-zA-Z0-9]){2,}[[:punct:]]?\/?>)",
         std::regex_constants::icase
     };
 
     // <results> or <Results>, which should be OK to translate
-    const std::wregex i18n_review::m_angle_braced_one_word_regex{ LR"(<[a-zA-Z][a-z\-]+>)" };
+    const regex_pattern i18n_review::m_angle_braced_one_word_regex{ LR"(<[a-zA-Z][a-z\-]+>)" };
 
     // allowable HTML-like elements that are known
-    const std::wregex i18n_review::m_html_known_elements_regex{
+    const regex_pattern i18n_review::m_html_known_elements_regex{
         LR"(<(span|object|property|div|p|ul|ol|li|img|html|xml|meta|body|table|tbody|tr|td|thead|head|title|br|center|dd|em|dl|dt|tt|font|form|hr|main|map|pre|script)>)"
     };
 
@@ -136,163 +133,159 @@ namespace i18n_check
     // %1, %L1, %n, %Ln
     const std::wregex i18n_review::m_positional_command_regex{ LR"([%](n|[L]?[0-9]+|Ln))" };
 
-    // common font faces that we would usually ignore (client can add to this)
-    std::set<string_util::case_insensitive_wstring> i18n_review::m_font_names = { // NOLINT
-        L"Arial",
-        L"Seaford",
-        L"Skeena",
-        L"Tenorite",
-        L"Courier New",
-        L"Garamond",
-        L"Calibri",
-        L"Gabriola",
-        L".Helvetica Neue DeskInterface",
-        L".Lucida Grande UI",
-        L"Times New Roman",
-        L"Georgia",
-        L"Segoe UI",
-        L"Segoe Script",
-        L"Century Gothic",
-        L"Century",
-        L"Cascadia Mono",
-        L"URW Bookman L",
-        L"AR Berkley",
-        L"Brush Script",
-        L"Consolas",
-        L"Century Schoolbook L",
-        L"Lucida Grande",
-        L"Helvetica Neue",
-        L"Liberation Serif",
-        L"Sans Serif",
-        L"Luxi Serif",
-        L"MS Sans Serif",
-        L"Microsoft Sans Serif",
-        L"Ms Shell Dlg",
-        L"Ms Shell Dlg 2",
-        L"Bitstream Vera Serif",
-        L"URW Palladio L",
-        L"URW Chancery L",
-        L"Comic Sans MS",
-        L"DejaVu Serif",
-        L"DejaVu LGC Serif",
-        L"Nimbus Sans L",
-        L"URW Gothic L",
-        L"Lucida Sans",
-        L"Andale Mono",
-        L"Luxi Sans",
-        L"Liberation Sans",
-        L"Bitstream Vera Sans",
-        L"DejaVu LGC Sans",
-        L"DejaVu Sans",
-        L"Nimbus Mono L",
-        L"Lucida Sans Typewriter",
-        L"Luxi Mono",
-        L"DejaVu Sans Mono",
-        L"DejaVu LGC Sans Mono",
-        L"Bitstream Vera Sans Mono",
-        L"Liberation Mono",
-        L"Franklin Gothic",
-        L"Aptos",
-        L"Grandview",
-        L"Bierstadt",
-        L"Tahoma",
-        L"MingLiU",
-        L"MS PGothic",
-        L"Gulim",
-        L"NSimSun"
-    };
+    //--------------------------------------------------
+    i18n_review::i18n_review(const bool verbose)
+        : m_verbose(verbose), m_rules(get_default_rules(verbose))
+        {
+        }
 
-    // documents
-    std::set<string_util::case_insensitive_wstring> i18n_review::m_file_extensions = { // NOLINT
-        L"xml", L"html", L"htm", L"xhtml", L"rtf", L"doc", L"docx", L"dot", L"docm", L"txt", L"ppt",
-        L"pptx", L"pdf", L"ps", L"odt", L"ott", L"odp", L"otp", L"pptm", L"md", L"xaml",
-        // Visual Studio files
-        L"sln", L"csproj", L"json", L"pbxproj", L"apk", L"tlb", L"ocx", L"pdb", L"tlh", L"hlp",
-        L"msi", L"rc", L"vcxproj", L"resx", L"appx", L"vcproj",
-        // macOS
-        L"dmg", L"proj", L"xbuild", L"xmlns",
-        // Database
-        L"mdb", L"db",
-        // Markdown files
-        L"md", L"Rmd", L"qmd", L"yml",
-        // help files
-        L"hhc", L"hhk", L"hhp",
-        // spreadsheets
-        L"xls", L"xlsx", L"ods", L"csv",
-        // image formats
-        L"gif", L"jpg", L"jpeg", L"jpe", L"bmp", L"tiff", L"tif", L"png", L"tga", L"svg", L"xcf",
-        L"ico", L"psd", L"hdr", L"pcx",
-        // webpages
-        L"asp", L"aspx", L"cfm", L"cfml", L"php", L"php3", L"php4", L"sgml", L"wmf", L"js",
-        // style sheets
-        L"css",
-        // movies
-        L"mov", L"qt", L"rv", L"rm", L"wmv", L"mpg", L"mpeg", L"mpe", L"avi",
-        // music
-        L"mp3", L"wav", L"wma", L"midi", L"ra", L"ram",
-        // programs
-        L"exe", L"swf", L"vbs",
-        // source files
-        L"cpp", L"h", L"c", L"idl", L"cs", L"hpp", L"po",
-        // compressed files
-        L"gzip", L"bz2"
-    };
+    //--------------------------------------------------
+    rule_set& i18n_review::get_own_rules()
+        {
+        // if the rules are already this analyzer's own copy (and not shared with a clone),
+        // then keep customizing them rather than copying them again
+        if (m_rules.use_count() != 1)
+            {
+            m_rules = std::make_shared<rule_set>(*m_rules);
+            }
+        // (the copy is not a const object, only the pointer to it is)
+        return const_cast<rule_set&>(*m_rules);
+        }
 
-    std::set<std::wstring> i18n_review::m_untranslatable_exceptions = { L"PhD" };
-
-    std::vector<std::wregex> i18n_review::m_variable_name_patterns_to_ignore;
-
-    // variables whose CTORs take a string that should never be translated
-    std::set<std::wstring> i18n_review::m_variable_types_to_ignore = {
-        L"wxUxThemeHandle",
-        L"wxRegKey",
-        L"wxXmlNode",
-        L"wxLoadedDLL",
-        L"wxConfigPathChanger",
-        L"wxWebViewEvent",
-        L"wxFileSystemWatcherEvent",
-        L"wxStdioPipe",
-        L"wxCMD_LINE_CHARS_ALLOWED_BY_SHORT_OPTION",
-        L"vmsWarningHandler",
-        L"vmsErrorHandler",
-        L"wxFFileOutputStream",
-        L"wxFFile",
-        L"wxFileName",
-        L"wxColor",
-        L"wxColour",
-        L"wxFont",
-        L"LOGFONTW",
-        L"Font",
-        L"SecretSchema",
-        L"GtkTypeInfo",
-        L"QKeySequence",
-        L"wxRegEx",
-        L"wregex",
-        L"std::wregex",
-        L"regex",
-        L"std::regex",
-        L"Regex",
-        L"ifstream",
-        L"ofstream",
-        L"FileStream",
-        L"StreamWriter",
-        L"CultureInfo",
-        L"TagHelperAttribute",
-        L"QRegularExpression",
-        L"wxDataViewRenderer",
-        L"wxDataViewBitmapRenderer",
-        L"wxDataViewDateRenderer",
-        L"wxDataViewTextRenderer",
-        L"wxDataViewIconTextRenderer",
-        L"wxDataViewCustomRenderer",
-        L"wxDataViewToggleRenderer",
-        L"wxDataObjectSimple"
-    };
+    //--------------------------------------------------
+    bool i18n_review::is_ignored_variable_name(std::wstring_view name) const
+        {
+        const auto matches = [&name](const regex_pattern& pattern)
+        { return pattern.matches(name); };
+        return std::any_of(m_rules->m_variable_name_patterns_to_ignore.cbegin(),
+                           m_rules->m_variable_name_patterns_to_ignore.cend(), matches);
+        }
+
+    //--------------------------------------------------
+    bool i18n_review::is_ignored_variable_type(std::wstring_view type) const
+        {
+        return m_rules->m_variable_types_to_ignore.contains(type);
+        }
+
+    //--------------------------------------------------
+    std::wstring_view i18n_review::get_deprecated_function_name(std::wstring_view func)
+        {
+        while (!func.empty() && !is_valid_name_char(func.front()))
+            {
+            func.remove_prefix(1);
+            }
+        while (!func.empty() && !is_valid_name_char(func.back()))
+            {
+            func.remove_suffix(1);
+            }
+        return func;
+        }
 
     //--------------------------------------------------
-    i18n_review::i18n_review(const bool verbose) : m_verbose(verbose)
+    std::unordered_map<std::wstring_view, std::vector<deprecated_function_entry>>
+    i18n_review::build_deprecated_function_names(
+        const std::map<std::wstring_view, std::wstring>& functions)
         {
-        m_deprecated_string_macros = {
+        std::unordered_map<std::wstring_view, std::vector<deprecated_function_entry>>
+            deprecatedFunctionNames;
+        size_t functionOrder{ 0 };
+        for (const auto& func : functions)
+            {
+            const auto funcName{ get_deprecated_function_name(func.first) };
+            deprecatedFunctionNames[funcName].push_back(
+                { func.first, static_cast<size_t>(funcName.data() - func.first.data()),
+                  functionOrder++ });
+            }
+        return deprecatedFunctionNames;
+        }
+
+    //--------------------------------------------------
+    const std::shared_ptr<const rule_set>& i18n_review::get_default_rules(const bool verbose)
+        {
+        static const std::shared_ptr<const rule_set> rules{ build_default_rules() };
+        if (verbose)
+            {
+            static const std::shared_ptr<const rule_set> verboseRules{ build_verbose_rules(
+                *rules) };
+            return verboseRules;
+            }
+        return rules;
+        }
+
+    //--------------------------------------------------
+    std::shared_ptr<const rule_set> i18n_review::build_verbose_rules(const rule_set& rules)
+        {
+        // the rules are shared by analyzers regardless of their minimum C++ version,
+        // so the deprecated functions are based on the default version
+        constexpr int minCppVersion{ 2014 };
+        auto verboseRules = std::make_shared<rule_set>(rules);
+
+        // not i18n related, just legacy wx functions that can be modernized
+        if (minCppVersion >= 2011)
+            {
+            verboseRules->m_deprecated_string_functions.insert(
+                { L"_STATIC_ASSERT",
+                  _WXTRANS_WSTR(L"Use static_assert() instead of _STATIC_ASSERT().") });
+            verboseRules->m_deprecated_string_functions.insert(
+                { L"wxMEMBER_DELETE",
+                  _WXTRANS_WSTR(L"Use '= delete' instead of wxMEMBER_DELETE.") });
+            verboseRules->m_deprecated_string_functions.insert(
+                { L"wxOVERRIDE",
+                  _WXTRANS_WSTR(L"Use override or final instead of wxOVERRIDE.") });
+            }
+        if (minCppVersion >= 2017)
+            {
+            verboseRules->m_deprecated_string_functions.insert(
+                { L"wxNODISCARD",
+                  _WXTRANS_WSTR(L"Use [[nodiscard]] instead of wxNODISCARD.") });
+            verboseRules->m_deprecated_string_functions.insert(
+                { L"WXSIZEOF", _WXTRANS_WSTR(L"Use std::size() instead of WXSIZEOF().") });
+            verboseRules->m_deprecated_string_functions.insert(
+                { L"wxUnusedVar",
+                  _WXTRANS_WSTR(L"Use [[maybe_unused]] instead of wxUnusedVar.") });
+            verboseRules->m_deprecated_string_functions.insert(
+                { L"WXUNUSED", _WXTRANS_WSTR(L"Use [[maybe_unused]] instead of WXUNUSED().") });
+            }
+        verboseRules->m_deprecated_string_functions.insert(
+            { L"wxEXPAND",
+              _WXTRANS_WSTR(L"Call wxSizer::Add() with a wxSizerFlags object using Expand() "
+                            "instead of wxEXPAND.") });
+        verboseRules->m_deprecated_string_functions.insert(
+            { L"wxGROW",
+              _WXTRANS_WSTR(L"Call wxSizer::Add() with a wxSizerFlags object using Expand() "
+                            "instead of wxGROW.") });
+        verboseRules->m_deprecated_string_functions.insert(
+            { L"DECLARE_NO_COPY_CLASS",
+              _WXTRANS_WSTR(L"Delete the copy CTOR and assignment operator "
+                            "instead of DECLARE_NO_COPY_CLASS.") });
+        verboseRules->m_deprecated_string_functions.insert(
+            { L"wxDECLARE_NO_COPY_CLASS",
+              _WXTRANS_WSTR(L"Delete the copy CTOR and assignment operator instead of "
+                            "wxDECLARE_NO_COPY_CLASS.") });
+        verboseRules->m_deprecated_string_functions.insert(
+            { L"wxMin", _WXTRANS_WSTR(L"Use std::min() instead of wxMin().") });
+        verboseRules->m_deprecated_string_functions.insert(
+            { L"wxMax", _WXTRANS_WSTR(L"Use std::max() instead of wxMax().") });
+        verboseRules->m_deprecated_string_functions.insert(
+            { L"wxRound", _WXTRANS_WSTR(L"Use std::lround() instead of wxRound().") });
+        verboseRules->m_deprecated_string_functions.insert(
+            { L"wxIsNan", _WXTRANS_WSTR(L"Use std::isnan() instead of wxIsNan().") });
+        verboseRules->m_deprecated_string_functions.insert(
+            { L"wxNOEXCEPT", _WXTRANS_WSTR(L"Use noexcept instead of wxNOEXCEPT.") });
+        verboseRules->m_deprecated_string_functions.insert(
+            { L"__WXMAC__", _WXTRANS_WSTR(L"Use __WXOSX__ instead of __WXMAC__.") });
+
+        verboseRules->m_deprecated_function_names =
+            build_deprecated_function_names(verboseRules->m_deprecated_string_functions);
+        return verboseRules;
+        }
+
+    //--------------------------------------------------
+    std::shared_ptr<const rule_set> i18n_review::build_default_rules()
+        {
+        auto rules = std::make_shared<rule_set>();
+
+        rules->m_deprecated_string_macros = {
             { L"wxT", _WXTRANS_WSTR(L"wxT() macro can be removed.") },
             { L"wxT_2", _WXTRANS_WSTR(L"wxT_2() macro can be removed.") },
             // wxWidgets can convert ANSI strings to double-byte, but Win32/MFC can't
@@ -316,7 +309,7 @@ namespace i18n_check
 
         // Whole file needs to be scanned for these, as string variables can be passed to these
         // as well as hard-coded strings.
-        m_deprecated_string_functions = {
+        rules->m_deprecated_string_functions = {
             // Win32 TCHAR functions (which mapped between _MBCS and _UNICODE builds).
             // Nowadays, you should always be compiling as _UNICODE (i.e., UTF-16).
             { L"_tfopen", _WXTRANS_WSTR(L"Use fopen instead of _tfopen.") },
@@ -467,305 +460,250 @@ namespace i18n_check
             { L"*wxConvCurrent", _WXTRANS_WSTR(L"Prefer using a wxConvAuto object instead.") }
         };
 
-        if (verbose)
-            {
-            // not i18n related, just legacy wx functions that can be modernized
-            if (m_min_cpp_version >= 2011)
-                {
-                m_deprecated_string_functions.insert(
-                    { L"_STATIC_ASSERT",
-                      _WXTRANS_WSTR(L"Use static_assert() instead of _STATIC_ASSERT().") });
-                m_deprecated_string_functions.insert(
-                    { L"wxMEMBER_DELETE",
-                      _WXTRANS_WSTR(L"Use '= delete' instead of wxMEMBER_DELETE.") });
-                m_deprecated_string_functions.insert(
-                    { L"wxOVERRIDE",
-                      _WXTRANS_WSTR(L"Use override or final instead of wxOVERRIDE.") });
-                }
-            if (m_min_cpp_version >= 2017)
-                {
-                m_deprecated_string_functions.insert(
-                    { L"wxNODISCARD",
-                      _WXTRANS_WSTR(L"Use [[nodiscard]] instead of wxNODISCARD.") });
-                m_deprecated_string_functions.insert(
-                    { L"WXSIZEOF", _WXTRANS_WSTR(L"Use std::size() instead of WXSIZEOF().") });
-                m_deprecated_string_functions.insert(
-                    { L"wxUnusedVar",
-                      _WXTRANS_WSTR(L"Use [[maybe_unused]] instead of wxUnusedVar.") });
-                m_deprecated_string_functions.insert(
-                    { L"WXUNUSED", _WXTRANS_WSTR(L"Use [[maybe_unused]] instead of WXUNUSED().") });
-                }
-            m_deprecated_string_functions.insert(
-                { L"wxEXPAND",
-                  _WXTRANS_WSTR(L"Call wxSizer::Add() with a wxSizerFlags object using Expand() "
-                                "instead of wxEXPAND.") });
-            m_deprecated_string_functions.insert(
-                { L"wxGROW",
-                  _WXTRANS_WSTR(L"Call wxSizer::Add() with a wxSizerFlags object using Expand() "
-                                "instead of wxGROW.") });
-            m_deprecated_string_functions.insert(
-                { L"DECLARE_NO_COPY_CLASS",
-                  _WXTRANS_WSTR(L"Delete the copy CTOR and assignment operator "
-                                "instead of DECLARE_NO_COPY_CLASS.") });
-            m_deprecated_string_functions.insert(
-                { L"wxDECLARE_NO_COPY_CLASS",
-                  _WXTRANS_WSTR(L"Delete the copy CTOR and assignment operator instead of "
-                                "wxDECLARE_NO_COPY_CLASS.") });
-            m_deprecated_string_functions.insert(
-                { L"wxMin", _WXTRANS_WSTR(L"Use std::min() instead of wxMin().") });
-            m_deprecated_string_functions.insert(
-                { L"wxMax", _WXTRANS_WSTR(L"Use std::max() instead of wxMax().") });
-            m_deprecated_string_functions.insert(
-                { L"wxRound", _WXTRANS_WSTR(L"Use std::lround() instead of wxRound().") });
-            m_deprecated_string_functions.insert(
-                { L"wxIsNan", _WXTRANS_WSTR(L"Use std::isnan() instead of wxIsNan().") });
-            m_deprecated_string_functions.insert(
-                { L"wxNOEXCEPT", _WXTRANS_WSTR(L"Use noexcept instead of wxNOEXCEPT.") });
-            m_deprecated_string_functions.insert(
-                { L"__WXMAC__", _WXTRANS_WSTR(L"Use __WXOSX__ instead of __WXMAC__.") });
-            }
-
-        m_translatable_regexes = { std::wregex(LR"(Q[0-9](F|A)Y.*)") };
-
-        m_untranslatable_regexes = {
+        rules->m_deprecated_function_names =
+            build_deprecated_function_names(rules->m_deprecated_string_functions);
+
+        rules->m_translatable_regexes = { regex_source(LR"(Q[0-9](F|A)Y.*)") };
+
+        rules->m_untranslatable_regexes = {
             // nothing but numbers, punctuation, or control characters?
-            std::wregex(LR"(([[:digit:][:space:][:punct:][:cntrl:]]|\\[rnt])+)"),
+            regex_source(LR"(([[:digit:][:space:][:punct:][:cntrl:]]|\\[rnt])+)"),
             // placeholder text
-            std::wregex(LR"(Lorem ipsum.*)", std::regex_constants::icase),
-            std::wregex(LR"(The quick brown fox.*)", std::regex_constants::icase),
+            regex_source(LR"(Lorem ipsum.*)", std::regex_constants::icase),
+            regex_source(LR"(The quick brown fox.*)", std::regex_constants::icase),
             // webpage content type
-            std::wregex(
+            regex_source(
                 LR"([A-Za-z0-9\-]+/[A-Za-z0-9\-]+;[[:space:]]*[A-Za-z0-9\-]+=[A-Za-z0-9\-]+)"),
             // SQL code
-            m_sql_code,
-            std::wregex(LR"(^(INSERT INTO|DELETE ([*] )?FROM).*)", std::regex_constants::icase),
-            std::wregex(LR"(^ORDER BY.*)"), // more strict
-            std::wregex(LR"([(]*SELECT[[:space:]]+(COUNT|MIN|MAX|SUM|AVG|DISTINCT)[(].*)"),
-            std::wregex(LR"([(]*SELECT[[:space:]]+[A-Z_0-9\.]+,.*)"), std::wregex(LR"(^DSN=.*)"),
-            std::wregex(LR"(^Provider=(SQLOLEDB|Search).*)"),
-            std::wregex(LR"(^Connection: Keep-Alive$)"), std::wregex(LR"(ODBC;DSN=.*)"),
+            regex_source(m_sql_code.get_pattern(), m_sql_code.get_flags()),
+            regex_source(LR"(^(INSERT INTO|DELETE ([*] )?FROM).*)", std::regex_constants::icase),
+            regex_source(LR"(^ORDER BY.*)"), // more strict
+            regex_source(LR"([(]*SELECT[[:space:]]+(COUNT|MIN|MAX|SUM|AVG|DISTINCT)[(].*)"),
+            regex_source(LR"([(]*SELECT[[:space:]]+[A-Z_0-9\.]+,.*)"), regex_source(LR"(^DSN=.*)"),
+            regex_source(LR"(^Provider=(SQLOLEDB|Search).*)"),
+            regex_source(LR"(^Connection: Keep-Alive$)"), regex_source(LR"(ODBC;DSN=.*)"),
             // C++ code
-            std::wregex(LR"([a-zA-Z0-9]+\:\:[a-zA-Z0-9]+(\:\:[a-zA-Z0-9]+)?)"),
+            regex_source(LR"([a-zA-Z0-9]+\:\:[a-zA-Z0-9]+(\:\:[a-zA-Z0-9]+)?)"),
             // gettext formats
-            std::wregex(LR"((possible\-)?(c|cpp|kde|qt)\-(plural\-)?format)"),
+            regex_source(LR"((possible\-)?(c|cpp|kde|qt)\-(plural\-)?format)"),
             // a regex expression
-            std::wregex(LR"([(][?]i[)].*)"),
+            regex_source(LR"([(][?]i[)].*)"),
             // single file filter that just has a file extension as its "name"
             // PNG (*.png)
             // PNG (*.png)|*.png
             // TIFF (*.tif;*.tiff)|*.tif;*.tiff
             // special case for the word "bitmap" also, wouldn't normally translate that
-            std::wregex(LR"(([A-Z]+|[bB]itmap) [(]([*][.][A-Za-z0-9]{1,7}[)]))"),
-            std::wregex(
+            regex_source(LR"(([A-Z]+|[bB]itmap) [(]([*][.][A-Za-z0-9]{1,7}[)]))"),
+            regex_source(
                 LR"((([A-Z]+|[bB]itmap) [(]([*][.][A-Za-z0-9]{1,7})(;[*][.][A-Za-z0-9]{1,7})*[)][|]([*][.][A-Za-z0-9]{1,7})(;[*][.][A-Za-z0-9]{1,7})*[|]{0,2})+)"),
             // multiple file filters next to each other
-            std::wregex(LR"(([*][.][A-Za-z0-9]{1,7}[;]?[[:space:]]*)+)"),
+            regex_source(LR"(([*][.][A-Za-z0-9]{1,7}[;]?[[:space:]]*)+)"),
             // clang-tidy commands
-            std::wregex(LR"(\-checks=.*)"),
+            regex_source(LR"(\-checks=.*)"),
             // generic measuring string (or regex expression)
-            std::wregex(LR"([[:space:]]*(ABCDEFG|abcdefg|AEIOU|aeiou).*)"),
+            regex_source(LR"([[:space:]]*(ABCDEFG|abcdefg|AEIOU|aeiou).*)"),
             // debug messages
-            std::wregex(LR"(Assert(ion)? (f|F)ail.*)"), std::wregex(LR"(ASSERT *)"),
+            regex_source(LR"(Assert(ion)? (f|F)ail.*)"), regex_source(LR"(ASSERT *)"),
             // HTML doc start
-            std::wregex(LR"(<!DOCTYPE html)"),
+            regex_source(LR"(<!DOCTYPE html)"),
             // HTML entities
-            std::wregex(LR"(&[#]?[xX]?[A-Za-z0-9]+;)"), std::wregex(LR"(<a href=.*)"),
+            regex_source(LR"(&[#]?[xX]?[A-Za-z0-9]+;)"), regex_source(LR"(<a href=.*)"),
             // HTML comment
-            std::wregex(LR"(<![-]{2,}.*)"),
+            regex_source(LR"(<![-]{2,}.*)"),
             // anchor
-            std::wregex(LR"(#[a-zA-Z0-9\-]{3,})"),
+            regex_source(LR"(#[a-zA-Z0-9\-]{3,})"),
             // CSS
-            std::wregex(LR"(a[:](hover|link))", std::regex_constants::icase),
-            std::wregex(LR"((width|height)[[:space:]]*\:[%]?[a-z]{2,4};)",
-                        std::regex_constants::icase),
-            std::wregex(
+            regex_source(LR"(a[:](hover|link))", std::regex_constants::icase),
+            regex_source(LR"((width|height)[[:space:]]*\:[%]?[a-z]{2,4};)",
+                         std::regex_constants::icase),
+            regex_source(
                 LR"([\s\S]*(\{[[:space:]]*[a-zA-Z\-]+[[:space:]]*[:][[:space:]]*[0-9a-zA-Z\- \(\)\\;\:%#'",]+[[:space:]]*\})+[\s\S]*)"),
-            std::wregex(
+            regex_source(
                 LR"((margin[-](top|bottom|left|right)|text[-]indent)[:][[:space:]]*[[:alnum:]%]+;)"),
             // single hypenphated word that starts lowercase
-            std::wregex(LR"([a-z][a-z0-9_]*\-[a-z0-9_]+(\-[a-z0-9_]+)*)"),
+            regex_source(LR"([a-z][a-z0-9_]*\-[a-z0-9_]+(\-[a-z0-9_]+)*)"),
             // JS
-            std::wregex(LR"(class[[:space:]]*=[[:space:]]*['"][A-Za-z0-9\- _]*['"])"),
+            regex_source(LR"(class[[:space:]]*=[[:space:]]*['"][A-Za-z0-9\- _]*['"])"),
             // An opening HTML element
-            std::wregex(LR"(<(body|html|img|head|meta|style|span|p|tr|td))"),
+            regex_source(LR"(<(body|html|img|head|meta|style|span|p|tr|td))"),
             // PostScript element
-            std::wregex(LR"(%%[a-zA-Z]+:.*)"),
-            std::wregex(LR"((<< [\/()A-Za-z0-9[:space:]]*(\\n|[[:space:]])*)+)"),
-            std::wregex(
+            regex_source(LR"(%%[a-zA-Z]+:.*)"),
+            regex_source(LR"((<< [\/()A-Za-z0-9[:space:]]*(\\n|[[:space:]])*)+)"),
+            regex_source(
                 LR"((\/[A-Za-z0-9[:space:]]* \[[A-Za-z0-9[:space:]%]+\](\\n|[[:space:]])*)+)"),
             // C
-            std::wregex(
+            regex_source(
                 LR"(^#(include|define|if|ifdef|ifndef|endif|elif|pragma|warning)[[:space:]].*)"),
             // C++
-            std::wregex(LR"([a-zA-Z0-9_]+([-][>]|::)[a-zA-Z0-9_]+([(][)];)?)"),
-            std::wregex(LR"(#(define|pragma) .*)"),
+            regex_source(LR"([a-zA-Z0-9_]+([-][>]|::)[a-zA-Z0-9_]+([(][)];)?)"),
+            regex_source(LR"(#(define|pragma) .*)"),
             // command lines
-            std::wregex(LR"([-]D [A-Z_]{2,}[ =].*)"), std::wregex(LR"([-]dynamiclib .*)"),
-            std::wregex(LR"([-]{2}[a-z]{2,}[ :].*)"),
+            regex_source(LR"([-]D [A-Z_]{2,}[ =].*)"), regex_source(LR"([-]dynamiclib .*)"),
+            regex_source(LR"([-]{2}[a-z]{2,}[ :].*)"),
             // registry keys
-            std::wregex(LR"(SOFTWARE[\\]{1,2}(Policies|Microsoft|Classes).*)",
-                        std::regex_constants::icase),
-            std::wregex(LR"(SYSTEM[\\]{1,2}(CurrentControlSet).*)", std::regex_constants::icase),
-            std::wregex(LR"(HKEY_.*)"),
+            regex_source(LR"(SOFTWARE[\\]{1,2}(Policies|Microsoft|Classes).*)",
+                         std::regex_constants::icase),
+            regex_source(LR"(SYSTEM[\\]{1,2}(CurrentControlSet).*)", std::regex_constants::icase),
+            regex_source(LR"(HKEY_.*)"),
             // web query
-            std::wregex(LR"(search.aspx\?.*)"),
+            regex_source(LR"(search.aspx\?.*)"),
             // XML elements
-            std::wregex(LR"(version[ ]?=\\"[0-9\.]+\\")"),
-            std::wregex(LR"(<([A-Za-z])+([A-Za-z0-9_/\\\-\.'"=;:#[:space:]])+[>]?)"),
-            std::wregex(LR"(xml[ ]*version[ ]*=[ ]*\\["'][0-9\.]+\\["'][>]?)"), // partial header
-            std::wregex(LR"(<[\\]?\?xml[ a-zA-Z0-9=\\"'%\.\-]*[\?]?>.*)"),      // full header and
+            regex_source(LR"(version[ ]?=\\"[0-9\.]+\\")"),
+            regex_source(LR"(<([A-Za-z])+([A-Za-z0-9_/\\\-\.'"=;:#[:space:]])+[>]?)"),
+            regex_source(LR"(xml[ ]*version[ ]*=[ ]*\\["'][0-9\.]+\\["'][>]?)"), // partial header
+            regex_source(LR"(<[\\]?\?xml[ a-zA-Z0-9=\\"'%\.\-]*[\?]?>.*)"),      // full header and
                                                                                 // content after it
-            std::wregex(
+            regex_source(
                 LR"(<[A-Za-z]+[A-Za-z0-9_/\\\-\.'"=;:[:space:]]+>[[:space:][:digit:][:punct:]]*<[A-Za-z0-9_/\-.']*>)"),
-            std::wregex(LR"(<[A-Za-z]+([A-Za-z0-9_\-\.]+[[:space:]]*){1,2}=[[:punct:]A-Za-z0-9]*)"),
-            std::wregex(LR"(^[[:space:]]*xmlns(:[[:alnum:]]+)?=.*)"),
-            std::wregex(LR"(^[[:space:]]*<soap(\.udp)?\:[[:alnum:]]+.*)"),
-            std::wregex(LR"(^[[:space:]]*<port\b.*)"), std::wregex(LR"(ms-app(data|x))"),
-            std::wregex(LR"(^\{\{.*)"),                      // soap syntax
-            std::wregex(LR"(&[a-zA-Z0-9]+=[a-zA-Z0-9]+.*)"), // args passed to an URL
-            std::wregex(LR"([cC]ontent-[tT]ype: [a-zA-Z]{3,}\/.*)"),
-            std::wregex(LR"([cC]ontent-[dD]isposition: [a-zA-Z\-]{3,};.*)"),
+            regex_source(LR"(<[A-Za-z]+([A-Za-z0-9_\-\.]+[[:space:]]*){1,2}=[[:punct:]A-Za-z0-9]*)"),
+            regex_source(LR"(^[[:space:]]*xmlns(:[[:alnum:]]+)?=.*)"),
+            regex_source(LR"(^[[:space:]]*<soap(\.udp)?\:[[:alnum:]]+.*)"),
+            regex_source(LR"(^[[:space:]]*<port\b.*)"), regex_source(LR"(ms-app(data|x))"),
+            regex_source(LR"(^\{\{.*)"),                      // soap syntax
+            regex_source(LR"(&[a-zA-Z0-9]+=[a-zA-Z0-9]+.*)"), // args passed to an URL
+            regex_source(LR"([cC]ontent-[tT]ype: [a-zA-Z]{3,}\/.*)"),
+            regex_source(LR"([cC]ontent-[dD]isposition: [a-zA-Z\-]{3,};.*)"),
             // <image x=%d y=\"%d\" width = '%dpx' height="%dpx"
-            std::wregex(
+            regex_source(
                 LR"(<[A-Za-z0-9_\-\.]+[[:space:]]*([A-Za-z0-9_\-\.]+[[:space:]]*=[[:space:]]*[\"'\\]{0,2}[a-zA-Z0-9\-]*[\"'\\]{0,2}[[:space:]]*)+)"),
-            std::wregex(L"charset[[:space:]]*=.*", std::regex_constants::icase),
+            regex_source(L"charset[[:space:]]*=.*", std::regex_constants::icase),
             // all 'X'es, spaces, and commas are usually a placeholder of some sort
-            std::wregex(LR"((([\+\-]?[xX\.]+)[ ,]*)+)"),
+            regex_source(LR"((([\+\-]?[xX\.]+)[ ,]*)+)"),
             // placeholders
-            std::wregex(LR"(asdfs.*)"),
+            regex_source(LR"(asdfs.*)"),
             // program version string
-            std::wregex(LR"([a-zA-Z\-]+ v(ersion)?[ ]?[0-9\.]+)"),
+            regex_source(LR"([a-zA-Z\-]+ v(ersion)?[ ]?[0-9\.]+)"),
             // bash command (e.g., "lpstat -p") and system variables
-            std::wregex(LR"([a-zA-Z]{3,} [\-][a-zA-Z]+)"), std::wregex(LR"(sys[$].*)"),
+            regex_source(LR"([a-zA-Z]{3,} [\-][a-zA-Z]+)"), regex_source(LR"(sys[$].*)"),
             // Pascal-case words (e.g., "GetValueFromUser");
             // surrounding punctuation is stripped first.
-            std::wregex(LR"([[:punct:]]*[A-Z]+[a-z0-9]+([A-Z]+[a-z0-9]+)+[[:punct:]]*)"),
+            regex_source(LR"([[:punct:]]*[A-Z]+[a-z0-9]+([A-Z]+[a-z0-9]+)+[[:punct:]]*)"),
             // camel-case words (e.g., "getValueFromUser", "unencodedExtASCII");
             // surrounding punctuation is stripped first.
-            std::wregex(LR"([[:punct:]]*[a-z]+[[:digit:]]*([A-Z]+[a-z0-9]*)+[[:punct:]]*)"),
-            std::wregex(LR"([[:punct:]]*[a-z]+[[:digit:]]*_([A-Z]+[a-z0-9]*)+[[:punct:]]*)"),
+            regex_source(LR"([[:punct:]]*[a-z]+[[:digit:]]*([A-Z]+[a-z0-9]*)+[[:punct:]]*)"),
+            regex_source(LR"([[:punct:]]*[a-z]+[[:digit:]]*_([A-Z]+[a-z0-9]*)+[[:punct:]]*)"),
             // reverse camel-case (e.g., "UTF8FileWithBOM")
-            std::wregex(LR"([[:punct:]]*[A-Z]+[[:digit:]]*([a-z0-9]+[A-Z]+)+[[:punct:]]*)"),
+            regex_source(LR"([[:punct:]]*[A-Z]+[[:digit:]]*([a-z0-9]+[A-Z]+)+[[:punct:]]*)"),
             // formulas (e.g., ABS(-2.7), POW(-4, 2), =SUM(1; 2) )
-            std::wregex(LR"((=)?[A-Za-z0-9_]{3,}[(]([RC0-9\-\.,;:\[\] ])*[)])"),
+            regex_source(LR"((=)?[A-Za-z0-9_]{3,}[(]([RC0-9\-\.,;:\[\] ])*[)])"),
             // formulas (e.g., ComputeNumbers() )
-            std::wregex(LR"([A-Za-z0-9_]{3,}[(][)])"),
-            std::wregex(LR"([A-Za-z0-9_]{3,}[:]{2}[A-Za-z0-9_]{3,}[(][)])"),
+            regex_source(LR"([A-Za-z0-9_]{3,}[(][)])"),
+            regex_source(LR"([A-Za-z0-9_]{3,}[:]{2}[A-Za-z0-9_]{3,}[(][)])"),
             // equal sign followed by a single word is probably some sort of
             // config file tag or formula.
-            std::wregex(LR"(=[A-Za-z0-9_]+)"),
+            regex_source(LR"(=[A-Za-z0-9_]+)"),
             // character encodings
-            std::wregex(
+            regex_source(
                 LR"((utf[-]?[[:digit:]]+|Shift[-_]JIS|us-ascii|windows-[[:digit:]]{4}|KOI8-R|Big5|GB2312|iso-[[:digit:]]{4}-[[:digit:]]+))",
                 std::regex_constants::icase),
             // wxWidgets constants
-            std::wregex(LR"((wx|WX)[A-Z_0-9]{2,})"),
+            regex_source(LR"((wx|WX)[A-Z_0-9]{2,})"),
             // ODCTask --surrounding punctuation is stripped first
-            std::wregex(LR"([[:punct:]]*[A-Z]{3,}[a-z_0-9]{2,}[[:punct:]]*)"),
+            regex_source(LR"([[:punct:]]*[A-Z]{3,}[a-z_0-9]{2,}[[:punct:]]*)"),
             // snake case words
             // Note that "P_rinter" would be OK, as the '_' may be a hot-key accelerator
-            std::wregex(LR"([_]*[a-z0-9]+(_[a-z0-9]+)+[_]*)"), // user_level_permission
-            std::wregex(LR"([_]*[A-Z0-9]+(_[A-Z0-9]+)+[_]*)"), // __HIGH_SCORE__
-            std::wregex(LR"([_]*[A-Z0-9][a-z0-9]+(_[A-Z0-9][a-z0-9]+)+[_]*)"), // Config_File_Path
+            regex_source(LR"([_]*[a-z0-9]+(_[a-z0-9]+)+[_]*)"), // user_level_permission
+            regex_source(LR"([_]*[A-Z0-9]+(_[A-Z0-9]+)+[_]*)"), // __HIGH_SCORE__
+            regex_source(LR"([_]*[A-Z0-9][a-z0-9]+(_[A-Z0-9][a-z0-9]+)+[_]*)"), // Config_File_Path
             // CSS strings
-            std::wregex(
+            regex_source(
                 LR"(font-(style|weight|family|size|face-name|underline|point-size|variant)[[:space:]]*[:]?.*)",
                 std::regex_constants::icase),
-            std::wregex(
+            regex_source(
                 LR"(border-(block|bottom|color|collapse|right|left|top|collapse|image|inline|start|end|width|style)[[:space:]]*[:]?.*)",
                 std::regex_constants::icase),
-            std::wregex(
+            regex_source(
                 LR"(background-(clip|color|image|origin|position|repeat|size)[[:space:]]*[:]?.*)",
                 std::regex_constants::icase),
-            std::wregex(LR"(padding-(block|inline|left|right|top|bottom)[[:space:]]*[:]?.*)",
-                        std::regex_constants::icase),
-            std::wregex(LR"(page-break[[:space:]]*[:]?.*)", std::regex_constants::icase),
-            std::wregex(LR"(line-(break|height|style|through)[[:space:]]*[:]?.*)",
-                        std::regex_constants::icase),
-            std::wregex(LR"((vertical|horizontal)-align[[:space:]]*[:]?.*)",
-                        std::regex_constants::icase),
-            std::wregex(LR"(flex-(basis|direction|flow|grow|shrink|wrap)[[:space:]]*[:]?.*)",
-                        std::regex_constants::icase),
-            std::wregex(
+            regex_source(LR"(padding-(block|inline|left|right|top|bottom)[[:space:]]*[:]?.*)",
+                         std::regex_constants::icase),
+            regex_source(LR"(page-break[[:space:]]*[:]?.*)", std::regex_constants::icase),
+            regex_source(LR"(line-(break|height|style|through)[[:space:]]*[:]?.*)",
+                         std::regex_constants::icase),
+            regex_source(LR"((vertical|horizontal)-align[[:space:]]*[:]?.*)",
+                         std::regex_constants::icase),
+            regex_source(LR"(flex-(basis|direction|flow|grow|shrink|wrap)[[:space:]]*[:]?.*)",
+                         std::regex_constants::icase),
+            regex_source(
                 LR"(text-(color|background|decoration|align|size|layout|transform|indent|justify|orientation|overflow|underline|shadow|emphasis)[[:space:]]*[:]?.*)",
                 std::regex_constants::icase),
-            std::wregex(LR"((background-)?color[[:space:]]*:.*)", std::regex_constants::icase),
-            std::wregex(LR"(style[[:space:]]*=["']?.*)", std::regex_constants::icase),
+            regex_source(LR"((background-)?color[[:space:]]*:.*)", std::regex_constants::icase),
+            regex_source(LR"(style[[:space:]]*=["']?.*)", std::regex_constants::icase),
             // local file paths & file names
-            std::wregex(LR"((WINDIR|Win32|System32|Kernel32|/etc|/tmp))",
-                        std::regex_constants::icase),
-            std::wregex(LR"((so|dll|exe|dylib|jpg|bmp|png|gif|txt|doc))",
-                        std::regex_constants::icase), // common file extension that might be missing
-                                                      // the period
-            std::wregex(LR"([.][a-zA-Z0-9]{1,5})"),   // file extension
-            std::wregex(LR"([.]DS_Store)"),           // macOS file
+            regex_source(LR"((WINDIR|Win32|System32|Kernel32|/etc|/tmp))",
+                         std::regex_constants::icase),
+            // common file extension that might be missing the period
+            regex_source(LR"((so|dll|exe|dylib|jpg|bmp|png|gif|txt|doc))",
+                         std::regex_constants::icase),
+            regex_source(LR"([.][a-zA-Z0-9]{1,5})"), // file extension
+            regex_source(LR"([.]DS_Store)"),         // macOS file
             // file name (supports multiple extensions)
-            std::wregex(LR"([\\/]?[[:alnum:]_~!@#$%&;',+={}().^\[\]\-]+([.][a-zA-Z0-9]{1,4})+)"),
+            regex_source(LR"([\\/]?[[:alnum:]_~!@#$%&;',+={}().^\[\]\-]+([.][a-zA-Z0-9]{1,4})+)"),
             // ultra simple relative file path (e.g., "shaders/player1.vert")
-            std::wregex(LR"(([[:alnum:]_-]+[\\/]){1,2}[[:alnum:]_-]+([.][a-zA-Z0-9]{1,4})+)"),
-            std::wregex(LR"(\*[.][a-zA-Z0-9]{1,5})"), // wild card file extension
+            regex_source(LR"(([[:alnum:]_-]+[\\/]){1,2}[[:alnum:]_-]+([.][a-zA-Z0-9]{1,4})+)"),
+            regex_source(LR"(\*[.][a-zA-Z0-9]{1,5})"), // wild card file extension
             // UNIX or web folder (needs at least 1 folder in path)
-            std::wregex(LR"((\/{1,2}[[:alnum:]_~!@#$%&;',+={}().^\[\]\-]+){2,}/?)"),
+            regex_source(LR"((\/{1,2}[[:alnum:]_~!@#$%&;',+={}().^\[\]\-]+){2,}/?)"),
             // Windows folder
-            std::wregex(LR"([a-zA-Z][:]([\\]{1,2}[[:alnum:]_~!@#$%&;',+={}().^\[\]\-]*)+)"),
-            std::wregex(LR"(\/?sys\$.*)"),
+            regex_source(LR"([a-zA-Z][:]([\\]{1,2}[[:alnum:]_~!@#$%&;',+={}().^\[\]\-]*)+)"),
+            regex_source(LR"(\/?sys\$.*)"),
             // Debug message
-            std::wregex(LR"(^DEBUG:[\s\S].*)"),
+            regex_source(LR"(^DEBUG:[\s\S].*)"),
             // mail protocols
-            std::wregex(LR"(^(RCPT TO|MAIL TO|MAIL FROM):.*)"),
+            regex_source(LR"(^(RCPT TO|MAIL TO|MAIL FROM):.*)"),
             // GUIDs
-            std::wregex(
+            regex_source(
                 LR"(^(CLSID[\\]{1,2})?[\{]?[a-fA-F0-9]{8}\-[a-fA-F0-9]{4}\-[a-fA-F0-9]{4}\-[a-fA-F0-9]{4}\-[a-fA-F0-9]{12}[\}]?$)"),
-            std::wregex(LR"(CLSID[\\]{1,2}.*)"),
+            regex_source(LR"(CLSID[\\]{1,2}.*)"),
             // encoding
-            std::wregex(LR"(^(base[0-9]+|uuencode|quoted-printable)$)"),
-            std::wregex(LR"(^(250\-AUTH)$)"),
+            regex_source(LR"(^(base[0-9]+|uuencode|quoted-printable)$)"),
+            regex_source(LR"(^(250\-AUTH)$)"),
             // MIME types
-            std::wregex(LR"((application|text)\/(x\-)?[a-z\-]+)"),
-            std::wregex(LR"(application\/(x\-)?[a-z\-]+\+[a-z\-]+)"),
-            std::wregex(LR"(image\/(x\-)?[a-z\-]+)"), std::wregex(LR"(video\/(x\-)?[a-z\-]+)"),
+            regex_source(LR"((application|text)\/(x\-)?[a-z\-]+)"),
+            regex_source(LR"(application\/(x\-)?[a-z\-]+\+[a-z\-]+)"),
+            regex_source(LR"(image\/(x\-)?[a-z\-]+)"), regex_source(LR"(video\/(x\-)?[a-z\-]+)"),
             // MIME headers
-            std::wregex(LR"(^MIME-Version:.*)"), std::wregex(LR"(^X-Priority:.*)"),
-            std::wregex(
+            regex_source(LR"(^MIME-Version:.*)"), regex_source(LR"(^X-Priority:.*)"),
+            regex_source(
                 LR"(^(application\/octet-stream|video\/([:alnum:]+)|audio\/([:alnum:]+)|image\/([:alnum:]+)|text\/(css|csv|plain|html|xml|rawdata|javascript))$)"),
-            std::wregex(LR"(.*\bContent-Type:[[:space:]]*[[:alnum:]]+/[[:alnum:]]+;.*)"),
-            std::wregex(LR"(.*\bContent-Transfer-Encoding:[[:space:]]*[[:alnum:]]+.*)"),
+            regex_source(LR"(.*\bContent-Type:[[:space:]]*[[:alnum:]]+/[[:alnum:]]+;.*)"),
+            regex_source(LR"(.*\bContent-Transfer-Encoding:[[:space:]]*[[:alnum:]]+.*)"),
             // URL
-            std::wregex(
+            regex_source(
                 LR"(((http|ftp)s?:\/\/)?(www\.)[-a-zA-Z0-9@:%._\+~#=]{1,256}\.[a-zA-Z0-9()]{1,6}\b([-a-zA-Z0-9()@:%_\+.~#?&//=]*))"),
             // HTTP requests
-            std::wregex(LR"(Sec[-]Fetch[-]Mode|User[-]Agent)"),
+            regex_source(LR"(Sec[-]Fetch[-]Mode|User[-]Agent)"),
             // email address
-            std::wregex(
+            regex_source(
                 LR"(^[a-zA-Z0-9.!#$%&'*+/=?^_`{|}~-]+@[a-zA-Z0-9](?:[a-zA-Z0-9-]{0,61}[a-zA-Z0-9])?(?:\.[a-zA-Z0-9](?:[a-zA-Z0-9-]{0,61}[a-zA-Z0-9])?)*$)"),
-            std::wregex(
+            regex_source(
                 LR"(^[\w ]*<[a-zA-Z0-9.!#$%&'*+/=?^_`{|}~-]+@[a-zA-Z0-9](?:[a-zA-Z0-9-]{0,61}[a-zA-Z0-9])?(?:\.[a-zA-Z0-9](?:[a-zA-Z0-9-]{0,61}[a-zA-Z0-9])?)*>$)"),
-            std::wregex(LR"(urn[:][a-zA-Z0-9]+.*)"),
+            regex_source(LR"(urn[:][a-zA-Z0-9]+.*)"),
             // Windows HTML clipboard data
-            std::wregex(LR"(.*(End|Start)(HTML|Fragment)[:]?[[:digit:]]*.*)"),
+            regex_source(LR"(.*(End|Start)(HTML|Fragment)[:]?[[:digit:]]*.*)"),
             // printer commands (e.g., @PAGECOUNT@)
-            std::wregex(LR"(@[A-Z0-9]+@)"),
+            regex_source(LR"(@[A-Z0-9]+@)"),
             // [CMD]
-            std::wregex(LR"(\[[A-Z0-9]+\])"),
+            regex_source(LR"(\[[A-Z0-9]+\])"),
             // Windows OS names
-            std::wregex(
+            regex_source(
                 LR"((Microsoft )?Windows (95|98|NT|ME|2000|Server|Vista|Longhorn|XP|[[:digit:]]{1,2}[.]?[[:digit:]]{0,2})[[:space:]]*[[:digit:]]{0,4}[[:space:]]*(R|SP)?[[:digit:]]{0,2})"),
             // products and standards
-            std::wregex(LR"(UTF[-](8|16|32)(BE|LE)?)"),
-            std::wregex(LR"(Pentium( (II|III|M|Xeon|Pro))?)"),
-            std::wregex(LR"((Misra|MISRA) C( [0-9]+)?)"),
-            std::wregex(LR"(Borland C\+\+ Builder( [0-9]+)?)"), std::wregex(LR"(Qt Creator)"),
-            std::wregex(LR"((Microsoft )VS Code)"), std::wregex(LR"((Microsoft )?Visual Studio)"),
-            std::wregex(LR"((Microsoft )?Visual C\+\+)"),
-            std::wregex(LR"((Microsoft )?Visual Basic)"), std::wregex(LR"(GNU gdb debugger)"),
+            regex_source(LR"(UTF[-](8|16|32)(BE|LE)?)"),
+            regex_source(LR"(Pentium( (II|III|M|Xeon|Pro))?)"),
+            regex_source(LR"((Misra|MISRA) C( [0-9]+)?)"),
+            regex_source(LR"(Borland C\+\+ Builder( [0-9]+)?)"), regex_source(LR"(Qt Creator)"),
+            regex_source(LR"((Microsoft )VS Code)"), regex_source(LR"((Microsoft )?Visual Studio)"),
+            regex_source(LR"((Microsoft )?Visual C\+\+)"),
+            regex_source(LR"((Microsoft )?Visual Basic)"), regex_source(LR"(GNU gdb debugger)"),
             // culture language tags
-            std::wregex(LR"([a-z]{2,3}[\-_][A-Z]{2,3})"),
+            regex_source(LR"([a-z]{2,3}[\-_][A-Z]{2,3})"),
             // image formats
-            std::wregex(LR"(TARGA|PNG|JPEG|JPG|BMP|GIF)")
+            regex_source(LR"(TARGA|PNG|JPEG|JPG|BMP|GIF)")
         };
 
         // functions/macros that indicate that a string will be localizable
-        m_localization_functions = {
+        rules->m_localization_functions = {
             // GNU's gettext C/C++ functions
             L"_", L"gettext", L"dgettext", L"ngettext", L"dngettext", L"pgettext", L"dpgettext",
             L"npgettext", L"dnpgettext", L"dcgettext",
@@ -787,21 +725,21 @@ namespace i18n_check
 
         // note that tr (in Qt) takes an optional disambiguation argument, but because its
         // optional we don't include it in this list
-        m_localization_with_context_functions = { _DT(L"translate"),
-                                                  L"i18nc",
-                                                  L"i18ncp",
-                                                  L"ki18ncp",
-                                                  L"ki18nc",
-                                                  L"QApplication::translate",
-                                                  L"QCoreApplication::translate",
-                                                  L"QT_TRANSLATE_NOOP",
-                                                  L"wxTRANSLATE_IN_CONTEXT",
-                                                  L"wxGETTEXT_IN_CONTEXT_PLURAL",
-                                                  L"wxGETTEXT_IN_CONTEXT",
-                                                  L"wxGetTranslation" };
+        rules->m_localization_with_context_functions = { _DT(L"translate"),
+                                                         L"i18nc",
+                                                         L"i18ncp",
+                                                         L"ki18ncp",
+                                                         L"ki18nc",
+                                                         L"QApplication::translate",
+                                                         L"QCoreApplication::translate",
+                                                         L"QT_TRANSLATE_NOOP",
+                                                         L"wxTRANSLATE_IN_CONTEXT",
+                                                         L"wxGETTEXT_IN_CONTEXT_PLURAL",
+                                                         L"wxGETTEXT_IN_CONTEXT",
+                                                         L"wxGetTranslation" };
 
         // functions that indicate that a string is explicitly marked to not be translatable
-        m_non_localizable_functions = {
+        rules->m_non_localizable_functions = {
             L"_DT", L"DONTTRANSLATE",
             // these are not defined explicitly in gettext, but their documentation suggests
             // that you can add them as defines in your code and use them
@@ -811,7 +749,7 @@ namespace i18n_check
         // Constructors and macros that should be ignored
         // (when backtracing, these are skipped over, and the parser moves to the
         //  function/variable assignment to the left of these).
-        m_ctors_to_ignore = {
+        rules->m_ctors_to_ignore = {
             // Win32 text macros that should be skipped over
             L"_T", L"TEXT", L"_TEXT", L"__TEXT", L"_WIDE", L"W",
             // macOS
@@ -843,7 +781,7 @@ namespace i18n_check
         // Debugging, system call, and other internal functions that should never have
         // their string parameters translated. This can also include resource
         // loading functions that take a string ID.
-        m_internal_functions = {
+        rules->m_internal_functions = {
             // Java resource/key functions
             L"getBundle", L"getObject", L"handleGetObject", L"getString", L"getStringArray",
             L"containsKey",
@@ -978,7 +916,7 @@ namespace i18n_check
             L"asm"
         };
 
-        m_log_functions = {
+        rules->m_log_functions = {
             // wxWidgets
             L"wxLogLastError", L"wxLogError", L"wxLogFatalError", L"wxLogGeneric", L"wxLogMessage",
             L"wxLogStatus", L"wxLogStatus", L"wxLogSysError", L"wxLogTrace", L"wxLogTrace",
@@ -1011,7 +949,7 @@ namespace i18n_check
             L"log_message", L"outLog", L"Error", L"AppendLog", L"DBG_PRINT"
         };
 
-        m_exceptions = {
+        rules->m_exceptions = {
             // std exceptions
             L"logic_error", L"std::logic_error", L"domain_error", L"std::domain_error",
             L"length_error", L"std::length_error", L"out_of_range", L"std::out_of_range",
@@ -1030,42 +968,191 @@ namespace i18n_check
         };
 
         // known strings to ignore
-        m_known_internal_strings = { L"size-points", L"background-gdk", L"foreground-gdk",
-                                     L"foreground-set", L"background-set", L"weight-set",
-                                     L"style-set", L"underline-set", L"size-set", L"charset",
-                                     L"xml", L"gdiplus", L"Direct2D", L"DirectX", L"localhost",
-                                     L"32 bit", L"32-bit", L"64 bit", L"64-bit", L"NULL",
-                                     // build types
-                                     L"DEBUG", L"NDEBUG",
-                                     // RTF font families
-                                     L"fnil", L"fdecor", L"froman", L"fscript", L"fswiss",
-                                     L"fmodern", L"ftech",
-                                     // common UNIX names (Windows versions are handled by more
-                                     // complex regex expressions elsewhere)
-                                     L"UNIX", L"macOS", L"Apple Mac OS", L"Apple Mac OS X", L"OSX",
-                                     L"Linux", L"FreeBSD", L"POSIX", L"NetBSD" };
+        rules->m_known_internal_strings = {
+            L"size-points", L"background-gdk", L"foreground-gdk", L"foreground-set",
+            L"background-set", L"weight-set", L"style-set", L"underline-set", L"size-set",
+            L"charset", L"xml", L"gdiplus", L"Direct2D", L"DirectX", L"localhost", L"32 bit",
+            L"32-bit", L"64 bit", L"64-bit", L"NULL",
+            // build types
+            L"DEBUG", L"NDEBUG",
+            // RTF font families
+            L"fnil", L"fdecor", L"froman", L"fscript", L"fswiss", L"fmodern", L"ftech",
+            // common UNIX names (Windows versions are handled by more
+            // complex regex expressions elsewhere)
+            L"UNIX", L"macOS", L"Apple Mac OS", L"Apple Mac OS X", L"OSX", L"Linux", L"FreeBSD",
+            L"POSIX", L"NetBSD"
+        };
 
         // keywords in the language that can appear in front of a string only
-        m_keywords = { L"return", L"else", L"if", L"goto", L"new", L"delete", L"throw" };
-
-        add_variable_name_pattern_to_ignore(
-            std::wregex(LR"(^debug.*)", std::regex_constants::icase));
-        add_variable_name_pattern_to_ignore(
-            std::wregex(LR"(^stacktrace.*)", std::regex_constants::icase));
-        add_variable_name_pattern_to_ignore(
-            std::wregex(LR"(([[:alnum:]_\-])*xpm)", std::regex_constants::icase));
-        add_variable_name_pattern_to_ignore(
-            std::wregex(LR"(xpm([[:alnum:]_\-])*)", std::regex_constants::icase));
-        add_variable_name_pattern_to_ignore(
-            std::wregex(LR"((sql|db|database)(Table|Update|Query|Command|Upgrade)?[[:alnum:]_\-]*)",
-                        std::regex_constants::icase));
-        add_variable_name_pattern_to_ignore(std::wregex(LR"(log)"));
-        add_variable_name_pattern_to_ignore(std::wregex(LR"([Cc]ommand(_)?[Ss]tring)"));
-        add_variable_name_pattern_to_ignore(std::wregex(LR"(wxColourDialogNames)"));
-        add_variable_name_pattern_to_ignore(std::wregex(LR"(wxColourTable)"));
-        add_variable_name_pattern_to_ignore(std::wregex(LR"(QT_MESSAGE_PATTERN)"));
-        // console objects
-        add_variable_name_pattern_to_ignore(std::wregex(LR"((std::)?[w]?(cout|cerr))"));
+        rules->m_keywords = { L"return", L"else", L"if", L"goto", L"new", L"delete", L"throw" };
+
+        // common font faces that we would usually ignore (client can add to this)
+        rules->m_font_names = {
+            L"Arial",
+            L"Seaford",
+            L"Skeena",
+            L"Tenorite",
+            L"Courier New",
+            L"Garamond",
+            L"Calibri",
+            L"Gabriola",
+            L".Helvetica Neue DeskInterface",
+            L".Lucida Grande UI",
+            L"Times New Roman",
+            L"Georgia",
+            L"Segoe UI",
+            L"Segoe Script",
+            L"Century Gothic",
+            L"Century",
+            L"Cascadia Mono",
+            L"URW Bookman L",
+            L"AR Berkley",
+            L"Brush Script",
+            L"Consolas",
+            L"Century Schoolbook L",
+            L"Lucida Grande",
+            L"Helvetica Neue",
+            L"Liberation Serif",
+            L"Sans Serif",
+            L"Luxi Serif",
+            L"MS Sans Serif",
+            L"Microsoft Sans Serif",
+            L"Ms Shell Dlg",
+            L"Ms Shell Dlg 2",
+            L"Bitstream Vera Serif",
+            L"URW Palladio L",
+            L"URW Chancery L",
+            L"Comic Sans MS",
+            L"DejaVu Serif",
+            L"DejaVu LGC Serif",
+            L"Nimbus Sans L",
+            L"URW Gothic L",
+            L"Lucida Sans",
+            L"Andale Mono",
+            L"Luxi Sans",
+            L"Liberation Sans",
+            L"Bitstream Vera Sans",
+            L"DejaVu LGC Sans",
+            L"DejaVu Sans",
+            L"Nimbus Mono L",
+            L"Lucida Sans Typewriter",
+            L"Luxi Mono",
+            L"DejaVu Sans Mono",
+            L"DejaVu LGC Sans Mono",
+            L"Bitstream Vera Sans Mono",
+            L"Liberation Mono",
+            L"Franklin Gothic",
+            L"Aptos",
+            L"Grandview",
+            L"Bierstadt",
+            L"Tahoma",
+            L"MingLiU",
+            L"MS PGothic",
+            L"Gulim",
+            L"NSimSun"
+        };
+
+        // documents
+        rules->m_file_extensions = {
+            L"xml", L"html", L"htm", L"xhtml", L"rtf", L"doc", L"docx", L"dot", L"docm", L"txt",
+            L"ppt", L"pptx", L"pdf", L"ps", L"odt", L"ott", L"odp", L"otp", L"pptm", L"md", L"xaml",
+            // Visual Studio files
+            L"sln", L"csproj", L"json", L"pbxproj", L"apk", L"tlb", L"ocx", L"pdb", L"tlh", L"hlp",
+            L"msi", L"rc", L"vcxproj", L"resx", L"appx", L"vcproj",
+            // macOS
+            L"dmg", L"proj", L"xbuild", L"xmlns",
+            // Database
+            L"mdb", L"db",
+            // Markdown files
+            L"md", L"Rmd", L"qmd", L"yml",
+            // help files
+            L"hhc", L"hhk", L"hhp",
+            // spreadsheets
+            L"xls", L"xlsx", L"ods", L"csv",
+            // image formats
+            L"gif", L"jpg", L"jpeg", L"jpe", L"bmp", L"tiff", L"tif", L"png", L"tga", L"svg",
+            L"xcf", L"ico", L"psd", L"hdr", L"pcx",
+            // webpages
+            L"asp", L"aspx", L"cfm", L"cfml", L"php", L"php3", L"php4", L"sgml", L"wmf", L"js",
+            // style sheets
+            L"css",
+            // movies
+            L"mov", L"qt", L"rv", L"rm", L"wmv", L"mpg", L"mpeg", L"mpe", L"avi",
+            // music
+            L"mp3", L"wav", L"wma", L"midi", L"ra", L"ram",
+            // programs
+            L"exe", L"swf", L"vbs",
+            // source files
+            L"cpp", L"h", L"c", L"idl", L"cs", L"hpp", L"po",
+            // compressed files
+            L"gzip", L"bz2"
+        };
+
+        rules->m_untranslatable_exceptions = { L"PhD" };
+
+        // variables whose CTORs take a string that should never be translated
+        rules->m_variable_types_to_ignore = {
+            L"wxUxThemeHandle",
+            L"wxRegKey",
+            L"wxXmlNode",
+            L"wxLoadedDLL",
+            L"wxConfigPathChanger",
+            L"wxWebViewEvent",
+            L"wxFileSystemWatcherEvent",
+            L"wxStdioPipe",
+            L"wxCMD_LINE_CHARS_ALLOWED_BY_SHORT_OPTION",
+            L"vmsWarningHandler",
+            L"vmsErrorHandler",
+            L"wxFFileOutputStream",
+            L"wxFFile",
+            L"wxFileName",
+            L"wxColor",
+            L"wxColour",
+            L"wxFont",
+            L"LOGFONTW",
+            L"Font",
+            L"SecretSchema",
+            L"GtkTypeInfo",
+            L"QKeySequence",
+            L"wxRegEx",
+            L"wregex",
+            L"std::wregex",
+            L"regex",
+            L"std::regex",
+            L"Regex",
+            L"ifstream",
+            L"ofstream",
+            L"FileStream",
+            L"StreamWriter",
+            L"CultureInfo",
+            L"TagHelperAttribute",
+            L"QRegularExpression",
+            L"wxDataViewRenderer",
+            L"wxDataViewBitmapRenderer",
+            L"wxDataViewDateRenderer",
+            L"wxDataViewTextRenderer",
+            L"wxDataViewIconTextRenderer",
+            L"wxDataViewCustomRenderer",
+            L"wxDataViewToggleRenderer",
+            L"wxDataObjectSimple"
+        };
+
+        rules->m_variable_name_patterns_to_ignore = {
+            regex_pattern(LR"(^debug.*)", std::regex_constants::icase),
+            regex_pattern(LR"(^stacktrace.*)", std::regex_constants::icase),
+            regex_pattern(LR"(([[:alnum:]_\-])*xpm)", std::regex_constants::icase),
+            regex_pattern(LR"(xpm([[:alnum:]_\-])*)", std::regex_constants::icase),
+            regex_pattern(
+                LR"((sql|db|database)(Table|Update|Query|Command|Upgrade)?[[:alnum:]_\-]*)",
+                std::regex_constants::icase),
+            regex_pattern(LR"(log)"), regex_pattern(LR"([Cc]ommand(_)?[Ss]tring)"),
+            regex_pattern(LR"(wxColourDialogNames)"), regex_pattern(LR"(wxColourTable)"),
+            regex_pattern(LR"(QT_MESSAGE_PATTERN)"),
+            // console objects
+            regex_pattern(LR"((std::)?[w]?(cout|cerr))")
+        };
+
+        return rules;
         }
 
     //--------------------------------------------------
@@ -1123,135 +1210,178 @@ namespace i18n_check
         {
         process_strings();
 
-        std::wsmatch results;
-        for (const auto& str : m_localizable_strings)
+        // the flagged strings are added to the other categories by their index,
+        // rather than being copied
+        for (const auto index : get_result_indices(result_category::localizable))
             {
-            const auto [isunTranslatable, translatableContentLength] =
-                is_untranslatable_string(str.m_string, false);
+            const auto& str = m_results.get_record(index);
+            // shared by the excessive content check
+            const auto [isunTranslatable, translatableContentLength] = I18N_PROFILED(
+                m_profile, check_l10n_strings, classify_untranslatable_string(str.m_string, false));
             if ((m_review_styles & check_l10n_contains_excessive_nonl10n_content) &&
                 !isunTranslatable && str.m_string.length() > (translatableContentLength * 3) &&
                 !str.m_usage.m_hasContext)
                 {
-                m_localizable_strings_with_unlocalizable_content.push_back(str);
+                add_result_to_category(result_category::with_unlocalizable_content, index);
                 }
             if ((m_review_styles & check_l10n_strings) && str.m_string.length() > 0 &&
                 isunTranslatable)
                 {
-                m_unsafe_localizable_strings.push_back(str);
+                add_result_to_category(result_category::unsafe_localizable, index);
                 }
-            if ((m_review_styles & check_multipart_strings) && is_string_multipart(str.m_string))
+            if ((m_review_styles & check_multipart_strings) &&
+                I18N_PROFILED(m_profile, check_multipart_strings,
+                              classify_string(str.m_string, string_verdict::multipart,
+                                              [&str]()
+                                              { return is_string_multipart(str.m_string); })))
                 {
-                m_multipart_strings.push_back(str);
+                add_result_to_category(result_category::multipart, index);
                 }
-            if ((m_review_styles & check_pluaralization) && is_string_resource_faux_plural(str))
+            if ((m_review_styles & check_pluaralization) &&
+                I18N_PROFILED(m_profile, check_pluaralization, is_string_resource_faux_plural(str)))
                 {
-                m_faux_plural_strings.push_back(str);
+                add_result_to_category(result_category::faux_plural, index);
                 }
             if ((m_review_styles & check_articles_proceeding_placeholder) &&
-                (is_string_article_issue(str.m_string) || is_string_pronoun(str.m_string)))
+                I18N_PROFILED(m_profile, check_articles_proceeding_placeholder,
+                              (is_string_article_issue(str.m_string) ||
+                               is_string_pronoun(str.m_string))))
                 {
-                m_article_issue_strings.push_back(str);
+                add_result_to_category(result_category::article_issue, index);
                 }
             if ((m_review_styles & check_l10n_contains_url) &&
-                (std::regex_search(str.m_string, results, m_url_email_regex) ||
-                 std::regex_search(str.m_string, results, m_us_phone_number_regex) ||
-                 std::regex_search(str.m_string, results, m_non_us_phone_number_regex)))
+                I18N_PROFILED(m_profile, check_l10n_contains_url,
+                              classify_string(str.m_string, string_verdict::url,
+                                              [&str]()
+                                              {
+                                                  return (
+                                                      m_url_email_regex.search(str.m_string) ||
+                                                      m_us_phone_number_regex.search(
+                                                          str.m_string) ||
+                                                      m_non_us_phone_number_regex.search(
+                                                          str.m_string));
+                                              })))
                 {
-                m_localizable_strings_with_urls.push_back(str);
+                add_result_to_category(result_category::with_urls, index);
                 }
             if ((m_review_styles & check_needing_context) && !str.m_usage.m_hasContext &&
-                is_string_ambiguous(str.m_string))
+                I18N_PROFILED(m_profile, check_needing_context,
+                              classify_string(str.m_string, string_verdict::ambiguous,
+                                              [&str]()
+                                              { return is_string_ambiguous(str.m_string); })))
                 {
-                m_localizable_strings_ambiguous_needing_context.push_back(str);
+                add_result_to_category(result_category::ambiguous_needing_context, index);
                 }
             if ((m_review_styles & check_l10n_concatenated_strings) &&
-                (has_surrounding_spaces(str.m_string) || is_concatenated_localizable_operator(str)))
+                I18N_PROFILED(m_profile, check_l10n_concatenated_strings,
+                              (has_surrounding_spaces(str.m_string) ||
+                               is_concatenated_localizable_operator(str))))
                 {
-                m_localizable_strings_being_concatenated.push_back(str);
+                add_result_to_category(result_category::being_concatenated, index);
                 }
             if ((m_review_styles & check_halfwidth) &&
-                !load_matches(str.m_string, m_halfwidth_range_regex).empty())
+                I18N_PROFILED(m_profile, check_halfwidth,
+                              !load_matches(str.m_string, m_halfwidth_range_regex).empty()))
                 {
-                m_localizable_strings_with_halfwidths.push_back(str);
+                add_result_to_category(result_category::with_halfwidths, index);
                 }
             }
 
         if ((m_review_styles & check_l10n_concatenated_strings))
             {
-            for (const auto& str : m_internal_strings)
+            I18N_PROFILE_SCOPE(m_profile, check_l10n_concatenated_strings,
+                               get_results(result_category::internal).size());
+            for (const auto index : get_result_indices(result_category::internal))
                 {
                 // Hard coding a percent to a number at runtime should be avoided,
                 // as some locales put the % at the front of the string.
                 // Same with a dollar sign, where it is probably a currency string
                 // being pieced together.
-                if (is_concatenated_localizable_operator(str))
+                if (is_concatenated_localizable_operator(m_results.get_record(index)))
                     {
-                    m_localizable_strings_being_concatenated.push_back(str);
+                    add_result_to_category(result_category::being_concatenated, index);
                     }
                 }
             }
 
         if (m_review_styles & check_malformed_strings)
             {
-            const auto& classifyMalformedStrings = [this](const auto& strings)
+            I18N_PROFILE_SCOPE(m_profile, check_malformed_strings,
+                               get_results(result_category::localizable).size() +
+                                   get_results(result_category::marked_as_non_localizable).size() +
+                                   get_results(result_category::internal).size() +
+                                   get_results(result_category::not_available_for_localization)
+                                       .size());
+            const auto& classifyMalformedStrings = [this](const result_category category)
             {
-                for (const auto& str : strings)
+                for (const auto index : get_result_indices(category))
                     {
-                    if (std::regex_search(str.m_string, m_malformed_html_tag) ||
-                        std::regex_search(str.m_string, m_malformed_html_tag_bad_amp))
+                    const auto& str = m_results.get_record(index);
+                    if (m_malformed_html_tag.search(str.m_string) ||
+                        m_malformed_html_tag_bad_amp.search(str.m_string))
                         {
-                        m_malformed_strings.push_back(str);
+                        add_result_to_category(result_category::malformed, index);
                         }
                     }
             };
 
-            classifyMalformedStrings(m_localizable_strings);
-            classifyMalformedStrings(m_marked_as_non_localizable_strings);
-            classifyMalformedStrings(m_internal_strings);
-            classifyMalformedStrings(m_not_available_for_localization_strings);
+            classifyMalformedStrings(result_category::localizable);
+            classifyMalformedStrings(result_category::marked_as_non_localizable);
+            classifyMalformedStrings(result_category::internal);
+            classifyMalformedStrings(result_category::not_available_for_localization);
             }
 
         if (m_review_styles & check_unencoded_ext_ascii)
             {
-            const auto& classifyUnencodedStrings = [this](const auto& strings)
+            I18N_PROFILE_SCOPE(m_profile, check_unencoded_ext_ascii,
+                               get_results(result_category::localizable).size() +
+                                   get_results(result_category::marked_as_non_localizable).size() +
+                                   get_results(result_category::internal).size() +
+                                   get_results(result_category::not_available_for_localization)
+                                       .size());
+            const auto& classifyUnencodedStrings = [this](const result_category category)
             {
-                for (const auto& str : strings)
+                for (const auto index : get_result_indices(category))
                     {
-                    for (const auto& ch : str.m_string)
+                    for (const auto& ch : m_results.get_record(index).m_string)
                         {
                         if (ch >= 128)
                             {
-                            m_unencoded_strings.push_back(str);
+                            add_result_to_category(result_category::unencoded, index);
                             break;
                             }
                         }
                     }
             };
 
-            classifyUnencodedStrings(m_localizable_strings);
-            classifyUnencodedStrings(m_marked_as_non_localizable_strings);
-            classifyUnencodedStrings(m_internal_strings);
-            classifyUnencodedStrings(m_not_available_for_localization_strings);
+            classifyUnencodedStrings(result_category::localizable);
+            classifyUnencodedStrings(result_category::marked_as_non_localizable);
+            classifyUnencodedStrings(result_category::internal);
+            classifyUnencodedStrings(result_category::not_available_for_localization);
             }
 
         if (m_review_styles & check_printf_single_number)
             {
+            I18N_PROFILE_SCOPE(m_profile, check_printf_single_number,
+                               get_results(result_category::internal).size() +
+                                   get_results(result_category::in_internal_call).size());
             // only looking at integral values (i.e., no floating-point precision)
             std::wregex intPrintf{ LR"([%]([+]|[-] #0)?(l)?(d|i|o|u|zu|c|C|e|E|x|X|l|I|I32|I64))" };
             std::wregex floatPrintf{ LR"([%]([+]|[-] #0)?(l|L)?(f|F))" };
-            const auto& classifyPrintfIntStrings = [&, this](const auto& strings)
+            const auto& classifyPrintfIntStrings = [&, this](const result_category category)
             {
-                for (const auto& str : strings)
+                for (const auto index : get_result_indices(category))
                     {
+                    const auto& str = m_results.get_record(index);
                     if (std::regex_match(str.m_string, intPrintf) ||
                         std::regex_match(str.m_string, floatPrintf))
                         {
-                        m_printf_single_numbers.push_back(str);
+                        add_result_to_category(result_category::printf_single_numbers, index);
                         }
                     }
             };
-            classifyPrintfIntStrings(m_internal_strings);
-            classifyPrintfIntStrings(m_localizable_strings_in_internal_call);
+            classifyPrintfIntStrings(result_category::internal);
+            classifyPrintfIntStrings(result_category::in_internal_call);
             }
 
         // if this is wxWidgets code, see if they initialized the locale framework
@@ -1263,14 +1393,14 @@ namespace i18n_check
                 m_wx_info.m_app_init_info.m_usage.m_value =
                     _WXTRANS_WSTR(L"wxUILocale::UseDefault() should be called "
                                   "from your OnInit() function.");
-                m_suspect_i18n_usage.push_back(m_wx_info.m_app_init_info);
+                add_result(result_category::suspect_i18n_usage, m_wx_info.m_app_init_info);
                 }
             if (is_verbose() && !m_wx_info.m_wxlocale_initialized)
                 {
                 m_wx_info.m_app_init_info.m_usage.m_value =
                     _WXTRANS_WSTR(L"A wxLocale object should be constructed from your OnInit() "
                                   "function if you rely on C runtime functions to be localized.");
-                m_suspect_i18n_usage.push_back(m_wx_info.m_app_init_info);
+                add_result(result_category::suspect_i18n_usage, m_wx_info.m_app_init_info);
                 }
             }
 
@@ -1283,24 +1413,25 @@ namespace i18n_check
         {
         if (m_review_styles & check_not_available_for_l10n)
             {
+            I18N_PROFILE_SCOPE(m_profile, check_not_available_for_l10n, 1);
             if (!should_exceptions_be_translatable() &&
-                (m_exceptions.find(str.m_usage.m_value) != m_exceptions.cend() ||
-                 m_exceptions.find(str.m_usage.m_variableInfo.m_type) != m_exceptions.cend()))
+                (m_rules->m_exceptions.contains(str.m_usage.m_value) ||
+                 m_rules->m_exceptions.contains(str.m_usage.m_variableInfo.m_type)))
                 {
                 return;
                 }
-            if (m_log_functions.find(str.m_usage.m_value) != m_log_functions.cend())
+            if (m_rules->m_log_functions.contains(str.m_usage.m_value))
                 {
                 return;
                 }
 
-            if (is_untranslatable_string(str.m_string, true).first)
+            if (classify_untranslatable_string(str.m_string, true).first)
                 {
-                m_internal_strings.push_back(str);
+                add_result(result_category::internal, std::move(str));
                 }
             else
                 {
-                m_not_available_for_localization_strings.push_back(str);
+                add_result(result_category::not_available_for_localization, std::move(str));
                 }
             }
         }
@@ -1327,66 +1458,154 @@ namespace i18n_check
         }
 
     //--------------------------------------------------
-    void i18n_review::load_deprecated_functions(const std::wstring_view fileText,
+    //--------------------------------------------------
+    void i18n_review::release_scratch()
+        {
+#ifdef QUNEIFORM_PROFILING
+        if (m_profile != nullptr)
+            {
+            m_profile->add_scratch_usage(m_scratch.get_allocation_count(),
+                                         m_scratch.get_heap_allocation_count());
+            }
+#endif
+        m_scratch.reset();
+        }
+
+    //--------------------------------------------------
+    void i18n_review::load_deprecated_functions(const token_stream& tokens,
                                                 const std::filesystem::path& fileName)
         {
         if (!static_cast<bool>(m_review_styles & check_deprecated_macros))
             {
             return;
             }
-
-        for (size_t i = 0; i < fileText.length(); /* in loop*/)
+        I18N_PROFILE_SCOPE(m_profile, check_deprecated_macros, 1);
+
+        // Gather the whole-word occurrences that have something after them.
+        // A few functions are listed with punctuation around their names (e.g., "*wxConvCurrent"),
+        // so those are compared against the text around the name. These can overlap,
+        // so sort them by where they start (preferring the first function in the map)
+        // and skip any that overlap the previous one.
+        const std::wstring_view fileText{ tokens.get_text() };
+        // the position, the function's order in the map, and the function
+        std::pmr::vector<std::tuple<size_t, size_t, std::wstring_view>> matches{
+            m_scratch.get_resource()
+        };
+        for (const auto& token : tokens)
             {
-            for (const auto& func : m_deprecated_string_functions)
+            if (token.m_type != token_stream::token_type::identifier)
+                {
+                continue;
+                }
+            const auto funcs = m_rules->m_deprecated_function_names.find(tokens.get_text(token));
+            if (funcs == m_rules->m_deprecated_function_names.cend())
+                {
+                continue;
+                }
+            for (const auto& func : funcs->second)
                 {
-                if (fileText.substr(i, func.first.length()).compare(func.first) == 0 &&
-                    // ensure function is a whole-word match and has something after it
-                    (i + func.first.length() < fileText.length() &&
-                     !is_valid_name_char(fileText[i + func.first.length()])) &&
-                    (i == 0 || !is_valid_name_char(fileText[i - 1])))
+                if (token.m_position < func.m_prefix_length)
                     {
-                    m_deprecated_macros.push_back(string_info(
-                        std::wstring{ func.first.data(), func.first.length() },
-                        string_info::usage_info(string_info::usage_info::usage_type::function,
-                                                std::wstring(func.second), std::wstring{},
-                                                std::wstring{}),
-                        fileName, get_line_and_column(i, fileText.data())));
-                    i += func.first.length();
                     continue;
                     }
+                const size_t funcStart{ token.m_position - func.m_prefix_length };
+                const size_t funcEnd{ funcStart + func.m_function.length() };
+                if (funcEnd < fileText.length() && !is_valid_name_char(fileText[funcEnd]) &&
+                    (funcStart == 0 || !is_valid_name_char(fileText[funcStart - 1])) &&
+                    fileText.substr(funcStart, func.m_function.length()) == func.m_function)
+                    {
+                    matches.emplace_back(funcStart, func.m_order, func.m_function);
+                    }
                 }
-            ++i;
+            }
+        std::sort(matches.begin(), matches.end());
+
+        size_t nextPosition{ 0 };
+        for (const auto& [position, functionOrder, func] : matches)
+            {
+            if (position < nextPosition)
+                {
+                continue;
+                }
+            const auto suggestion = m_rules->m_deprecated_string_functions.find(func);
+            assert(suggestion != m_rules->m_deprecated_string_functions.cend());
+            add_result(result_category::deprecated_macros,
+                       std::wstring{ func.data(), func.length() },
+                       string_info::usage_info(string_info::usage_info::usage_type::function,
+                                               std::wstring(suggestion->second), std::wstring{},
+                                               std::wstring{}),
+                       fileName, get_line_and_column(position, fileText.data()));
+            nextPosition = position + func.length();
             }
         }
 
     //--------------------------------------------------
-    void i18n_review::load_suspect_i18n_ussage(const std::wstring_view fileText,
+    void i18n_review::load_suspect_i18n_ussage(const token_stream& tokens,
                                                const std::filesystem::path& fileName)
         {
         if (!static_cast<bool>(m_review_styles & check_suspect_i18n_usage))
             {
             return;
             }
+        I18N_PROFILE_SCOPE(m_profile, check_suspect_i18n_usage, 1);
+
+        const std::wstring_view fileText{ tokens.get_text() };
+        std::match_results<std::wstring_view::const_iterator> stPositions;
+        // runs a regex from the start of a function name, rather than searching the whole file
+        const auto matchFrom = [&fileText, &stPositions](const size_t position,
+                                                          const std::wregex& regEx)
+        {
+            return std::regex_search(std::next(fileText.cbegin(), position), fileText.cend(),
+                                     stPositions, regEx,
+                                     (position > 0) ? (std::regex_constants::match_continuous |
+                                                       std::regex_constants::match_prev_avail) :
+                                                      std::regex_constants::match_continuous);
+        };
 
             // ::LoadString() being called
             {
-            const std::wregex loadStringRegEx{
+            static const std::wregex loadStringRegEx{
                 LR"(([:]{2,2})?LoadString(A|W)?[(](\s*[a-zA-Z0-9_]+\s*,){3}\s*[a-zA-Z0-9_]+[)])"
             };
-            auto currentTextBlock{ fileText };
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            size_t currentBlockOffset{ 0 };
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, loadStringRegEx))
-                {
-                currentTextBlock = currentTextBlock.substr(stPositions.position());
-                currentBlockOffset += stPositions.position();
+            size_t nextPosition{ 0 };
+            for (const auto& token : tokens)
+                {
+                if (token.m_type != token_stream::token_type::identifier)
+                    {
+                    continue;
+                    }
+                // the name can be the end of a longer one (e.g., "MyLoadString"),
+                // which is filtered out below
+                const auto tokenText{ tokens.get_text(token) };
+                size_t currentBlockOffset{ token.m_position };
+                if (tokenText.ends_with(L"LoadString"))
+                    {
+                    currentBlockOffset += tokenText.length() - 10;
+                    }
+                else if (tokenText.ends_with(L"LoadStringA") || tokenText.ends_with(L"LoadStringW"))
+                    {
+                    currentBlockOffset += tokenText.length() - 11;
+                    }
+                else
+                    {
+                    continue;
+                    }
+                if (currentBlockOffset >= 2 && fileText.substr(currentBlockOffset - 2, 2) == L"::")
+                    {
+                    currentBlockOffset -= 2;
+                    }
+                if (currentBlockOffset < nextPosition ||
+                    !matchFrom(currentBlockOffset, loadStringRegEx))
+                    {
+                    continue;
+                    }
                 if (currentBlockOffset == 0 ||
                     !(i18n_string_util::is_alpha_7bit(fileText[currentBlockOffset - 1]) ||
                       fileText[currentBlockOffset - 1] == L'.'))
                     {
-                    m_suspect_i18n_usage.push_back(string_info(
-                        std::wstring{ currentTextBlock.substr(0, stPositions.length()) },
+                    add_result(
+                        result_category::suspect_i18n_usage,
+                        std::wstring{ fileText.substr(currentBlockOffset, stPositions.length()) },
                         string_info::usage_info(
                             string_info::usage_info::usage_type::function,
                             _(L"Prefer using CString::LoadString() (if using MFC) "
@@ -1401,31 +1620,33 @@ namespace i18n_check
                                 ,
 #endif
                             std::wstring{}, std::wstring{}),
-                        fileName, get_line_and_column(currentBlockOffset, fileText.data())));
+                        fileName, get_line_and_column(currentBlockOffset, fileText.data()));
                     }
-                currentTextBlock = currentTextBlock.substr(stPositions.length());
-                currentBlockOffset += stPositions.length();
+                nextPosition = currentBlockOffset + stPositions.length();
                 }
             }
 
             // _(), wxPLURAL() not taking a literal string
             {
-            const std::wregex l10nStringNonStringLiteralArgRegEx{
+            static const std::wregex l10nStringNonStringLiteralArgRegEx{
                 LR"(\b(_|wxPLURAL)\([\(\s]*([a-zA-Z0-9]+)([[:punct:]]))"
             };
-            auto currentTextBlock{ fileText };
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            size_t currentBlockOffset{ 0 };
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, l10nStringNonStringLiteralArgRegEx))
-                {
-                currentTextBlock = currentTextBlock.substr(stPositions.position(1));
-                currentBlockOffset += stPositions.position(1);
+            size_t nextPosition{ 0 };
+            for (const auto& token : tokens)
+                {
+                if (token.m_type != token_stream::token_type::identifier ||
+                    token.m_position < nextPosition ||
+                    (tokens.get_text(token) != L"_" && tokens.get_text(token) != L"wxPLURAL") ||
+                    !matchFrom(token.m_position, l10nStringNonStringLiteralArgRegEx))
+                    {
+                    continue;
+                    }
                 if (stPositions.size() >= 3 &&
                     // only something like LR, L, u8, etc. can be in front of a quote
                     stPositions[2].length() > 2 && stPositions[3].str() != L"\"")
                     {
-                    m_suspect_i18n_usage.push_back(string_info(
+                    add_result(
+                        result_category::suspect_i18n_usage,
                         stPositions[2].str(),
                         string_info::usage_info(string_info::usage_info::usage_type::function,
                                                 _(L"Only string literals should be passed to _() "
@@ -1436,16 +1657,15 @@ namespace i18n_check
                                                     ,
 #endif
                                                 std::wstring{}, std::wstring{}),
-                        fileName, get_line_and_column(currentBlockOffset, fileText.data())));
+                        fileName, get_line_and_column(token.m_position, fileText.data()));
                     }
-                currentTextBlock = currentTextBlock.substr(stPositions.length());
-                currentBlockOffset += stPositions.length();
+                nextPosition = token.m_position + stPositions.length();
                 }
             }
         }
 
     //--------------------------------------------------
-    void i18n_review::load_id_assignments(const std::wstring_view fileText,
+    void i18n_review::load_id_assignments(const token_stream& tokens,
                                           const std::filesystem::path& fileName)
         {
         if (!(static_cast<bool>(m_review_styles & check_duplicate_value_assigned_to_ids) ||
@@ -1453,37 +1673,92 @@ namespace i18n_check
             {
             return;
             }
-        std::vector<std::pair<size_t, std::wstring>> matches;
-
-        auto currentTextBlock{ fileText };
-        std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-        size_t currentBlockOffset{ 0 };
-        while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(), stPositions,
-                                 m_id_assignment_regex))
+        I18N_PROFILE_SCOPE(m_profile,
+                           m_review_styles & (check_number_assigned_to_id |
+                                              check_duplicate_value_assigned_to_ids),
+                           1);
+        const std::wstring_view fileText{ tokens.get_text() };
+
+        // An assignment can only start where one of the types that the regex looks for is
+        // (e.g., "int" or "#define"), which can be part of a longer name. Gather those
+        // positions and only run the regex from them, rather than searching the whole file.
+        std::pmr::vector<size_t> candidates{ m_scratch.get_resource() };
+        for (const auto& token : tokens)
             {
-            currentBlockOffset += stPositions.position();
-            currentTextBlock = currentTextBlock.substr(stPositions.position());
-
-            matches.emplace_back(currentBlockOffset,
-                                 currentTextBlock.substr(0, stPositions.length()));
-
-            currentBlockOffset += stPositions.length();
+            const auto tokenText{ tokens.get_text(token) };
+            if (token.m_type == token_stream::token_type::identifier)
+                {
+                // "int" also finds "uint32_t" and "uint64_t", and "INT" finds "UINT"
+                for (const std::wstring_view typeName : { L"int", L"INT", L"wxWindowID" })
+                    {
+                    for (size_t typePos = tokenText.find(typeName);
+                         typePos != std::wstring_view::npos;
+                         typePos = tokenText.find(typeName, typePos + 1))
+                        {
+                        if (typePos > 0 && (tokenText[typePos - 1] == L'u' ||
+                                            tokenText[typePos - 1] == L'U'))
+                            {
+                            candidates.push_back(token.m_position + typePos - 1);
+                            }
+                        candidates.push_back(token.m_position + typePos);
+                        }
+                    }
+                }
+            else if ((token.m_type == token_stream::token_type::preprocessor ||
+                      token.m_type == token_stream::token_type::punctuation) &&
+                     fileText.substr(token.m_position).starts_with(L"#define"))
+                {
+                candidates.push_back(token.m_position);
+                }
+            }
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
 
-            currentTextBlock = currentTextBlock.substr(stPositions.length());
+        // the matches are views into the file's text
+        std::pmr::vector<std::pair<size_t, std::wstring_view>> matches{
+            m_scratch.get_resource()
+        };
+        std::match_results<std::wstring_view::const_iterator> stPositions;
+        size_t nextPosition{ 0 };
+        for (const size_t candidate : candidates)
+            {
+            if (candidate < nextPosition)
+                {
+                continue;
+                }
+            // assignments don't span lines
+            size_t lineEnd{ fileText.find(L'\n', candidate) };
+            if (lineEnd == std::wstring_view::npos)
+                {
+                lineEnd = fileText.length();
+                }
+            if (std::regex_search(std::next(fileText.cbegin(), candidate),
+                                  std::next(fileText.cbegin(), lineEnd), stPositions,
+                                  m_id_assignment_regex, std::regex_constants::match_continuous))
+                {
+                matches.emplace_back(candidate, fileText.substr(candidate, stPositions.length()));
+                nextPosition = candidate + stPositions.length();
+                }
             }
 
-        const std::wregex varNamePartsRE{ L"([a-zA-Z0-9_]*)(ID)([a-zA-Z0-9_]*)" };
-        const std::wregex varNameIDPartsRE{ L"([a-zA-Z0-9_]*)(ID[A-Z]?[_]?)([a-zA-Z0-9_]*)" };
+        static const std::wregex varNamePartsRE{ L"([a-zA-Z0-9_]*)(ID)([a-zA-Z0-9_]*)" };
+        static const std::wregex varNameIDPartsRE{
+            L"([a-zA-Z0-9_]*)(ID[A-Z]?[_]?)([a-zA-Z0-9_]*)"
+        };
         // no std::from_chars for wchar_t :(
-        const std::wregex numRE{ LR"(^[\-0-9']+$)" };
+        static const std::wregex numRE{ LR"(^[\-0-9']+$)" };
         if (!matches.empty())
             {
-            std::vector<std::tuple<size_t, std::wstring, std::wstring>> idAssignments;
+            std::pmr::vector<std::tuple<size_t, std::wstring, std::wstring>> idAssignments{
+                m_scratch.get_resource()
+            };
             idAssignments.reserve(matches.size());
             std::vector<std::wstring> subMatches;
             std::vector<std::wstring> idNameParts;
-            // ID and variable name assigned to
-            std::map<std::wstring, std::wstring> assignedIds;
+            // ID and variable name assigned to (views into idAssignments)
+            std::pmr::map<std::wstring_view, std::wstring_view> assignedIds{
+                m_scratch.get_resource()
+            };
             for (const auto& match : matches)
                 {
                 subMatches.clear();
@@ -1572,7 +1847,8 @@ namespace i18n_check
                      idNameParts[1] == L"IDM_" || idNameParts[1] == L"IDC_" ||
                      idNameParts[1] == L"IDI_" || idNameParts[1] == L"IDB_"))
                     {
-                    m_ids_assigned_number.push_back(string_info(
+                    add_result(
+                        result_category::ids_assigned_number,
 #ifdef wxVERSION_NUMBER
                         wxString::Format(_(L"%s assigned to %s; value should be between 1 and "
                                            "0x6FFF if this is an MFC project."),
@@ -1585,14 +1861,15 @@ namespace i18n_check
 #endif
                         string_info::usage_info{}, fileName,
                         std::make_pair(get_line_and_column(position, fileText).first,
-                                       std::wstring::npos)));
+                                       std::wstring::npos));
                     }
                 else if (static_cast<bool>(m_review_styles & check_number_assigned_to_id) &&
                          idVal &&
                          !(idVal.value() >= idRangeStart && idVal.value() <= stringIdRangeEnd) &&
                          (idNameParts[1] == L"IDS_" || idNameParts[1] == L"IDP_"))
                     {
-                    m_ids_assigned_number.emplace_back(
+                    add_result(
+                        result_category::ids_assigned_number,
 #ifdef wxVERSION_NUMBER
                         wxString::Format(_(L"%s assigned to %s; value should be between 1 and "
                                            "0x7FFF if this is an MFC project."),
@@ -1613,7 +1890,8 @@ namespace i18n_check
                            idVal.value() <= dialogIdRangeEnd) &&
                          idNameParts[1] == L"IDC_")
                     {
-                    m_ids_assigned_number.emplace_back(
+                    add_result(
+                        result_category::ids_assigned_number,
 #ifdef wxVERSION_NUMBER
                         wxString::Format(_(L"%s assigned to %s; value should be between 8 and "
                                            "0xDFFF if this is an MFC project."),
@@ -1635,7 +1913,8 @@ namespace i18n_check
                          // temporary init values
                          string2 != L"-1" && string2 != L"0")
                     {
-                    m_ids_assigned_number.emplace_back(
+                    add_result(
+                        result_category::ids_assigned_number,
 #ifdef wxVERSION_NUMBER
                         wxString::Format(_(L"%s assigned to %s"), string2, string1).wc_string(),
 #else
@@ -1646,7 +1925,8 @@ namespace i18n_check
                                        std::wstring::npos));
                     }
 
-                const auto [pos, inserted] = assignedIds.insert(std::make_pair(string2, string1));
+                const auto [pos, inserted] =
+                    assignedIds.emplace(std::wstring_view{ string2 }, std::wstring_view{ string1 });
 
                 if (static_cast<bool>(m_review_styles & check_duplicate_value_assigned_to_ids) &&
                     !inserted && string2.length() > 0 &&
@@ -1654,7 +1934,8 @@ namespace i18n_check
                     string1 != pos->second && string2 != L"wxID_ANY" && string2 != L"wxID_NONE" &&
                     string2 != L"-1" && string2 != L"0")
                     {
-                    m_duplicates_value_assigned_to_ids.push_back(string_info(
+                    add_result(
+                        result_category::duplicates_value_assigned_to_ids,
 #ifdef wxVERSION_NUMBER
                         wxString::Format(_(L"%s has been assigned to multiple ID variables."),
                                          string2)
@@ -1664,14 +1945,14 @@ namespace i18n_check
 #endif
                         string_info::usage_info{}, fileName,
                         std::make_pair(get_line_and_column(position, fileText).first,
-                                       std::wstring::npos)));
+                                       std::wstring::npos));
                     }
                 }
             }
         }
 
     //--------------------------------------------------
-    bool i18n_review::is_string_resource_faux_plural(const string_info& str)
+    bool i18n_review::is_string_resource_faux_plural(const string_info& str) const
         {
         // Qt functions (and possibly other frameworks) dynamically detect "(s")
         // and make separate strings if you provide a number in its context arguments,
@@ -1680,7 +1961,8 @@ namespace i18n_check
             {
             return false;
             }
-        return is_string_faux_plural(str.m_string);
+        return classify_string(str.m_string, string_verdict::faux_plural,
+                               [&str]() { return is_string_faux_plural(str.m_string); });
         }
 
     //--------------------------------------------------
@@ -1869,9 +2151,9 @@ namespace i18n_check
     //--------------------------------------------------
     void i18n_review::process_quote(wchar_t* currentTextPos, const wchar_t* quoteEnd,
                                     const wchar_t* functionVarNamePos,
-                                    const std::wstring& functionName,
+                                    std::wstring_view functionName,
                                     const variable_info& variableInfo,
-                                    const std::wstring& deprecatedMacroEncountered,
+                                    std::wstring_view deprecatedMacroEncountered,
                                     const size_t parameterPosition, const bool isFollowedByComma)
         {
         // Note that we always pass 'variableInfo.m_operator' as the operator value, even if this
@@ -1881,11 +2163,13 @@ namespace i18n_check
         if (deprecatedMacroEncountered.length() > 0 &&
             static_cast<bool>(m_review_styles & check_deprecated_macros))
             {
-            const auto foundMessage = m_deprecated_string_macros.find(deprecatedMacroEncountered);
-            m_deprecated_macros.emplace_back(
-                deprecatedMacroEncountered,
+            const auto& deprecatedMacros{ m_rules->m_deprecated_string_macros };
+            const auto foundMessage = deprecatedMacros.find(deprecatedMacroEncountered);
+            add_result(
+                result_category::deprecated_macros,
+                std::wstring{ deprecatedMacroEncountered },
                 string_info::usage_info(string_info::usage_info::usage_type::function,
-                                        (foundMessage != m_deprecated_string_macros.cend()) ?
+                                        (foundMessage != deprecatedMacros.cend()) ?
                                             std::wstring{ foundMessage->second } :
                                             std::wstring{},
                                         std::wstring{}, variableInfo.m_operator),
@@ -1903,7 +2187,8 @@ namespace i18n_check
             {
             if (is_diagnostic_function(functionName))
                 {
-                m_internal_strings.emplace_back(
+                add_result(
+                    result_category::internal,
                     std::wstring(currentTextPos, quoteEnd - currentTextPos),
                     string_info::usage_info(string_info::usage_info::usage_type::function,
                                             functionName, std::wstring{}, variableInfo.m_operator),
@@ -1936,7 +2221,8 @@ namespace i18n_check
                     (functionName == L"ki18n" && parameterPosition > 0) || // acts like printf
                     (functionName == L"wxGetTranslation" && parameterPosition >= 1))
                     {
-                    m_internal_strings.emplace_back(
+                    add_result(
+                        result_category::internal,
                         std::wstring(currentTextPos, quoteEnd - currentTextPos),
                         string_info::usage_info(string_info::usage_info::usage_type::function,
                                                 functionName, std::wstring{},
@@ -1950,7 +2236,8 @@ namespace i18n_check
                         // they really are comments in practice
                         !functionName.starts_with(L"i18n") && !functionName.starts_with(L"ki18n"))
                         {
-                        m_suspect_i18n_usage.emplace_back(
+                        add_result(
+                            result_category::suspect_i18n_usage,
                             std::wstring{ currentTextPos,
                                           static_cast<size_t>(quoteEnd - currentTextPos) },
                             string_info::usage_info(
@@ -1959,7 +2246,7 @@ namespace i18n_check
                                 wxString::Format(
                                     _(L"Context string is considerably long. Are the context and "
                                       "string arguments to %s possibly transposed?"),
-                                    functionName)
+                                    std::wstring{ functionName })
                                     .wc_string(),
 #else
                                 _(L"Context string is considerably long. Are the context and "
@@ -1977,8 +2264,9 @@ namespace i18n_check
                     if (static_cast<bool>(m_review_styles & check_suspect_i18n_usage) &&
                         contextLength > 32)
                         {
-                        m_suspect_i18n_usage.emplace_back(
-                            functionName,
+                        add_result(
+                            result_category::suspect_i18n_usage,
+                            std::wstring{ functionName },
                             string_info::usage_info(
                                 string_info::usage_info::usage_type::function,
 #ifdef wxVERSION_NUMBER
@@ -1997,7 +2285,8 @@ namespace i18n_check
                     }
                 else
                     {
-                    m_localizable_strings.emplace_back(
+                    add_result(
+                        result_category::localizable,
                         std::wstring(currentTextPos, quoteEnd - currentTextPos),
                         string_info::usage_info(
                             string_info::usage_info::usage_type::function, functionName,
@@ -2012,9 +2301,11 @@ namespace i18n_check
                     if (functionVarNamePos != nullptr &&
                         static_cast<bool>(m_review_styles & check_suspect_l10n_string_usage))
                         {
-                        std::wstring functionNameOuter;
-                        variable_info outerVariable;
-                        std::wstring deprecatedMacroOuterEncountered;
+                        std::pmr::wstring functionNameOuter{ m_scratch.get_resource() };
+                        variable_info outerVariable{ m_scratch.get_resource() };
+                        std::pmr::wstring deprecatedMacroOuterEncountered{
+                            m_scratch.get_resource()
+                        };
                         size_t parameterPositionOuter{ 0 };
                         read_var_or_function_name(
                             functionVarNamePos, m_file_start, functionNameOuter, outerVariable,
@@ -2022,8 +2313,9 @@ namespace i18n_check
                         if (deprecatedMacroOuterEncountered.length() > 0 &&
                             static_cast<bool>(m_review_styles & check_deprecated_macros))
                             {
-                            m_deprecated_macros.emplace_back(
-                                deprecatedMacroOuterEncountered,
+                            add_result(
+                                result_category::deprecated_macros,
+                                std::wstring{ deprecatedMacroOuterEncountered },
                                 string_info::usage_info(
                                     string_info::usage_info::usage_type::function, std::wstring{},
                                     std::wstring{}, variableInfo.m_operator),
@@ -2032,10 +2324,10 @@ namespace i18n_check
                         // internal functions
                         if (is_diagnostic_function(functionNameOuter) ||
                             // CTORs whose arguments should not be translated
-                            m_variable_types_to_ignore.find(functionNameOuter) !=
-                                m_variable_types_to_ignore.cend())
+                            is_ignored_variable_type(functionNameOuter))
                             {
-                            m_localizable_strings_in_internal_call.emplace_back(
+                            add_result(
+                                result_category::in_internal_call,
                                 std::wstring(currentTextPos, quoteEnd - currentTextPos),
                                 string_info::usage_info(
                                     string_info::usage_info::usage_type::function,
@@ -2043,10 +2335,10 @@ namespace i18n_check
                                 m_file_name, get_line_and_column(currentTextPos - m_file_start));
                             }
                         // untranslatable variable types
-                        else if (m_variable_types_to_ignore.find(outerVariable.m_type) !=
-                                 m_variable_types_to_ignore.cend())
+                        else if (is_ignored_variable_type(outerVariable.m_type))
                             {
-                            m_localizable_strings_in_internal_call.emplace_back(
+                            add_result(
+                                result_category::in_internal_call,
                                 std::wstring(currentTextPos, quoteEnd - currentTextPos),
                                 string_info::usage_info(
                                     string_info::usage_info::usage_type::variable,
@@ -2059,25 +2351,22 @@ namespace i18n_check
                             {
                             try
                                 {
-                                for (const auto& reg : get_ignored_variable_patterns())
+                                if (is_ignored_variable_name(outerVariable.m_name))
                                     {
-                                    if (std::regex_match(outerVariable.m_name, reg))
-                                        {
-                                        m_localizable_strings_in_internal_call.emplace_back(
-                                            std::wstring(currentTextPos, quoteEnd - currentTextPos),
-                                            string_info::usage_info(
-                                                string_info::usage_info::usage_type::variable,
-                                                outerVariable.m_name, outerVariable.m_type,
-                                                outerVariable.m_operator),
-                                            m_file_name,
-                                            get_line_and_column(currentTextPos - m_file_start));
-                                        break;
-                                        }
+                                    add_result(
+                                        result_category::in_internal_call,
+                                        std::wstring(currentTextPos, quoteEnd - currentTextPos),
+                                        string_info::usage_info(
+                                            string_info::usage_info::usage_type::variable,
+                                            outerVariable.m_name, outerVariable.m_type,
+                                            outerVariable.m_operator),
+                                        m_file_name,
+                                        get_line_and_column(currentTextPos - m_file_start));
                                     }
                                 }
                             catch (const std::exception& exp)
                                 {
-                                log_message(outerVariable.m_name,
+                                log_message(std::wstring{ outerVariable.m_name },
                                             i18n_string_util::lazy_string_to_wstring(exp.what()),
                                             (currentTextPos - m_file_start));
                                 }
@@ -2089,16 +2378,17 @@ namespace i18n_check
                 }
             else if (is_non_i18n_function(functionName))
                 {
-                m_marked_as_non_localizable_strings.emplace_back(
+                add_result(
+                    result_category::marked_as_non_localizable,
                     std::wstring(currentTextPos, quoteEnd - currentTextPos),
                     string_info::usage_info(string_info::usage_info::usage_type::function,
                                             functionName, std::wstring{}, variableInfo.m_operator),
                     m_file_name, get_line_and_column(currentTextPos - m_file_start));
                 }
-            else if (m_variable_types_to_ignore.find(functionName) !=
-                     m_variable_types_to_ignore.cend())
+            else if (is_ignored_variable_type(functionName))
                 {
-                m_internal_strings.emplace_back(
+                add_result(
+                    result_category::internal,
                     std::wstring(currentTextPos, quoteEnd - currentTextPos),
                     string_info::usage_info(string_info::usage_info::usage_type::function,
                                             functionName, std::wstring{}, variableInfo.m_operator),
@@ -2139,9 +2429,8 @@ namespace i18n_check
         {
 #ifndef NDEBUG
         if (variableInfo.m_type.length() > 0 &&
-            get_ignored_variable_types().find(variableInfo.m_type) ==
-                get_ignored_variable_types().cend() &&
-            m_ctors_to_ignore.find(variableInfo.m_type) == m_ctors_to_ignore.cend() &&
+            !is_ignored_variable_type(variableInfo.m_type) &&
+            !m_rules->m_ctors_to_ignore.contains(variableInfo.m_type) &&
             (variableInfo.m_type.length() < 5 ||
              std::wstring_view(variableInfo.m_type.c_str(), 5)
                      .compare(std::wstring_view{ L"std::", 5 }) != 0) &&
@@ -2166,16 +2455,17 @@ namespace i18n_check
             variableInfo.m_type != L"wstring_view" && variableInfo.m_type != L"LanguageInfo" &&
             variableInfo.m_type != L"MessageParameters")
             {
-            log_message(variableInfo.m_type, L"New variable type detected.", quotePosition);
+            log_message(std::wstring{ variableInfo.m_type }, L"New variable type detected.",
+                        quotePosition);
             }
 #endif
         // For large string values, a 1024 substring will suffice for classifying it.
         // This is more optimal and will prevent memory exhaustion with regex comparisons.
         std::wstring clippedValue{ value.length() >= 1024 ? value.substr(0, 1024) : value };
-        if (get_ignored_variable_types().find(variableInfo.m_type) !=
-            get_ignored_variable_types().cend())
+        if (is_ignored_variable_type(variableInfo.m_type))
             {
-            m_internal_strings.emplace_back(
+            add_result(
+                result_category::internal,
                 std::move(clippedValue),
                 string_info::usage_info(string_info::usage_info::usage_type::variable,
                                         variableInfo.m_name, variableInfo.m_type,
@@ -2183,50 +2473,33 @@ namespace i18n_check
                 m_file_name, get_line_and_column(quotePosition));
             return;
             }
-        if (!get_ignored_variable_patterns().empty())
+        try
             {
-            try
+            if (is_ignored_variable_name(variableInfo.m_name))
                 {
-                bool matchedInternalVar(false);
-                for (const auto& reg : get_ignored_variable_patterns())
-                    {
-                    if (std::regex_match(variableInfo.m_name, reg))
-                        {
-                        m_internal_strings.emplace_back(
-                            std::move(clippedValue),
-                            string_info::usage_info(string_info::usage_info::usage_type::variable,
-                                                    variableInfo.m_name, variableInfo.m_type,
-                                                    variableInfo.m_operator),
-                            m_file_name, get_line_and_column(quotePosition));
-                        matchedInternalVar = true;
-                        break;
-                        }
-                    }
-                // didn't match any known internal variable name provided by user?
-                if (!matchedInternalVar)
-                    {
-                    classify_non_localizable_string(string_info(
-                        std::move(clippedValue),
-                        string_info::usage_info(string_info::usage_info::usage_type::variable,
-                                                variableInfo.m_name, variableInfo.m_type,
-                                                variableInfo.m_operator),
-                        m_file_name, get_line_and_column(quotePosition)));
-                    }
+                add_result(
+                    result_category::internal,
+                    std::move(clippedValue),
+                    string_info::usage_info(string_info::usage_info::usage_type::variable,
+                                            variableInfo.m_name, variableInfo.m_type,
+                                            variableInfo.m_operator),
+                    m_file_name, get_line_and_column(quotePosition));
                 }
-            catch (const std::exception& exp)
+            // didn't match any known internal variable name?
+            else
                 {
-                log_message(variableInfo.m_name,
-                            i18n_string_util::lazy_string_to_wstring(exp.what()), quotePosition);
+                classify_non_localizable_string(string_info(
+                    std::move(clippedValue),
+                    string_info::usage_info(string_info::usage_info::usage_type::variable,
+                                            variableInfo.m_name, variableInfo.m_type,
+                                            variableInfo.m_operator),
+                    m_file_name, get_line_and_column(quotePosition)));
                 }
             }
-        else
+        catch (const std::exception& exp)
             {
-            classify_non_localizable_string(
-                string_info(std::move(clippedValue),
-                            string_info::usage_info(string_info::usage_info::usage_type::variable,
-                                                    variableInfo.m_name, variableInfo.m_type,
-                                                    variableInfo.m_operator),
-                            m_file_name, get_line_and_column(quotePosition)));
+            log_message(std::wstring{ variableInfo.m_name },
+                        i18n_string_util::lazy_string_to_wstring(exp.what()), quotePosition);
             }
         }
 
@@ -2236,12 +2509,7 @@ namespace i18n_check
         try
             {
             m_error_log.reserve(std::min<size_t>(fileCount, 10));
-            m_localizable_strings.reserve(std::min<size_t>(fileCount, 10));
-            m_not_available_for_localization_strings.reserve(std::min<size_t>(fileCount, 10));
-            m_marked_as_non_localizable_strings.reserve(std::min<size_t>(fileCount, 10));
-            m_internal_strings.reserve(std::min<size_t>(fileCount, 10));
-            m_unsafe_localizable_strings.reserve(std::min<size_t>(fileCount, 10));
-            m_deprecated_macros.reserve(std::min<size_t>(fileCount, 10));
+            m_results.reserve(std::min<size_t>(fileCount, 10));
             }
         catch (const std::bad_alloc&)
             {
@@ -2251,52 +2519,350 @@ namespace i18n_check
     //--------------------------------------------------
     void i18n_review::clear_results()
         {
-        m_localizable_strings.clear();
-        m_localizable_strings_with_unlocalizable_content.clear();
-        m_localizable_strings_with_urls.clear();
-        m_localizable_strings_ambiguous_needing_context.clear();
-        m_localizable_strings_in_internal_call.clear();
-        m_localizable_strings_being_concatenated.clear();
-        m_localizable_strings_with_halfwidths.clear();
-        m_multipart_strings.clear();
-        m_faux_plural_strings.clear();
-        m_article_issue_strings.clear();
-        m_not_available_for_localization_strings.clear();
-        m_marked_as_non_localizable_strings.clear();
-        m_internal_strings.clear();
-        m_unsafe_localizable_strings.clear();
-        m_deprecated_macros.clear();
-        m_unencoded_strings.clear();
-        m_printf_single_numbers.clear();
-        m_ids_assigned_number.clear();
-        m_duplicates_value_assigned_to_ids.clear();
-        m_malformed_strings.clear();
-        m_trailing_spaces.clear();
-        m_tabs.clear();
-        m_wide_lines.clear();
-        m_comments_missing_space.clear();
-        m_suspect_i18n_usage.clear();
+        m_results.clear();
 
         m_wx_info = wx_project_info{};
         }
 
     //--------------------------------------------------
-    bool i18n_review::is_diagnostic_function(const std::wstring& functionName) const
+    void i18n_review::merge_results(const std::vector<i18n_review*>& analyzers,
+                                    const file_index_callback& fileIndex)
+        {
+        // the other analyzers' strings are appended to our store, and each category's
+        // new entries are sorted by file
+        std::vector<results_store*> otherResults;
+        otherResults.reserve(analyzers.size());
+        for (auto* analyzer : analyzers)
+            {
+            otherResults.push_back(&analyzer->m_results);
+            }
+        m_results.merge(otherResults, [&fileIndex](const string_info& str)
+                        { return fileIndex(str.m_file_name); });
+
+        merge_results_by_file(&i18n_review::m_error_log, analyzers, fileIndex,
+                              [](const parse_messages& msg) -> const std::filesystem::path&
+                              { return msg.m_file_name; });
+
+        // the app's OnInit() is taken from the first file (in the original file order) that had it
+        for (auto* analyzer : analyzers)
+            {
+            const auto& otherInfo{ analyzer->m_wx_info };
+            if (!otherInfo.m_app_init_info.m_file_name.empty() &&
+                (m_wx_info.m_app_init_info.m_file_name.empty() ||
+                 fileIndex(otherInfo.m_app_init_info.m_file_name) <
+                     fileIndex(m_wx_info.m_app_init_info.m_file_name)))
+                {
+                m_wx_info.m_app_init_info = otherInfo.m_app_init_info;
+                }
+            m_wx_info.m_wxuilocale_initialized =
+                m_wx_info.m_wxuilocale_initialized || otherInfo.m_wxuilocale_initialized;
+            m_wx_info.m_wxlocale_initialized =
+                m_wx_info.m_wxlocale_initialized || otherInfo.m_wxlocale_initialized;
+            analyzer->m_wx_info = wx_project_info{};
+            }
+        }
+
+    //--------------------------------------------------
+    template<typename StringsT>
+    static void write_string_info_list(std::ostream& stream, const StringsT& strings,
+                                       const std::filesystem::path& filePath)
+        {
+        write_cache_value(stream, strings.size());
+        for (const auto& str : strings)
+            {
+            write_cache_string(stream, str.m_string);
+            write_cache_value(stream, static_cast<uint64_t>(str.m_usage.m_type));
+            write_cache_string(stream, str.m_usage.m_value);
+            write_cache_string(stream, str.m_usage.m_variableInfo.m_name);
+            write_cache_string(stream, str.m_usage.m_variableInfo.m_type);
+            write_cache_string(stream, str.m_usage.m_variableInfo.m_operator);
+            write_cache_value(stream, str.m_usage.m_hasContext ? 1 : 0);
+            // results from the file itself are (almost always) what is being written,
+            // so leave their path out so that they can be read back for another file
+            write_cache_string(stream, (str.m_file_name == filePath) ? std::wstring{} :
+                                                                       str.m_file_name.wstring());
+            write_cache_value(stream, str.m_line);
+            write_cache_value(stream, str.m_column);
+            }
+        }
+
+    //--------------------------------------------------
+    void i18n_review::write_string_infos(std::ostream& stream,
+                                         const std::vector<string_info>& strings,
+                                         const std::filesystem::path& filePath)
+        {
+        write_string_info_list(stream, strings, filePath);
+        }
+
+    //--------------------------------------------------
+    void i18n_review::write_string_infos(std::ostream& stream, const results_view& strings,
+                                         const std::filesystem::path& filePath)
+        {
+        write_string_info_list(stream, strings, filePath);
+        }
+
+    //--------------------------------------------------
+    void i18n_review::read_string_infos(std::istream& stream, std::vector<string_info>& strings,
+                                        const std::filesystem::path& filePath)
+        {
+        const uint64_t stringCount{ read_cache_value(stream) };
+        for (uint64_t i = 0; i < stringCount; ++i)
+            {
+            string_info str;
+            str.m_string = read_cache_string(stream);
+            const uint64_t usageType{ read_cache_value(stream) };
+            if (usageType > static_cast<uint64_t>(string_info::usage_info::usage_type::orphan))
+                {
+                throw std::runtime_error("Cached results contain an unknown usage type.");
+                }
+            str.m_usage.m_type = static_cast<string_info::usage_info::usage_type>(usageType);
+            str.m_usage.m_value = read_cache_string(stream);
+            str.m_usage.m_variableInfo.m_name = read_cache_string(stream);
+            str.m_usage.m_variableInfo.m_type = read_cache_string(stream);
+            str.m_usage.m_variableInfo.m_operator = read_cache_string(stream);
+            str.m_usage.m_hasContext = (read_cache_value(stream) != 0);
+            const std::wstring fileName{ read_cache_string(stream) };
+            str.m_file_name = fileName.empty() ? filePath : std::filesystem::path{ fileName };
+            str.m_line = static_cast<size_t>(read_cache_value(stream));
+            str.m_column = static_cast<size_t>(read_cache_value(stream));
+            strings.push_back(std::move(str));
+            }
+        }
+
+    //--------------------------------------------------
+    void i18n_review::write_results(std::ostream& stream,
+                                    const std::filesystem::path& filePath) const
+        {
+        for (size_t category = 0; category < static_cast<size_t>(result_category::category_count);
+             ++category)
+            {
+            write_string_infos(stream, m_results.get(category), filePath);
+            }
+
+        write_cache_value(stream, m_error_log.size());
+        for (const auto& msg : m_error_log)
+            {
+            write_cache_string(stream, (msg.m_file_name == filePath) ? std::wstring{} :
+                                                                       msg.m_file_name.wstring());
+            write_cache_string(stream, msg.m_resourceString);
+            write_cache_string(stream, msg.m_message);
+            write_cache_value(stream, msg.m_line);
+            write_cache_value(stream, msg.m_column);
+            }
+
+        write_string_infos(stream,
+                           m_wx_info.m_app_init_info.m_file_name.empty() ?
+                               std::vector<string_info>{} :
+                               std::vector<string_info>{ m_wx_info.m_app_init_info },
+                           filePath);
+        write_cache_value(stream, m_wx_info.m_wxuilocale_initialized ? 1 : 0);
+        write_cache_value(stream, m_wx_info.m_wxlocale_initialized ? 1 : 0);
+        }
+
+    //--------------------------------------------------
+    void i18n_review::read_results(std::istream& stream, const std::filesystem::path& filePath)
+        {
+        std::vector<string_info> strings;
+        for (size_t category = 0; category < static_cast<size_t>(result_category::category_count);
+             ++category)
+            {
+            strings.clear();
+            read_string_infos(stream, strings, filePath);
+            for (auto& str : strings)
+                {
+                m_results.add(category, std::move(str));
+                }
+            }
+
+        const uint64_t messageCount{ read_cache_value(stream) };
+        for (uint64_t i = 0; i < messageCount; ++i)
+            {
+            const std::wstring fileName{ read_cache_string(stream) };
+            std::wstring resourceString{ read_cache_string(stream) };
+            std::wstring message{ read_cache_string(stream) };
+            const auto line{ static_cast<size_t>(read_cache_value(stream)) };
+            const auto column{ static_cast<size_t>(read_cache_value(stream)) };
+            m_error_log.emplace_back(fileName.empty() ? filePath :
+                                                        std::filesystem::path{ fileName },
+                                     std::make_pair(line, column), std::move(resourceString),
+                                     std::move(message));
+            }
+
+        // the app's OnInit() is taken from the first file that had it
+        std::vector<string_info> appInitInfo;
+        read_string_infos(stream, appInitInfo, filePath);
+        if (!appInitInfo.empty() && m_wx_info.m_app_init_info.m_file_name.empty())
+            {
+            m_wx_info.m_app_init_info = std::move(appInitInfo.front());
+            }
+        m_wx_info.m_wxuilocale_initialized =
+            (read_cache_value(stream) != 0) || m_wx_info.m_wxuilocale_initialized;
+        m_wx_info.m_wxlocale_initialized =
+            (read_cache_value(stream) != 0) || m_wx_info.m_wxlocale_initialized;
+        }
+
+    //--------------------------------------------------
+    uint64_t i18n_review::get_settings_hash() const
+        {
+        uint64_t settingsHash{ results_cache::HASH_SEED };
+        const auto hashValue = [&settingsHash](const uint64_t value)
+        {
+            settingsHash = combine_cache_hash(
+                settingsHash,
+                std::string_view{ reinterpret_cast<const char*>(&value), sizeof(value) });
+        };
+        const auto hashString = [&settingsHash, &hashValue](std::wstring_view str)
+        {
+            hashValue(str.length());
+            settingsHash = combine_cache_hash(
+                settingsHash, std::string_view{ reinterpret_cast<const char*>(str.data()),
+                                                str.length() * sizeof(wchar_t) });
+        };
+        const auto hashStrings = [&hashValue, &hashString](const auto& strings)
+        {
+            hashValue(strings.size());
+            for (const auto& str : strings)
+                {
+                hashString({ str.data(), str.length() });
+                }
+        };
+
+        hashValue(static_cast<uint64_t>(m_review_styles));
+        hashValue(m_verbose ? 1 : 0);
+        hashValue(m_allow_translating_punctuation_only_strings ? 1 : 0);
+        hashValue(m_exceptions_should_be_translatable ? 1 : 0);
+        hashValue(m_log_messages_are_translatable ? 1 : 0);
+        hashValue(m_min_words_for_unavailable_string);
+        hashValue(static_cast<uint64_t>(m_min_cpp_version));
+        hashValue(m_translation_length_threshold);
+        // functions and such that can be customized by the client
+        hashStrings(m_rules->m_localization_functions);
+        hashStrings(m_rules->m_internal_functions);
+        hashStrings(m_rules->m_variable_types_to_ignore);
+        hashStrings(m_rules->m_font_names);
+        hashStrings(m_rules->m_file_extensions);
+        hashValue(m_rules->m_variable_name_patterns_to_ignore.size());
+        for (const auto& pattern : m_rules->m_variable_name_patterns_to_ignore)
+            {
+            hashString(pattern.get_pattern());
+            hashValue(static_cast<uint64_t>(pattern.get_flags()));
+            }
+
+        return settingsHash;
+        }
+
+    //--------------------------------------------------
+    uint64_t i18n_review::combine_changed_lines_hash(uint64_t hash,
+                                                     const std::filesystem::path& filePath) const
+        {
+        if (m_changed_lines == nullptr)
+            {
+            return hash;
+            }
+        const auto hashValue = [&hash](const uint64_t value)
+        {
+            hash = combine_cache_hash(
+                hash, std::string_view{ reinterpret_cast<const char*>(&value), sizeof(value) });
+        };
+        // (a file that wasn't changed has no ranges, which is different from
+        // not limiting the analysis to changed lines at all)
+        const auto changedFile = m_changed_lines->find(filePath);
+        if (changedFile == m_changed_lines->cend())
+            {
+            hashValue(0);
+            return hash;
+            }
+        hashValue(changedFile->second.size() + 1);
+        for (const auto& [firstLine, lastLine] : changedFile->second)
+            {
+            hashValue(firstLine);
+            hashValue(lastLine);
+            }
+        return hash;
+        }
+
+    //--------------------------------------------------
+    bool i18n_review::is_in_changed_lines(const std::filesystem::path& filePath,
+                                          const size_t line) const
+        {
+        if (m_changed_lines == nullptr)
+            {
+            return true;
+            }
+        const auto changedFile = m_changed_lines->find(filePath);
+        if (changedFile == m_changed_lines->cend())
+            {
+            return false;
+            }
+        return (line == 0 || line == std::wstring::npos ||
+                is_line_in_ranges(changedFile->second, line));
+        }
+
+    //--------------------------------------------------
+    void i18n_review::load_file_changed_lines()
+        {
+        m_file_changed_lines = nullptr;
+        if (m_changed_lines != nullptr)
+            {
+            const auto changedFile = m_changed_lines->find(m_file_name);
+            if (changedFile != m_changed_lines->cend())
+                {
+                m_file_changed_lines = &changedFile->second;
+                }
+            }
+        }
+
+    //--------------------------------------------------
+    void i18n_review::remove_results_outside_changed_lines()
+        {
+        if (m_changed_lines == nullptr)
+            {
+            return;
+            }
+
+        m_results.remove_if([this](const string_info& str)
+                            { return !is_in_changed_lines(str.m_file_name, str.m_line); });
+        std::erase_if(m_error_log, [this](const parse_messages& msg)
+                      { return !is_in_changed_lines(msg.m_file_name, msg.m_line); });
+        }
+
+    //--------------------------------------------------
+    /// @returns @c true if a name is a single identifier containing ASSERT, VERIFY,
+    ///     PROFILE, or CHECK (e.g., "wxASSERT_MSG" or "BOOST_CHECK").
+    static bool is_diagnostic_macro_name(const std::wstring_view functionName)
+        {
+        if (functionName.length() < 5 ||
+            !std::all_of(functionName.cbegin(), functionName.cend(),
+                         [](const wchar_t ch)
+                         {
+                             return (ch >= L'a' && ch <= L'z') || (ch >= L'A' && ch <= L'Z') ||
+                                    (ch >= L'0' && ch <= L'9') || ch == L'_';
+                         }))
+            {
+            return false;
+            }
+        return functionName.find(L"ASSERT") != std::wstring_view::npos ||
+               functionName.find(L"VERIFY") != std::wstring_view::npos ||
+               functionName.find(L"PROFILE") != std::wstring_view::npos ||
+               functionName.find(L"CHECK") != std::wstring_view::npos;
+        }
+
+    //--------------------------------------------------
+    bool i18n_review::is_diagnostic_function(std::wstring_view functionName) const
         {
         try
             {
-            return (std::regex_match(functionName, m_diagnostic_function_regex) ||
-                    (m_internal_functions.find(functionName) != m_internal_functions.cend()) ||
-                    (m_internal_functions.find(extract_base_function(functionName)) !=
-                     m_internal_functions.cend()) ||
+            return (m_rules->m_internal_functions.contains(functionName) ||
+                    m_rules->m_internal_functions.contains(extract_base_function(functionName)) ||
+                    is_diagnostic_macro_name(functionName) ||
                     functionName.ends_with(L"_TRACE") || functionName.ends_with(L"_DEBUG") ||
                     (!can_log_messages_be_translatable() &&
-                     m_log_functions.find(functionName) != m_log_functions.cend()));
+                     m_rules->m_log_functions.contains(functionName)));
             }
         catch (const std::exception& exp)
             {
-            log_message(functionName, i18n_string_util::lazy_string_to_wstring(exp.what()),
-                        std::wstring::npos);
+            log_message(std::wstring{ functionName },
+                        i18n_string_util::lazy_string_to_wstring(exp.what()), std::wstring::npos);
             return true;
             }
         }
@@ -2315,10 +2881,22 @@ namespace i18n_check
             return std::make_pair(true, strToReview.length());
             }
 
-        static const std::wregex loremIpsum(L"Lorem ipsum.*", std::regex_constants::icase);
-        static const std::wregex brownFox(L"the quick brown fox.*", std::regex_constants::icase);
-        static const std::wregex percentageRegEx(LR"(([0-9]+|\{[a-z0-9]\}|%[udil]{1,2})%)");
-        if (std::regex_match(strToReview, percentageRegEx))
+        static const regex_pattern loremIpsum(L"Lorem ipsum.*", std::regex_constants::icase);
+        static const regex_pattern brownFox(L"the quick brown fox.*",
+                                            std::regex_constants::icase);
+        static const regex_pattern percentageRegEx(LR"(([0-9]+|\{[a-z0-9]\}|%[udil]{1,2})%)");
+        static const regex_pattern punctuationRegex(L"[[:punct:]]+");
+        // these are only used for replacing, so they need the standard library's regex
+        static const std::wregex htmlBreakRegex(LR"(<br[[:space:]]*\/>)");
+        static const std::wregex htmlScriptRegex(LR"(<script[\d\D]*?>[\d\D]*?</script>)");
+        static const std::wregex htmlStyleRegex(LR"(<style[\d\D]*?>[\d\D]*?</style>)");
+        static const std::wregex htmlTagRegex(
+            L"<[?]?[A-Za-z0-9+_/\\-\\.'\"=;:!%[:space:]\\\\,()]+[?]?>");
+        static const std::wregex xmlElementRegex(m_xml_element_regex.get_pattern(),
+                                                 m_xml_element_regex.get_flags());
+        static const std::wregex htmlEntityRegex(L"&[a-zA-Z]{2,5};");
+        static const std::wregex htmlNumericEntityRegex(L"&#[[:digit:]]{2,4};");
+        if (percentageRegEx.matches(strToReview))
             {
             return std::make_pair(false, strToReview.length());
             }
@@ -2326,10 +2904,10 @@ namespace i18n_check
         i18n_string_util::replace_escaped_control_chars(strToReview);
         string_util::trim(strToReview);
         // see if a function signature before stripping printf commands and whatnot
-        if ((std::regex_match(strToReview, m_function_signature_regex) ||
-             std::regex_match(strToReview, m_open_function_signature_regex)) &&
+        if ((m_function_signature_regex.matches(strToReview) ||
+             m_open_function_signature_regex.matches(strToReview)) &&
             // but allow something like "Item(s)"
-            !std::regex_match(strToReview, m_plural_regex))
+            !m_plural_regex.matches(strToReview))
             {
             return std::make_pair(true, strToReview.length());
             }
@@ -2366,17 +2944,16 @@ namespace i18n_check
             // Note that we skip any punctuation (not word characters, excluding '<')
             // in front of the initial '<' (sometimes there are braces and brackets
             // in front of the HTML tags).
-            strToReview =
-                std::regex_replace(strToReview, std::wregex(LR"(<br[[:space:]]*\/>)"), L"\n");
+            strToReview = std::regex_replace(strToReview, htmlBreakRegex, L"\n");
             string_util::trim(strToReview);
-            if (std::regex_match(strToReview, m_xml_element_regex) ||
-                std::regex_match(strToReview, m_html_regex) ||
-                std::regex_match(strToReview, m_html_element_with_content_regex) ||
-                std::regex_match(strToReview, m_html_tag_regex) ||
-                std::regex_match(strToReview, m_html_tag_unicode_regex))
+            if (m_xml_element_regex.matches(strToReview) ||
+                m_html_regex.matches(strToReview) ||
+                m_html_element_with_content_regex.matches(strToReview) ||
+                m_html_tag_regex.matches(strToReview) ||
+                m_html_tag_unicode_regex.matches(strToReview))
                 {
                 // it's really something like "<enter comment.>", which can be translatable
-                if (std::regex_match(strToReview, m_not_xml_element_regex))
+                if (m_not_xml_element_regex.matches(strToReview))
                     {
                     return std::make_pair(false, strToReview.length());
                     }
@@ -2384,8 +2961,8 @@ namespace i18n_check
                 // Avoid a false positive for single words in braces.
                 // It may be an HTML/XML element, but it may also be a user-facing string,
                 // so error on the side of that.
-                if (std::regex_match(strToReview, m_angle_braced_one_word_regex) &&
-                    !std::regex_match(strToReview, m_html_known_elements_regex))
+                if (m_angle_braced_one_word_regex.matches(strToReview) &&
+                    !m_html_known_elements_regex.matches(strToReview))
                     {
                     if (limitWordCount)
                         {
@@ -2405,34 +2982,27 @@ namespace i18n_check
                         return std::make_pair(false, strToReview.length());
                         }
                     }
-                strToReview = std::regex_replace(
-                    strToReview, std::wregex(LR"(<script[\d\D]*?>[\d\D]*?</script>)"), L"");
-                strToReview = std::regex_replace(
-                    strToReview, std::wregex(LR"(<style[\d\D]*?>[\d\D]*?</style>)"), L"");
-                strToReview = std::regex_replace(
-                    strToReview,
-                    std::wregex(L"<[?]?[A-Za-z0-9+_/\\-\\.'\"=;:!%[:space:]\\\\,()]+[?]?>"), L"");
-                strToReview = std::regex_replace(strToReview, m_xml_element_regex, L"");
+                strToReview = std::regex_replace(strToReview, htmlScriptRegex, L"");
+                strToReview = std::regex_replace(strToReview, htmlStyleRegex, L"");
+                strToReview = std::regex_replace(strToReview, htmlTagRegex, L"");
+                strToReview = std::regex_replace(strToReview, xmlElementRegex, L"");
                 // strip things like &ldquo;
-                strToReview = std::regex_replace(strToReview, std::wregex(L"&[a-zA-Z]{2,5};"), L"");
-                strToReview =
-                    std::regex_replace(strToReview, std::wregex(L"&#[[:digit:]]{2,4};"), L"");
+                strToReview = std::regex_replace(strToReview, htmlEntityRegex, L"");
+                strToReview = std::regex_replace(strToReview, htmlNumericEntityRegex, L"");
                 }
 
             // strings that may look like they should not be translatable, but are actually OK
-            for (const auto& reg : m_translatable_regexes)
+            if (const auto matchedRegex = m_rules->m_translatable_regexes.find_match(strToReview))
                 {
-                if (std::regex_match(strToReview, reg))
-                    {
 #ifndef NDEBUG
-                    if (strToReview.length() > m_longest_internal_string.first.length())
-                        {
-                        m_longest_internal_string.first = strToReview;
-                        m_longest_internal_string.second = reg;
-                        }
-#endif
-                    return std::make_pair(false, strToReview.length());
+                if (strToReview.length() > m_longest_internal_string.first.length())
+                    {
+                    m_longest_internal_string.first = strToReview;
+                    m_longest_internal_string.second =
+                        m_rules->m_translatable_regexes.get_pattern(*matchedRegex).m_pattern;
                     }
+#endif
+                return std::make_pair(false, strToReview.length());
                 }
 
             // see if it has enough words
@@ -2454,7 +3024,7 @@ namespace i18n_check
 
             // Nothing but punctuation? If that's OK to allow, then let it through.
             if (is_allowing_translating_punctuation_only_strings() &&
-                std::regex_match(strToReview, std::wregex(L"[[:punct:]]+")))
+                punctuationRegex.matches(strToReview))
                 {
                 return std::make_pair(false, strToReview.length());
                 }
@@ -2473,7 +3043,7 @@ namespace i18n_check
             constexpr size_t maxWordSize{ 20 };
             if (strToReview.length() <= 1 ||
                 // not at least two letters together
-                !std::regex_search(strToReview, m_2letter_regex) ||
+                !m_2letter_regex.search(strToReview) ||
                 // single word (no spaces or word separators) and more than 20 characters--
                 // doesn't seem like a real word meant for translation
                 (strToReview.length() > maxWordSize &&
@@ -2481,14 +3051,11 @@ namespace i18n_check
                  strToReview.find(L"\\n") == std::wstring::npos &&
                  strToReview.find(L"\\r") == std::wstring::npos &&
                  strToReview.find(L"\\t") == std::wstring::npos) ||
-                m_known_internal_strings.find(strToReview.c_str()) !=
-                    m_known_internal_strings.end() ||
+                m_rules->m_known_internal_strings.contains(strToReview) ||
                 // a string like "_tcscoll" be odd to be in string, but just in case it
                 // should not be localized
-                m_deprecated_string_functions.find(strToReview.c_str()) !=
-                    m_deprecated_string_functions.end() ||
-                m_deprecated_string_macros.find(strToReview.c_str()) !=
-                    m_deprecated_string_macros.end())
+                m_rules->m_deprecated_string_functions.contains(strToReview) ||
+                m_rules->m_deprecated_string_macros.contains(strToReview))
                 {
                 return std::make_pair(true, strToReview.length());
                 }
@@ -2499,11 +3066,10 @@ namespace i18n_check
                 }
             // social media hashtag (or formatting code of some sort),
             // keyboard shortcuts, code, placeholder text, etc.
-            if (std::regex_match(strToReview, m_hashtag_regex) ||
-                std::regex_match(strToReview, m_key_shortcut_regex) ||
-                std::regex_match(strToReview, loremIpsum) ||
-                std::regex_match(strToReview, brownFox) ||
-                std::regex_match(strToReview, m_sql_code))
+            if (m_hashtag_regex.matches(strToReview) ||
+                m_key_shortcut_regex.matches(strToReview) ||
+                loremIpsum.matches(strToReview) || brownFox.matches(strToReview) ||
+                m_sql_code.matches(strToReview))
                 {
                 return std::make_pair(true, strToReview.length());
                 }
@@ -2517,27 +3083,25 @@ namespace i18n_check
                 return std::make_pair(false, strToReview.length());
                 }
 
-            if (m_untranslatable_exceptions.find(strToReview) != m_untranslatable_exceptions.cend())
+            if (m_rules->m_untranslatable_exceptions.contains(strToReview))
                 {
                 return std::make_pair(false, strToReview.length());
                 }
 
-            for (const auto& reg : m_untranslatable_regexes)
+            if (const auto matchedRegex = m_rules->m_untranslatable_regexes.find_match(strToReview))
                 {
-                if (std::regex_match(strToReview, reg))
-                    {
 #ifndef NDEBUG
-                    if (strToReview.length() > m_longest_internal_string.first.length())
-                        {
-                        m_longest_internal_string.first = strToReview;
-                        m_longest_internal_string.second = reg;
-                        }
-#endif
-                    return std::make_pair(true, strToReview.length());
+                if (strToReview.length() > m_longest_internal_string.first.length())
+                    {
+                    m_longest_internal_string.first = strToReview;
+                    m_longest_internal_string.second =
+                        m_rules->m_untranslatable_regexes.get_pattern(*matchedRegex).m_pattern;
                     }
+#endif
+                return std::make_pair(true, strToReview.length());
                 }
-            return std::make_pair((is_font_name(strToReview.c_str()) ||
-                                   is_file_extension(strToReview.c_str()) ||
+            return std::make_pair((is_font_name(strToReview) ||
+                                   is_file_extension(strToReview) ||
                                    i18n_string_util::is_file_address(strToReview)),
                                   strToReview.length());
             }
@@ -2550,41 +3114,55 @@ namespace i18n_check
         }
 
     //--------------------------------------------------
-    std::wstring i18n_review::collapse_multipart_string(std::wstring str) const
+    void i18n_review::collapse_multipart_string(std::wstring& str,
+                                                std::pmr::wstring& buffer) const
         {
         // for strings that span multiple lines, remove the start/end quotes and newlines
         // between them, combining this into one string
-        const std::wregex multilineRegex(LR"(([^\\])("[\s]+"))");
-        str = std::regex_replace(str, multilineRegex, L"$1");
+        static const std::wregex multilineRegex(LR"(([^\\])("[\s]+"))");
+        // most strings are on one line, so don't copy those
+        if (str.find(L'"') != std::wstring::npos)
+            {
+            // the collapsed string is never longer, so copying it back reuses str's memory
+            buffer.clear();
+            std::regex_replace(std::back_inserter(buffer), str.cbegin(), str.cend(),
+                               multilineRegex, L"$1");
+            str.assign(buffer);
+            }
         // replace any doubled-up quotes with single
         // (C# does this for raw strings)
         if (m_collapse_double_quotes)
             {
             string_util::replace_all<std::wstring>(str, LR"("")", LR"(")");
             }
-        return str;
         }
 
     //--------------------------------------------------
     void i18n_review::process_strings()
         {
-        const auto processStrings = [this](auto& strings)
-        {
-            std::for_each(strings.begin(), strings.end(), [this](auto& val)
-                          { val.m_string = i18n_review::collapse_multipart_string(val.m_string); });
-        };
-        processStrings(m_localizable_strings);
-        processStrings(m_localizable_strings_in_internal_call);
-        processStrings(m_not_available_for_localization_strings);
-        processStrings(m_marked_as_non_localizable_strings);
-        processStrings(m_internal_strings);
-        processStrings(m_unsafe_localizable_strings);
+        results_store::issue_mask stringCategories;
+        stringCategories.set(static_cast<size_t>(result_category::localizable));
+        stringCategories.set(static_cast<size_t>(result_category::in_internal_call));
+        stringCategories.set(static_cast<size_t>(result_category::not_available_for_localization));
+        stringCategories.set(static_cast<size_t>(result_category::marked_as_non_localizable));
+        stringCategories.set(static_cast<size_t>(result_category::internal));
+        stringCategories.set(static_cast<size_t>(result_category::unsafe_localizable));
+        // each string is only stored once, so it is only processed once
+        // (no matter how many of these categories it is in)
+        std::pmr::wstring collapseBuffer{ m_scratch.get_resource() };
+        for (size_t i = 0; i < m_results.size(); ++i)
+            {
+            if ((m_results.get_issues(i) & stringCategories).any())
+                {
+                collapse_multipart_string(m_results.get_record(i).m_string, collapseBuffer);
+                }
+            }
         }
 
     //--------------------------------------------------
     void i18n_review::run_diagnostics()
         {
-        for (const auto& str : m_localizable_strings)
+        for (const auto& str : get_results(result_category::localizable))
             {
             if (str.m_usage.m_value.empty() &&
                 str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
@@ -2594,7 +3172,7 @@ namespace i18n_check
                             std::wstring::npos);
                 }
             }
-        for (const auto& str : m_not_available_for_localization_strings)
+        for (const auto& str : get_results(result_category::not_available_for_localization))
             {
             if (str.m_usage.m_value.empty() &&
                 str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
@@ -2604,7 +3182,7 @@ namespace i18n_check
                             std::wstring::npos);
                 }
             }
-        for (const auto& str : m_marked_as_non_localizable_strings)
+        for (const auto& str : get_results(result_category::marked_as_non_localizable))
             {
             if (str.m_usage.m_value.empty() &&
                 str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
@@ -2614,7 +3192,7 @@ namespace i18n_check
                             std::wstring::npos);
                 }
             }
-        for (const auto& str : m_internal_strings)
+        for (const auto& str : get_results(result_category::internal))
             {
             if (str.m_usage.m_value.empty() &&
                 str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
@@ -2624,7 +3202,7 @@ namespace i18n_check
                             std::wstring::npos);
                 }
             }
-        for (const auto& str : m_unsafe_localizable_strings)
+        for (const auto& str : get_results(result_category::unsafe_localizable))
             {
             if (str.m_usage.m_value.empty() &&
                 str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
@@ -2639,9 +3217,9 @@ namespace i18n_check
     //--------------------------------------------------
     const wchar_t* i18n_review::read_var_or_function_name(const wchar_t* startPos,
                                                           const wchar_t* const startSentinel,
-                                                          std::wstring& functionName,
+                                                          std::pmr::wstring& functionName,
                                                           variable_info& variableInfo,
-                                                          std::wstring& deprecatedMacroEncountered,
+                                                          std::pmr::wstring& deprecatedMacroEncountered,
                                                           size_t& parameterPosition)
         {
         functionName.clear();
@@ -2799,7 +3377,7 @@ namespace i18n_check
                 // and keep going backwards.
                 // Or, if no function name probably means extraneous parentheses, so keep going.
                 if (hasExtraneousParens ||
-                    m_ctors_to_ignore.find(functionName) != m_ctors_to_ignore.cend())
+                    m_rules->m_ctors_to_ignore.contains(functionName))
                     {
                     startPos = std::min(startPos, functionOrVarNamePos);
                     // reset, the current open parenthesis isn't relevant
@@ -2811,8 +3389,7 @@ namespace i18n_check
                         {
                         closeBraseCount = 0;
                         }
-                    if (m_deprecated_string_macros.find(functionName) !=
-                        m_deprecated_string_macros.cend())
+                    if (m_rules->m_deprecated_string_macros.contains(functionName))
                         {
                         deprecatedMacroEncountered = functionName;
                         }
@@ -2833,8 +3410,7 @@ namespace i18n_check
                     }
                 // construction of a variable type that takes
                 // non-localizable strings, just skip it entirely
-                if (m_variable_types_to_ignore.find(functionName) !=
-                    m_variable_types_to_ignore.cend())
+                if (is_ignored_variable_type(functionName))
                     {
                     break;
                     }
@@ -2843,12 +3419,10 @@ namespace i18n_check
                     {
                     // see if function is actually a CTOR
                     if (variableInfo.m_name.empty() &&
-                        m_localization_functions.find(functionName) ==
-                            m_localization_functions.cend() &&
-                        m_non_localizable_functions.find(functionName) ==
-                            m_non_localizable_functions.cend() &&
-                        m_internal_functions.find(functionName) == m_internal_functions.cend() &&
-                        m_log_functions.find(functionName) == m_log_functions.cend() &&
+                        !m_rules->m_localization_functions.contains(functionName) &&
+                        !m_rules->m_non_localizable_functions.contains(functionName) &&
+                        !m_rules->m_internal_functions.contains(functionName) &&
+                        !m_rules->m_log_functions.contains(functionName) &&
                         functionOrVarNamePos >= startSentinel && !is_keyword(functionName))
                         {
                         readVarType();
@@ -2976,10 +3550,8 @@ namespace i18n_check
                         // ignore localization related functions; in this case, it is the
                         // (temporary) string objects << operator being called,
                         // not the localization function
-                        if (m_localization_functions.find(functionName) !=
-                                m_localization_functions.cend() ||
-                            m_non_localizable_functions.find(functionName) !=
-                                m_non_localizable_functions.cend())
+                        if (m_rules->m_localization_functions.contains(functionName) ||
+                            m_rules->m_non_localizable_functions.contains(functionName))
                             {
                             functionName.clear();
                             }
@@ -3459,6 +4031,55 @@ namespace i18n_check
         return { true, msgId, idPos, idEndPos };
         }
 
+    //--------------------------------------------------
+    void line_index::index(std::wstring_view text)
+        {
+        clear();
+        // a rough guess of the average line length, so that large files
+        // are not constantly reallocating
+        m_line_starts.reserve((text.length() / 32) + 1);
+        m_line_starts.push_back(0);
+        m_follows_crlf.push_back(false);
+        for (size_t i = 0; i < text.length(); ++i)
+            {
+            if (text[i] == L'\r' && i + 1 < text.length() && text[i + 1] == L'\n')
+                {
+                ++i;
+                m_line_starts.push_back(i + 1);
+                m_follows_crlf.push_back(true);
+                }
+            else if (text[i] == L'\r' || text[i] == L'\n' || text[i] == 0)
+                {
+                m_line_starts.push_back(i + 1);
+                m_follows_crlf.push_back(false);
+                }
+            }
+        }
+
+    //--------------------------------------------------
+    std::pair<size_t, size_t> line_index::get_line_and_column(size_t position) const
+        {
+        if (position == std::wstring::npos || m_line_starts.empty())
+            {
+            return std::make_pair(std::wstring::npos, std::wstring::npos);
+            }
+
+        // the line start at or before the position
+        auto lineStart = std::prev(std::upper_bound(m_line_starts.cbegin(), m_line_starts.cend(),
+                                                    position));
+        // the LF of a CRLF is seen as being at the start of the next line
+        const auto nextLineStart = std::next(lineStart);
+        if (nextLineStart != m_line_starts.cend() && *nextLineStart == position + 1 &&
+            m_follows_crlf[static_cast<size_t>(nextLineStart - m_line_starts.cbegin())])
+            {
+            lineStart = nextLineStart;
+            ++position;
+            }
+        // make one-indexed
+        return std::make_pair(static_cast<size_t>(lineStart - m_line_starts.cbegin()) + 1,
+                              (position - *lineStart) + 1);
+        }
+
     //--------------------------------------------------
     std::pair<size_t, size_t>
     i18n_review::get_line_and_column(size_t position,
@@ -3469,30 +4090,23 @@ namespace i18n_check
             return std::make_pair(std::wstring::npos, std::wstring::npos);
             }
 
-        const auto* startSentinel = (!fileStart.empty() ? fileStart.data() : m_file_start);
-        if (startSentinel == nullptr)
+        if (!m_line_index.empty())
             {
-            return std::make_pair(std::wstring::npos, std::wstring::npos);
+            return m_line_index.get_line_and_column(position);
             }
-        size_t nextLinePosition{ 0 };
-        size_t lineCount{ 0 };
-        while ((nextLinePosition = std::wcscspn(startSentinel, L"\r\n")) < position)
+
+        // the file's lines weren't indexed, so index them just for this lookup
+        const std::wstring_view fileText{ !fileStart.empty() ?
+                                              fileStart :
+                                              (m_file_start != nullptr ?
+                                                   std::wstring_view{ m_file_start } :
+                                                   std::wstring_view{}) };
+        if (fileText.empty())
             {
-            ++lineCount;
-            if (nextLinePosition + 1 < position &&
-                *std::next(startSentinel, static_cast<ptrdiff_t>(nextLinePosition)) == L'\r' &&
-                *std::next(startSentinel, static_cast<ptrdiff_t>(nextLinePosition + 1)) == L'\n')
-                {
-                std::advance(startSentinel, nextLinePosition + 2);
-                position -= nextLinePosition + 2;
-                }
-            else
-                {
-                std::advance(startSentinel, nextLinePosition + 1);
-                position -= nextLinePosition + 1;
-                }
+            return std::make_pair(std::wstring::npos, std::wstring::npos);
             }
-        // make one-indexed
-        return std::make_pair(lineCount + 1, position + 1);
+        line_index fileLines;
+        fileLines.index(fileText);
+        return fileLines.get_line_and_column(position);
         }
     } // namespace i18n_check
@@ -18,14 +18,30 @@
 #ifndef __I18N_REVIEW_H__
 #define __I18N_REVIEW_H__
 
+#include "check_profile.h"
+#include "classification_cache.h"
 #include "donttranslate.h"
 #include "i18n_string_util.h"
+#include "interned_string.h"
+#include "issue_store.h"
+#include "regex_pattern.h"
+#include "rule_set.h"
+#include "scratch_arena.h"
+#include "token_stream.h"
+#include <algorithm>
+#include <cstdint>
 #include <filesystem>
 #include <format>
+#include <functional>
+#include <istream>
 #include <map>
+#include <memory>
+#include <memory_resource>
 #include <optional>
+#include <ostream>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #ifndef CPPCHECK_SKIP_SECTION
@@ -298,6 +314,61 @@ namespace i18n_check
         std::wstring m_comment;
         };
 
+    /// @brief Index of where each line in a file starts, which is used
+    ///     to look up the line and column of a character position.
+    class line_index
+        {
+      public:
+        /** @brief Indexes the line starts in a block of text.
+            @details Line breaks can be CRLF, CR, or LF (or a null terminator).
+            @param text The text to index.*/
+        void index(std::wstring_view text);
+
+        /// @brief Removes the indexed lines.
+        void clear() noexcept
+            {
+            m_line_starts.clear();
+            m_follows_crlf.clear();
+            }
+
+        /// @returns @c true if no text has been indexed.
+        [[nodiscard]]
+        bool empty() const noexcept
+            {
+            return m_line_starts.empty();
+            }
+
+        /// @returns The (one-indexed) line and column from a character position.
+        /// @param position The character position in the indexed text.
+        [[nodiscard]]
+        std::pair<size_t, size_t> get_line_and_column(size_t position) const;
+
+      private:
+        std::vector<size_t> m_line_starts;
+        // whether the line start at the same index follows a CRLF
+        std::vector<bool> m_follows_crlf;
+        };
+
+    /// @brief Inclusive ranges of (one-indexed) lines, sorted by line.
+    using line_ranges = std::vector<std::pair<size_t, size_t>>;
+
+    /// @brief The lines that were added or changed in each file (e.g., from a patch).
+    using changed_lines_map = std::map<std::filesystem::path, line_ranges>;
+
+    /// @returns @c true if a line is within a list of line ranges.
+    /// @param ranges The (sorted) line ranges.
+    /// @param line The line to look for.
+    [[nodiscard]]
+    inline bool is_line_in_ranges(const line_ranges& ranges, const size_t line) noexcept
+        {
+        // find the first range that starts after the line, the one before it may contain it
+        const auto nextRange =
+            std::upper_bound(ranges.cbegin(), ranges.cend(), line,
+                             [](const size_t value, const std::pair<size_t, size_t>& range)
+                             { return value < range.first; });
+        return nextRange != ranges.cbegin() && line <= std::prev(nextRange)->second;
+        }
+
     /// @brief Progress callback for analyze().
     /// @details This passes back the current counter and name of the file
     /// currently being analyzed.
@@ -305,6 +376,9 @@ namespace i18n_check
     /// @brief Can reset the progress mechanism that the associated analyze_callback is using.
     /// @details This passes back the number of items that the progress callback should expect.
     using analyze_callback_reset = std::function<void(const size_t)>;
+    /// @brief Returns a file's position in the list of files being analyzed.
+    /// @details This is used to sort results by file after a parallel analysis.
+    using file_index_callback = std::function<size_t(const std::filesystem::path&)>;
 
     /** @brief Class to extract and review localizable/nonlocalizable
             text from source code.*/
@@ -312,12 +386,19 @@ namespace i18n_check
         {
       public:
         /// @private
+        /// @details This is only used while reviewing a file, so its strings can be allocated
+        ///     from the analyzer's scratch memory.
         struct variable_info
             {
             variable_info() = default;
 
-            variable_info(std::wstring name, std::wstring type, std::wstring oper)
-                : m_name(std::move(name)), m_type(std::move(type)), m_operator(std::move(oper))
+            explicit variable_info(std::pmr::memory_resource* resource)
+                : m_name(resource), m_type(resource), m_operator(resource)
+                {
+                }
+
+            variable_info(std::wstring_view name, std::wstring_view type, std::wstring_view oper)
+                : m_name(name), m_type(type), m_operator(oper)
                 {
                 }
 
@@ -328,14 +409,37 @@ namespace i18n_check
                 m_operator.clear();
                 }
 
-            std::wstring m_name;
-            std::wstring m_type;
-            std::wstring m_operator;
+            std::pmr::wstring m_name;
+            std::pmr::wstring m_type;
+            std::pmr::wstring m_operator;
             };
 
         /// @brief Information about a string found in the source code.
+        /// @details The file and usage names are interned, so that results (and their copies)
+        ///     share them rather than each having their own copy.
         struct string_info
             {
+            /// @brief The variable that a string is assigned to.
+            struct usage_variable_info
+                {
+                /// @private
+                usage_variable_info() = default;
+
+                /// @private
+                usage_variable_info(interned_string name, interned_string type,
+                                    interned_string oper)
+                    : m_name(name), m_type(type), m_operator(oper)
+                    {
+                    }
+
+                /// @private
+                interned_string m_name;
+                /// @private
+                interned_string m_type;
+                /// @private
+                interned_string m_operator;
+                };
+
             /// @brief What the string is being used for.
             struct usage_info
                 {
@@ -353,10 +457,10 @@ namespace i18n_check
                 usage_info() = default;
 
                 /// @private
-                usage_info(const usage_type& type, std::wstring val, std::wstring varType,
-                           std::wstring varOperator)
-                    : m_type(type), m_value(std::move(val)),
-                      m_variableInfo(std::wstring{}, varType, varOperator)
+                usage_info(const usage_type& type, const std::wstring_view val,
+                           const std::wstring_view varType, const std::wstring_view varOperator)
+                    : m_type(type), m_value(val),
+                      m_variableInfo(interned_string{}, varType, varOperator)
                     {
                     if (m_type == usage_type::variable)
                         {
@@ -365,10 +469,12 @@ namespace i18n_check
                     }
 
                 /// @private
-                usage_info(const usage_type& type, std::wstring val, std::wstring varType,
-                           std::wstring varOperator, bool hasContext)
-                    : m_type(type), m_value(std::move(val)),
-                      m_variableInfo(std::wstring{}, varType, varOperator), m_hasContext(hasContext)
+                usage_info(const usage_type& type, const std::wstring_view val,
+                           const std::wstring_view varType, const std::wstring_view varOperator,
+                           bool hasContext)
+                    : m_type(type), m_value(val),
+                      m_variableInfo(interned_string{}, varType, varOperator),
+                      m_hasContext(hasContext)
                     {
                     if (m_type == usage_type::variable)
                         {
@@ -377,14 +483,14 @@ namespace i18n_check
                     }
 
                 /// @private
-                explicit usage_info(std::wstring val) : m_value(std::move(val)) {}
+                explicit usage_info(const std::wstring& val) : m_value(val) {}
 
                 /// @private
                 usage_type m_type{ usage_type::function };
                 /// @private
-                std::wstring m_value;
+                interned_string m_value;
                 /// @private
-                variable_info m_variableInfo;
+                usage_variable_info m_variableInfo;
                 /// @private
                 bool m_hasContext{ false };
                 };
@@ -394,10 +500,10 @@ namespace i18n_check
                 @param usage What the string is being used for.
                 @param fileName The filename.
                 @param lineAndColumn The line and column number.*/
-            string_info(std::wstring str, usage_info usage, std::filesystem::path fileName,
+            string_info(std::wstring str, usage_info usage, interned_path fileName,
                         const std::pair<size_t, size_t> lineAndColumn)
-                : m_string(std::move(str)), m_usage(std::move(usage)),
-                  m_file_name(std::move(fileName)), m_line(lineAndColumn.first),
+                : m_string(std::move(str)), m_usage(usage), m_file_name(fileName),
+                  m_line(lineAndColumn.first),
                   m_column(lineAndColumn.second)
                 {
                 }
@@ -409,7 +515,7 @@ namespace i18n_check
             /// @brief What the string is being used for.
             usage_info m_usage;
             /// @brief The filename.
-            std::filesystem::path m_file_name;
+            interned_path m_file_name;
             /// @brief The line number.
             size_t m_line{ 0 };
             /// @brief The column number.
@@ -452,6 +558,47 @@ namespace i18n_check
             size_t m_column{ std::wstring::npos };
             };
 
+        /// @brief The lists of results collected by `operator()` and review_strings().
+        /// @note This is also the order that results are cached in.
+        enum class result_category
+            {
+            localizable,
+            with_unlocalizable_content,
+            with_urls,
+            ambiguous_needing_context,
+            in_internal_call,
+            being_concatenated,
+            with_halfwidths,
+            multipart,
+            faux_plural,
+            article_issue,
+            not_available_for_localization,
+            marked_as_non_localizable,
+            internal,
+            unsafe_localizable,
+            deprecated_macros,
+            unencoded,
+            printf_single_numbers,
+            ids_assigned_number,
+            duplicates_value_assigned_to_ids,
+            malformed,
+            trailing_spaces,
+            tabs,
+            wide_lines,
+            comments_missing_space,
+            suspect_i18n_usage,
+            /// @private
+            category_count
+            };
+
+        /// @brief The store of results, where each string is stored once along with
+        ///     which categories it is in.
+        using results_store =
+            issue_store<string_info, static_cast<size_t>(result_category::category_count)>;
+
+        /// @brief A read-only list of the results in a category.
+        using results_view = results_store::view;
+
         /// @brief Constructor.
         /// @param verbose @c true to include verbose warnings.
         i18n_review(const bool verbose);
@@ -459,17 +606,34 @@ namespace i18n_check
         /// @private
         virtual ~i18n_review() {}
 
+        /// @returns The rules (e.g., localization functions) that the analyzer uses.
+        /// @details Analyzers share the same rules until they are customized.
+        [[nodiscard]]
+        const rule_set& get_rules() const noexcept
+            {
+            return *m_rules;
+            }
+
+        /** @returns The built-in rules, which are built once and shared by all analyzers.
+            @param verbose @c true for the rules used by verbose analyzers
+                (which include more deprecated functions).*/
+        [[nodiscard]]
+        static const std::shared_ptr<const rule_set>& get_default_rules(const bool verbose);
+
         /** @brief Adds a function to be considered as internal (e.g., debug functions).
             @details Strings passed to this function will not be considered translatable.
             @param func The function to ignore.*/
-        void add_function_to_ignore(const std::wstring& func) { m_internal_functions.insert(func); }
+        void add_function_to_ignore(const std::wstring& func)
+            {
+            get_own_rules().m_internal_functions.insert(func);
+            }
 
         /** @brief Adds a function that loads hard-coded strings as translatable resources.
             @details This is usually functions like those found in the gettext library.
             @param func The function to consider as a resource-loading function.*/
         void add_translation_extraction_function(const std::wstring& func)
             {
-            m_localization_functions.insert(func);
+            get_own_rules().m_localization_functions.insert(func);
             }
 
         /** @brief Sets which checks are being performed.
@@ -497,6 +661,20 @@ namespace i18n_check
         operator()(std::wstring_view file_text,
                    const std::filesystem::path& file_name = std::filesystem::path{}) = 0;
 
+        /** @brief Reviews text that the analyzer is allowed to modify while parsing it.
+            @details Analyzers that need a writable copy of the text (e.g., the C++ analyzer)
+                will parse this buffer directly, rather than making their own copy of it.
+                This is meant for the batch analyzer, which decodes each file into a
+                buffer that isn't needed afterwards.
+            @param file_text The text to review.\n
+                Its content is unspecified after the review.
+            @param file_name The (optional) name of source file being analyzed.*/
+        virtual void review_buffer(std::wstring& file_text,
+                                   const std::filesystem::path& file_name = std::filesystem::path{})
+            {
+            (*this)(file_text, file_name);
+            }
+
         /** @brief Finalizes the review process after all files have been loaded.
             @details Reviews any strings that are available for translation that are suspect,
                 cleans the strings, and logs any parsing issues.
@@ -512,188 +690,186 @@ namespace i18n_check
 
         /// @returns The strings in the code that are set to be extracted as translatable.
         [[nodiscard]]
-        const std::vector<string_info>& get_localizable_strings() const noexcept
+        results_view get_localizable_strings() const noexcept
             {
-            return m_localizable_strings;
+            return get_results(result_category::localizable);
             }
 
         /// @returns The hard-coded strings in the code that should probably
         ///     be exposed for translation.
         [[nodiscard]]
-        const std::vector<string_info>& get_not_available_for_localization_strings() const noexcept
+        results_view get_not_available_for_localization_strings() const noexcept
             {
-            return m_not_available_for_localization_strings;
+            return get_results(result_category::not_available_for_localization);
             }
 
         /// @returns The deprecated text macros that were encountered.
         [[nodiscard]]
-        const std::vector<string_info>& get_deprecated_macros() const noexcept
+        results_view get_deprecated_macros() const noexcept
             {
-            return m_deprecated_macros;
+            return get_results(result_category::deprecated_macros);
             }
 
         /// @returns Strings that have been explicitly set to not be translatable
         ///     (usually by the DONTTRANSLATE() function).
         [[nodiscard]]
-        const std::vector<string_info>& get_marked_as_non_localizable_strings() const noexcept
+        results_view get_marked_as_non_localizable_strings() const noexcept
             {
-            return m_marked_as_non_localizable_strings;
+            return get_results(result_category::marked_as_non_localizable);
             }
 
         [[nodiscard]]
-        const std::vector<string_info>& get_localizable_strings_in_internal_call() const noexcept
+        results_view get_localizable_strings_in_internal_call() const noexcept
             {
-            return m_localizable_strings_in_internal_call;
+            return get_results(result_category::in_internal_call);
             }
 
         /// @returns The strings that are intentionally not translatable
         ///     (e.g., diagnostic messages).
         [[nodiscard]]
-        const std::vector<string_info>& get_internal_strings() const noexcept
+        results_view get_internal_strings() const noexcept
             {
-            return m_internal_strings;
+            return get_results(result_category::internal);
             }
 
         /// @returns The strings that are being extracted as localizable,
         ///     but don't appear to be safe to actually translate.
         [[nodiscard]]
-        const std::vector<string_info>& get_unsafe_localizable_strings() const noexcept
+        results_view get_unsafe_localizable_strings() const noexcept
             {
-            return m_unsafe_localizable_strings;
+            return get_results(result_category::unsafe_localizable);
             }
 
         /// @returns Suspect usage of i18n functions.
         [[nodiscard]]
-        const std::vector<string_info>& get_suspect_i18n_usuage() const noexcept
+        results_view get_suspect_i18n_usuage() const noexcept
             {
-            return m_suspect_i18n_usage;
+            return get_results(result_category::suspect_i18n_usage);
             }
 
         /// @returns The strings that are being extracted as localizable,
         ///     but contain URLs or email addresses.
         [[nodiscard]]
-        const std::vector<string_info>& get_localizable_strings_with_urls() const noexcept
+        results_view get_localizable_strings_with_urls() const noexcept
             {
-            return m_localizable_strings_with_urls;
+            return get_results(result_category::with_urls);
             }
 
         /// @returns The strings that are being extracted as localizable,
         ///     but contain large blocks of untranslatable content (e.g., HTML tags).
         [[nodiscard]]
-        const std::vector<string_info>&
-        get_localizable_strings_with_unlocalizable_content() const noexcept
+        results_view get_localizable_strings_with_unlocalizable_content() const noexcept
             {
-            return m_localizable_strings_with_unlocalizable_content;
+            return get_results(result_category::with_unlocalizable_content);
             }
 
         /// @returns The strings that are being extracted as localizable,
         ///     but are ambiguous and lack a translator comment.
         [[nodiscard]]
-        const std::vector<string_info>&
-        get_localizable_strings_ambiguous_needing_context() const noexcept
+        results_view get_localizable_strings_ambiguous_needing_context() const noexcept
             {
-            return m_localizable_strings_ambiguous_needing_context;
+            return get_results(result_category::ambiguous_needing_context);
             }
 
         /// @returns The strings that are being extracted as localizable,
         ///     but may be concatenated at runtime.
         [[nodiscard]]
-        const std::vector<string_info>& get_localizable_strings_being_concatenated() const noexcept
+        results_view get_localizable_strings_being_concatenated() const noexcept
             {
-            return m_localizable_strings_being_concatenated;
+            return get_results(result_category::being_concatenated);
             }
 
         /// @returns The strings that contain halfwidth characters.
         [[nodiscard]]
-        const std::vector<string_info>& get_localizable_strings_with_halfwidths() const noexcept
+        results_view get_localizable_strings_with_halfwidths() const noexcept
             {
-            return m_localizable_strings_with_halfwidths;
+            return get_results(result_category::with_halfwidths);
             }
 
         /// @returns The strings that appear to contain multiple sections.
         [[nodiscard]]
-        const std::vector<string_info>& get_multipart_strings() const noexcept
+        results_view get_multipart_strings() const noexcept
             {
-            return m_multipart_strings;
+            return get_results(result_category::multipart);
             }
 
         /// @returns The strings that are used for both singular and plural.
         [[nodiscard]]
-        const std::vector<string_info>& get_faux_plural_strings() const noexcept
+        results_view get_faux_plural_strings() const noexcept
             {
-            return m_faux_plural_strings;
+            return get_results(result_category::faux_plural);
             }
 
         /// @returns The strings that contain articles proceeding dynamic placeholders.
         [[nodiscard]]
-        const std::vector<string_info>& get_article_issue_strings() const noexcept
+        results_view get_article_issue_strings() const noexcept
             {
-            return m_article_issue_strings;
+            return get_results(result_category::article_issue);
             }
 
         /// @returns The strings that contain extended ASCII characters, but are not encoded.
         [[nodiscard]]
-        const std::vector<string_info>& get_unencoded_ext_ascii_strings() const noexcept
+        results_view get_unencoded_ext_ascii_strings() const noexcept
             {
-            return m_unencoded_strings;
+            return get_results(result_category::unencoded);
             }
 
         /// @returns The strings that are a printf() command that only formats one number.\n
         ///     It is simpler to use std::to_string() variants to avoid potentially dangerous
         ///     printf() calls.
         [[nodiscard]]
-        const std::vector<string_info>& get_printf_single_numbers() const noexcept
+        results_view get_printf_single_numbers() const noexcept
             {
-            return m_printf_single_numbers;
+            return get_results(result_category::printf_single_numbers);
             }
 
         /// @returns IDs that are assigned a hard-coded numeric value.
         [[nodiscard]]
-        const std::vector<string_info>& get_ids_assigned_number() const noexcept
+        results_view get_ids_assigned_number() const noexcept
             {
-            return m_ids_assigned_number;
+            return get_results(result_category::ids_assigned_number);
             }
 
         /// @returns IDs that have the same value assigned to them.
         [[nodiscard]]
-        const std::vector<string_info>& get_duplicates_value_assigned_to_ids() const noexcept
+        results_view get_duplicates_value_assigned_to_ids() const noexcept
             {
-            return m_duplicates_value_assigned_to_ids;
+            return get_results(result_category::duplicates_value_assigned_to_ids);
             }
 
         /// @returns Malformed strings.
         [[nodiscard]]
-        const std::vector<string_info>& get_malformed_strings() const noexcept
+        results_view get_malformed_strings() const noexcept
             {
-            return m_malformed_strings;
+            return get_results(result_category::malformed);
             }
 
         /// @returns Lines with trailing spaces.
         [[nodiscard]]
-        const std::vector<string_info>& get_trailing_spaces() const noexcept
+        results_view get_trailing_spaces() const noexcept
             {
-            return m_trailing_spaces;
+            return get_results(result_category::trailing_spaces);
             }
 
         /// @returns Tabs in the files.
         [[nodiscard]]
-        const std::vector<string_info>& get_tabs() const noexcept
+        results_view get_tabs() const noexcept
             {
-            return m_tabs;
+            return get_results(result_category::tabs);
             }
 
         /// @returns Overly long lines.
         [[nodiscard]]
-        const std::vector<string_info>& get_wide_lines() const noexcept
+        results_view get_wide_lines() const noexcept
             {
-            return m_wide_lines;
+            return get_results(result_category::wide_lines);
             }
 
         /// @returns Comments missing a space at their start.
         [[nodiscard]]
-        const std::vector<string_info>& get_comments_missing_space() const noexcept
+        results_view get_comments_missing_space() const noexcept
             {
-            return m_comments_missing_space;
+            return get_results(result_category::comments_missing_space);
             }
 
         /** @brief Adds a regular expression pattern to determine if a variable should be
@@ -707,18 +883,23 @@ namespace i18n_check
                 will be considered a string that should not be translatable.
                 If a translatable string is assigned to a variable matching this
                 pattern, then it will be logged as an error.
-            @param pattern The regex pattern to compare against the variable names.*/
-        static void add_variable_name_pattern_to_ignore(const std::wregex& pattern)
-            {
-            m_variable_name_patterns_to_ignore.push_back(pattern);
+            @param pattern The regex pattern to compare against the variable names.
+            @param flags The pattern's syntax flags.
+            @throws std::regex_error If the pattern is malformed.*/
+        void add_variable_name_pattern_to_ignore(
+            const std::wstring& pattern,
+            const std::regex_constants::syntax_option_type flags = std::regex_constants::ECMAScript)
+            {
+            get_own_rules().m_variable_name_patterns_to_ignore.emplace_back(pattern, flags);
             }
 
-        /// @returns The regex patterns compared against variables that have
-        ///     strings assigned to them. @sa add_variable_name_patterns_to_ignore().
+        /// @returns The regex patterns compared against variables that
+        ///     have strings assigned to them (the built-in patterns, followed by any
+        ///     added by the client). @sa add_variable_name_pattern_to_ignore().
         [[nodiscard]]
-        static std::vector<std::wregex>& get_ignored_variable_patterns() noexcept
+        const std::vector<regex_pattern>& get_ignored_variable_patterns() const noexcept
             {
-            return m_variable_name_patterns_to_ignore;
+            return m_rules->m_variable_name_patterns_to_ignore;
             }
 
         /** @brief Adds a variable type to ignore.
@@ -727,16 +908,17 @@ namespace i18n_check
             @param varType The variable type to ignore.
             @note This only works for variables with string arguments that
                 are constructed in place.*/
-        static void add_variable_type_to_ignore(const std::wstring& varType)
+        void add_variable_type_to_ignore(const std::wstring& varType)
             {
-            m_variable_types_to_ignore.insert(varType);
+            get_own_rules().m_variable_types_to_ignore.insert(varType);
             }
 
-        /// @returns The variable types that will have their string values marked as internal.
+        /// @returns The variable types that will have their string values
+        ///     marked as internal (the built-in types, along with any added by the client).
         [[nodiscard]]
-        static const std::set<std::wstring>& get_ignored_variable_types() noexcept
+        const flat_string_set<>& get_ignored_variable_types() const noexcept
             {
-            return m_variable_types_to_ignore;
+            return m_rules->m_variable_types_to_ignore;
             }
 
         /// @brief Allocates space for the results.
@@ -751,6 +933,124 @@ namespace i18n_check
                 to the parser; it will only reset the results from the last parsing operation.*/
         virtual void clear_results();
 
+        /** @brief Creates a copy of this analyzer's settings (without any of its results).
+            @details This is meant for analyzing different files on separate threads,
+                where the copies' results are later combined into this analyzer
+                via merge_results().
+            @returns The copy of the analyzer.*/
+        [[nodiscard]]
+        virtual std::unique_ptr<i18n_review> clone() const = 0;
+
+        /** @brief Moves the results from other analyzers into this one.
+            @details The results are ordered by file (using @c fileIndex), so that they will
+                be the same as if all the files had been analyzed sequentially by this analyzer.
+            @param analyzers The analyzers (usually created via clone()) to move results from.
+                These analyzers must be the same type as this one, and each file must have
+                been analyzed by only one of them.
+            @param fileIndex Function returning a file's position in the original list of files.
+            @note This only merges the results from `operator()`; review_strings() should
+                be called afterwards on this analyzer.*/
+        virtual void merge_results(const std::vector<i18n_review*>& analyzers,
+                                   const file_index_callback& fileIndex);
+
+        /** @brief Writes the results (from `operator()`) to a stream, so that they can be cached.
+            @details This is meant for an analyzer that has only reviewed one file
+                (e.g., a copy made with clone()). The results are read back with read_results().
+            @param stream The (binary) stream to write to.
+            @param filePath The file that was reviewed.\n
+                Results from this file are written without their path, so that they
+                can be read back for any file with the same content.*/
+        virtual void write_results(std::ostream& stream,
+                                   const std::filesystem::path& filePath) const;
+
+        /** @brief Reads results written by write_results() and adds them to this analyzer.
+            @details The results are added the same way as if the file was passed to
+                `operator()`, so review_strings() should be called afterwards.
+            @param stream The (binary) stream to read from.
+            @param filePath The file that the results are for.
+            @throws std::runtime_error If the results are malformed.*/
+        virtual void read_results(std::istream& stream, const std::filesystem::path& filePath);
+
+        /** @brief Limits the review to the lines that were changed in each file
+                (e.g., the lines that a patch touches).
+            @details Line-level formatting checks (e.g., trailing spaces and tabs) are skipped
+                on other lines, and remove_results_outside_changed_lines() can be called after
+                review_strings() to remove any other results that are not on them.
+            @param changedLines The changed lines in each file,
+                or null (the default) to review all lines.*/
+        void set_changed_lines(std::shared_ptr<const changed_lines_map> changedLines) noexcept
+            {
+            m_changed_lines = std::move(changedLines);
+            }
+
+        /// @returns The lines that the review is limited to, or null if all lines are reviewed.
+        [[nodiscard]]
+        const changed_lines_map* get_changed_lines() const noexcept
+            {
+            return m_changed_lines.get();
+            }
+
+        /** @brief Sets the profile that the time spent in each check is added to.
+            @details This is copied into clones, so the profile must be thread safe
+                (which check_profile is).
+            @param profile The profile, or null (the default) to not time the checks.
+            @note This does nothing unless built with @c QUNEIFORM_PROFILING defined.*/
+        void set_profile(check_profile* profile) noexcept
+            {
+            m_profile = profile;
+            }
+
+        /// @returns The profile that the time spent in each check is added to (can be null).
+        [[nodiscard]]
+        check_profile* get_profile() const noexcept
+            {
+            return m_profile;
+            }
+
+        /** @brief Sets the cache that verdicts about strings' content are remembered in,
+                so that strings which appear many times are only classified once.
+            @details This is copied into clones, so that analyzers running on different
+                threads share it.\n
+                The verdicts depend on the analyzer's settings, so a new cache should be set
+                whenever they change.
+            @param cache The cache, or null (the default) to classify every string.*/
+        void set_classification_cache(std::shared_ptr<classification_cache> cache) noexcept
+            {
+            m_classification_cache = std::move(cache);
+            }
+
+        /// @returns The cache that verdicts about strings' content are remembered in
+        ///     (can be null).
+        [[nodiscard]]
+        classification_cache* get_classification_cache() const noexcept
+            {
+            return m_classification_cache.get();
+            }
+
+        /** @brief Removes the results that are not on the lines set by set_changed_lines().
+            @details Results that aren't connected to a line are kept if their file was changed.\n
+                Call this after review_strings(), so that reviews that span multiple files
+                (e.g., translation catalog consistency) can still see the unchanged lines.*/
+        virtual void remove_results_outside_changed_lines();
+
+        /// @returns A hash of the settings that affect the results from `operator()`.
+        /// @details This is used to make sure that cached results are only reused
+        ///     if they were created with the same settings.
+        [[nodiscard]]
+        virtual uint64_t get_settings_hash() const;
+
+        /** @returns A hash with the lines changed in a file (see set_changed_lines())
+                combined into it.
+            @details Line-level checks are skipped outside of the changed lines, so a file's
+                cached results are keyed by its own changed lines (rather than
+                by every file's in the settings hash).
+            @param hash The hash to combine the changed lines into
+                (e.g., the hash of the file's content).
+            @param filePath The file.*/
+        [[nodiscard]]
+        uint64_t combine_changed_lines_hash(uint64_t hash,
+                                            const std::filesystem::path& filePath) const;
+
         /// @returns A list of errors (usually the regex engine having issues parsing something)
         ///     encountered while parsing the file.
         [[nodiscard]]
@@ -851,32 +1151,32 @@ namespace i18n_check
 
         /** @brief Adds a font face to be ignored if found as a string.
             @param str The font face name.*/
-        static void add_font_name_to_ignore(const string_util::case_insensitive_wstring& str)
+        void add_font_name_to_ignore(const std::wstring_view str)
             {
-            m_font_names.insert(str);
+            get_own_rules().m_font_names.insert(str);
             }
 
         /** @brief Adds a file extension to be ignored if found as a string.
-            @param str The font face name.*/
-        static void add_file_extension_to_ignore(const string_util::case_insensitive_wstring& str)
+            @param str The file extension.*/
+        void add_file_extension_to_ignore(const std::wstring_view str)
             {
-            m_file_extensions.insert(str);
+            get_own_rules().m_file_extensions.insert(str);
             }
 
         /// @returns @c true if string is a known font face name.
         /// @param str The string to review.
         [[nodiscard]]
-        static bool is_font_name(const string_util::case_insensitive_wstring& str)
+        bool is_font_name(const std::wstring_view str) const
             {
-            return m_font_names.find(str) != m_font_names.cend();
+            return m_rules->m_font_names.contains(str);
             }
 
         /// @returns @c true if string is a known file extension.
         /// @param str The string to review.
         [[nodiscard]]
-        static bool is_file_extension(const string_util::case_insensitive_wstring& str)
+        bool is_file_extension(const std::wstring_view str) const
             {
-            return m_file_extensions.find(str) != m_file_extensions.cend();
+            return m_rules->m_file_extensions.contains(str);
             }
 
         /** @brief Loads all `printf` format commands from a string.
@@ -1071,7 +1371,7 @@ namespace i18n_check
         ///     the "(s)" from the string for the singular form and string the parentheses around
         ///     the "(s)" for the plural form.
         [[nodiscard]]
-        static bool is_string_resource_faux_plural(const string_info& str);
+        bool is_string_resource_faux_plural(const string_info& str) const;
 
         /// @returns @c true if a string appears to be used for singular and plural variations.
         /// @param str The string resource to review.
@@ -1093,9 +1393,9 @@ namespace i18n_check
             @param parameterPosition The string's position in the function call (if applicable).
             @param isFollowedByComma Whether the quote is followed by a comma.*/
         void process_quote(wchar_t* currentTextPos, const wchar_t* quoteEnd,
-                           const wchar_t* functionVarNamePos, const std::wstring& functionName,
+                           const wchar_t* functionVarNamePos, std::wstring_view functionName,
                            const variable_info& variableInfo,
-                           const std::wstring& deprecatedMacroEncountered,
+                           std::wstring_view deprecatedMacroEncountered,
                            const size_t parameterPosition, const bool isFollowedByComma);
 
         /// @brief Determines whether a hard-coded string should actually be
@@ -1110,9 +1410,8 @@ namespace i18n_check
         [[nodiscard]]
         bool is_i18n_function(std::wstring_view functionName) const
             {
-            return m_localization_functions.find(functionName) != m_localization_functions.cend() ||
-                   m_localization_functions.find(extract_base_function(functionName)) !=
-                       m_localization_functions.cend();
+            return m_rules->m_localization_functions.contains(functionName) ||
+                   m_rules->m_localization_functions.contains(extract_base_function(functionName));
             }
 
         /// @returns @c true if a function name is a translation extraction function that takes an
@@ -1121,10 +1420,9 @@ namespace i18n_check
         [[nodiscard]]
         bool is_i18n_with_context_function(std::wstring_view functionName) const
             {
-            return m_localization_with_context_functions.find(functionName) !=
-                       m_localization_with_context_functions.cend() ||
-                   m_localization_with_context_functions.find(extract_base_function(
-                       functionName)) != m_localization_with_context_functions.cend();
+            return m_rules->m_localization_with_context_functions.contains(functionName) ||
+                   m_rules->m_localization_with_context_functions.contains(extract_base_function(
+                       functionName));
             }
 
         /// @returns @c true if a function name is a translation noop function.
@@ -1132,10 +1430,9 @@ namespace i18n_check
         [[nodiscard]]
         bool is_non_i18n_function(std::wstring_view functionName) const
             {
-            return m_non_localizable_functions.find(functionName) !=
-                       m_non_localizable_functions.cend() ||
-                   m_non_localizable_functions.find(extract_base_function(functionName)) !=
-                       m_non_localizable_functions.cend();
+            return m_rules->m_non_localizable_functions.contains(functionName) ||
+                   m_rules->m_non_localizable_functions.contains(
+                       extract_base_function(functionName));
             }
 
         /// @returns @c true if a string is a keyword.
@@ -1145,7 +1442,7 @@ namespace i18n_check
         [[nodiscard]]
         bool is_keyword(std::wstring_view str) const
             {
-            return m_keywords.find(str) != m_keywords.cend();
+            return m_rules->m_keywords.contains(str);
             }
 
         /** @brief Logs a debug message.
@@ -1161,20 +1458,42 @@ namespace i18n_check
 
         /** @brief Loads ID assignments in the text to see if there are
                 hard-coded numbers or duplicated assignments.
-            @param fileText The source file's text to analyze.
+            @param tokens The source file's tokens to analyze.
             @param fileName The file name being analyzed.*/
-        void load_id_assignments(const std::wstring_view fileText,
+        void load_id_assignments(const token_stream& tokens,
                                  const std::filesystem::path& fileName);
         /** @brief Loads any deprecated functions found in the text.
-            @param fileText The source file's text to analyze.
+            @param tokens The source file's tokens to analyze.
             @param fileName The file name being analyzed.*/
-        void load_deprecated_functions(const std::wstring_view fileText,
+        void load_deprecated_functions(const token_stream& tokens,
                                        const std::filesystem::path& fileName);
         /** @brief Loads any i18n functions being misused.
-            @param fileText The source file's text to analyze.
+            @param tokens The source file's tokens to analyze.
             @param fileName The file name being analyzed.*/
-        void load_suspect_i18n_ussage(const std::wstring_view fileText,
+        void load_suspect_i18n_ussage(const token_stream& tokens,
                                       const std::filesystem::path& fileName);
+
+        /// @returns A copy of the rules that the analyzer can customize.
+        /// @details The copy replaces the analyzer's rules, so that other analyzers
+        ///     sharing them aren't affected.
+        [[nodiscard]]
+        rule_set& get_own_rules();
+
+        /// @returns @c true if strings assigned to a variable are internal,
+        ///     based on the variable's name.
+        /// @param name The variable name.
+        [[nodiscard]]
+        bool is_ignored_variable_name(std::wstring_view name) const;
+
+        /// @returns @c true if strings passed to a type's constructor are internal.
+        /// @param type The variable type.
+        [[nodiscard]]
+        bool is_ignored_variable_type(std::wstring_view type) const;
+
+        /// @brief Releases the scratch memory used while reviewing a file
+        ///     (adding how much was used to the profile, if profiling).
+        /// @warning Containers using the scratch memory must be destroyed before this is called.
+        void release_scratch();
 #ifdef __UNITTEST
       public:
 #endif
@@ -1191,11 +1510,47 @@ namespace i18n_check
         [[nodiscard]]
         std::pair<bool, size_t> is_untranslatable_string(std::wstring strToReview,
                                                          const bool limitWordCount) const;
+
+        /// @returns The same as is_untranslatable_string(), but looked up from the
+        ///     classification cache (if there is one).
+        /// @param str The string to review.
+        /// @param limitWordCount Whether to consider the string's word count.
+        [[nodiscard]]
+        std::pair<bool, size_t> classify_untranslatable_string(const std::wstring& str,
+                                                               const bool limitWordCount) const
+            {
+            if (m_classification_cache == nullptr)
+                {
+                return is_untranslatable_string(str, limitWordCount);
+                }
+            return m_classification_cache->classify_untranslatable(
+                str, limitWordCount,
+                [this, &str, limitWordCount]()
+                { return is_untranslatable_string(str, limitWordCount); });
+            }
+
+        /// @returns A verdict about a string's content, looked up from the
+        ///     classification cache (if there is one).
+        /// @param str The string to review.
+        /// @param verdict The verdict to look up.
+        /// @param classifier The function that returns the verdict if it isn't cached.
+        template<typename FunctionT>
+        [[nodiscard]]
+        bool classify_string(const std::wstring_view str, const string_verdict verdict,
+                             FunctionT&& classifier) const
+            {
+            if (m_classification_cache == nullptr)
+                {
+                return std::invoke(std::forward<FunctionT>(classifier));
+                }
+            return m_classification_cache->classify(str, verdict,
+                                                    std::forward<FunctionT>(classifier));
+            }
         /// @returns Whether @c functionName is a diagnostic function (e.g., ASSERT) whose
         ///     string parameters shouldn't be translatable.
         /// @param functionName The name of the function to review.
         [[nodiscard]]
-        bool is_diagnostic_function(const std::wstring& functionName) const;
+        bool is_diagnostic_function(std::wstring_view functionName) const;
 
         /// @returns Just the function name from a full function call, stripping
         ///     off any class or namespace information.
@@ -1232,7 +1587,7 @@ namespace i18n_check
         /// @brief Strips off decorations from variable and functions.
         /// @details This is language specific and should be reimplemented in derived classes.
         /// @param str The string to strip.
-        virtual void remove_decorations([[maybe_unused]] std::wstring& str) const {}
+        virtual void remove_decorations([[maybe_unused]] std::pmr::wstring& str) const {}
 
         /// @brief Reviews and classifies a string value based on the
         ///     variable it is being assigned to.
@@ -1270,9 +1625,9 @@ namespace i18n_check
             @returns The position of the function or variable related to the string.*/
         const wchar_t* read_var_or_function_name(const wchar_t* startPos,
                                                  const wchar_t* const startSentinel,
-                                                 std::wstring& functionName,
+                                                 std::pmr::wstring& functionName,
                                                  variable_info& variableInfo,
-                                                 std::wstring& deprecatedMacroEncountered,
+                                                 std::pmr::wstring& deprecatedMacroEncountered,
                                                  size_t& parameterPosition);
 
         /// @returns @c true if provided variable type is just a decorator after the real
@@ -1289,6 +1644,8 @@ namespace i18n_check
         /// @param position The character position in the file.
         /// @param fileStart The start of a file buffer to begin the search from.\n
         ///     If an empty view, will use the currently loaded file.
+        /// @note If the current file's lines have been indexed (into @c m_line_index),
+        ///     then that is used instead of @c fileStart.
         [[nodiscard]]
         std::pair<size_t, size_t>
         get_line_and_column(size_t position,
@@ -1296,10 +1653,171 @@ namespace i18n_check
 
         /// @brief Removes the quotes and whitespace between multiple quotes
         ///     strings that constitute a single string.
-        /// @param str The string to collapse.
-        /// @returns The collapsed string.
+        /// @param[in,out] str The string to collapse.
+        /// @param buffer A buffer to collapse the string into,
+        ///     which is reused for each string (e.g., from the scratch memory).
+        void collapse_multipart_string(std::wstring& str, std::pmr::wstring& buffer) const;
+
+        /** @brief Moves a set of results from other analyzers into this one,
+                and then sorts them by file.
+            @param results The member (of the analyzers) holding the results to merge.
+            @param analyzers The analyzers to move the results from.
+            @param fileIndex Function returning a file's position in the original list of files.
+            @param filePath Function returning the file that a result is from.*/
+        template<typename AnalyzerT, typename T, typename FilePathFunc>
+        void merge_results_by_file(std::vector<T> AnalyzerT::*results,
+                                   const std::vector<i18n_review*>& analyzers,
+                                   const file_index_callback& fileIndex, FilePathFunc filePath)
+            {
+            auto& mergedResults = static_cast<AnalyzerT*>(this)->*results;
+            // results already in here are left as-is, the new ones are sorted after them
+            const size_t previousResultCount{ mergedResults.size() };
+            for (auto* analyzer : analyzers)
+                {
+                auto& otherResults = static_cast<AnalyzerT*>(analyzer)->*results;
+                mergedResults.insert(mergedResults.end(),
+                                     std::make_move_iterator(otherResults.begin()),
+                                     std::make_move_iterator(otherResults.end()));
+                otherResults.clear();
+                }
+            // look up each result's file index only once, and sort by that and
+            // the result's current position (which keeps the sort stable)
+            std::vector<std::pair<size_t, size_t>> sortKeys;
+            sortKeys.reserve(mergedResults.size() - previousResultCount);
+            for (size_t i = previousResultCount; i < mergedResults.size(); ++i)
+                {
+                sortKeys.emplace_back(fileIndex(filePath(mergedResults[i])), i);
+                }
+            std::sort(sortKeys.begin(), sortKeys.end());
+            std::vector<T> sortedResults;
+            sortedResults.reserve(sortKeys.size());
+            for (const auto& sortKey : sortKeys)
+                {
+                sortedResults.push_back(std::move(mergedResults[sortKey.second]));
+                }
+            std::move(sortedResults.begin(), sortedResults.end(),
+                      std::next(mergedResults.begin(),
+                                static_cast<ptrdiff_t>(previousResultCount)));
+            }
+
+        /** @brief Writes a list of results to a cache stream.
+            @param stream The stream to write to.
+            @param strings The results to write.
+            @param filePath The file that the results are from.*/
+        static void write_string_infos(std::ostream& stream,
+                                       const std::vector<string_info>& strings,
+                                       const std::filesystem::path& filePath);
+
+        /// @private
+        static void write_string_infos(std::ostream& stream, const results_view& strings,
+                                       const std::filesystem::path& filePath);
+
+        /** @brief Reads a list of results written by write_string_infos().
+            @param stream The stream to read from.
+            @param[out] strings The list to add the results to.
+            @param filePath The file that the results are from.*/
+        static void read_string_infos(std::istream& stream, std::vector<string_info>& strings,
+                                      const std::filesystem::path& filePath);
+
+        /// @returns @c true if a result on a line is within the changed lines
+        ///     (or if all lines are being reviewed).
+        /// @param filePath The file that the result is from.
+        /// @param line The line of the result.
+        ///     A line of zero or @c npos (i.e., a result for the whole file) is only
+        ///     checked for its file being changed.
+        [[nodiscard]]
+        bool is_in_changed_lines(const std::filesystem::path& filePath, const size_t line) const;
+
+        /// @brief Looks up the changed lines for the current file
+        ///     (call this once the file's name is set).
+        void load_file_changed_lines();
+
+        /// @returns @c true if a position in the current file is on a changed line
+        ///     (or if all lines are being reviewed).
+        /// @param position The character position in the current file.
+        [[nodiscard]]
+        bool is_changed_line(const size_t position) const
+            {
+            return (m_changed_lines == nullptr) ||
+                   (m_file_changed_lines != nullptr &&
+                    is_line_in_ranges(*m_file_changed_lines,
+                                      get_line_and_column(position).first));
+            }
+
+        /** @brief Removes results that aren't on the changed lines from a list of results.
+            @param results The results to review.*/
+        void remove_strings_outside_changed_lines(std::vector<string_info>& results) const
+            {
+            std::erase_if(results, [this](const string_info& str)
+                          { return !is_in_changed_lines(str.m_file_name, str.m_line); });
+            }
+
+        /** @brief Adds a new result.
+            @param category The category of the result.
+            @param args The arguments to construct the result (a string_info) with.
+            @returns The result's index in the store (for add_result_to_category()).*/
+        template<typename... ArgsT>
+        size_t add_result(const result_category category, ArgsT&&... args)
+            {
+            return m_results.add(static_cast<size_t>(category), std::forward<ArgsT>(args)...);
+            }
+
+        /** @brief Adds a result that is already in the store to another category
+                (e.g., a localizable string that also contains a URL).
+            @param category The category to add the result to.
+            @param index The result's index in the store.*/
+        void add_result_to_category(const result_category category, const size_t index)
+            {
+            m_results.add_existing(static_cast<size_t>(category), index);
+            }
+
+        /// @returns The results in a category.
+        /// @param category The category.
+        [[nodiscard]]
+        results_view get_results(const result_category category) const noexcept
+            {
+            return m_results.get(static_cast<size_t>(category));
+            }
+
+        /// @returns The indices (into the store) of the results in a category.
+        /// @param category The category.
+        [[nodiscard]]
+        const std::vector<uint32_t>&
+        get_result_indices(const result_category category) const noexcept
+            {
+            return m_results.get_indices(static_cast<size_t>(category));
+            }
+
+        /// @brief Creates a copy of an analyzer, but without any of its results.
+        /// @param analyzer The analyzer to copy.
+        /// @returns The copy of the analyzer.
+        template<typename AnalyzerT>
+        [[nodiscard]]
+        static std::unique_ptr<i18n_review> clone_settings(const AnalyzerT& analyzer)
+            {
+            auto copy = std::make_unique<AnalyzerT>(analyzer);
+            copy->clear_results();
+            static_cast<i18n_review*>(copy.get())->m_error_log.clear();
+            return copy;
+            }
+
+        /// @returns The built-in rules.
+        [[nodiscard]]
+        static std::shared_ptr<const rule_set> build_default_rules();
+        /// @returns A copy of the built-in rules, with the extra checks used when verbose.
+        /// @param rules The built-in rules.
+        [[nodiscard]]
+        static std::shared_ptr<const rule_set> build_verbose_rules(const rule_set& rules);
+        /// @returns The deprecated functions by their names, for finding them in a file's tokens.
+        /// @param functions The deprecated functions.
+        [[nodiscard]]
+        static std::unordered_map<std::wstring_view, std::vector<deprecated_function_entry>>
+        build_deprecated_function_names(const std::map<std::wstring_view, std::wstring>& functions);
+        /// @returns The name of a deprecated function, without any punctuation around it
+        ///     (e.g., "wxConvCurrent" from "*wxConvCurrent").
+        /// @param func The deprecated function.
         [[nodiscard]]
-        std::wstring collapse_multipart_string(std::wstring str) const;
+        static std::wstring_view get_deprecated_function_name(std::wstring_view func);
 
         /// @brief Collapses non-raw strings that are multiline.
         void process_strings();
@@ -1307,6 +1825,19 @@ namespace i18n_check
         void run_diagnostics();
 
         const wchar_t* m_file_start{ nullptr };
+        /// @brief The line starts of the file currently being reviewed.
+        line_index m_line_index;
+        /// @brief Memory for the temporary containers used while reviewing a file.
+        scratch_arena m_scratch;
+        /// @brief The lines that the review is limited to (null if reviewing all lines).
+        std::shared_ptr<const changed_lines_map> m_changed_lines;
+        /// @brief Where the time spent in each check is added to (null if not profiling).
+        check_profile* m_profile{ nullptr };
+        /// @brief Where verdicts about strings' content are remembered (null if not caching).
+        std::shared_ptr<classification_cache> m_classification_cache;
+        /// @brief The changed lines of the file currently being reviewed
+        ///     (null if the file wasn't changed).
+        const line_ranges* m_file_changed_lines{ nullptr };
 
         bool m_collapse_double_quotes{ false };
         bool m_allow_translating_punctuation_only_strings{ false };
@@ -1327,52 +1858,12 @@ namespace i18n_check
 
         bool m_verbose{ false };
 
-        // once these are set (by our CTOR and/or by client), they shouldn't be reset
-        std::set<std::wstring_view> m_localization_functions;
-        std::set<std::wstring_view> m_localization_with_context_functions;
-        std::set<std::wstring_view> m_non_localizable_functions;
-        std::set<std::wstring_view> m_internal_functions;
-        std::set<std::wstring_view> m_log_functions;
-        std::set<std::wstring_view> m_exceptions;
-        std::set<std::wstring_view> m_ctors_to_ignore;
-        std::set<string_util::case_insensitive_wstring> m_known_internal_strings;
-        std::set<std::wstring_view> m_keywords;
-        std::map<std::wstring_view, std::wstring> m_deprecated_string_macros;
-        std::map<std::wstring_view, std::wstring> m_deprecated_string_functions;
-        // These have built-in values, but can be added to by the client also.
-        // These are static so that client's additions can propagate to other instances.
-        static std::vector<std::wregex> m_variable_name_patterns_to_ignore;
-        static std::set<std::wstring> m_variable_types_to_ignore;
-        static std::set<string_util::case_insensitive_wstring> m_font_names;
-        static std::set<string_util::case_insensitive_wstring> m_file_extensions;
-        static std::set<std::wstring> m_untranslatable_exceptions;
-        // results after parsing what the client should maybe review
-        std::vector<string_info> m_localizable_strings;
-        std::vector<string_info> m_marked_as_non_localizable_strings;
-        std::vector<string_info> m_internal_strings;
-        // results that are probably issues
-        std::vector<string_info> m_unsafe_localizable_strings;
-        std::vector<string_info> m_localizable_strings_with_unlocalizable_content;
-        std::vector<string_info> m_localizable_strings_with_urls;
-        std::vector<string_info> m_localizable_strings_ambiguous_needing_context;
-        std::vector<string_info> m_localizable_strings_in_internal_call;
-        std::vector<string_info> m_localizable_strings_being_concatenated;
-        std::vector<string_info> m_localizable_strings_with_halfwidths;
-        std::vector<string_info> m_not_available_for_localization_strings;
-        std::vector<string_info> m_multipart_strings;
-        std::vector<string_info> m_faux_plural_strings;
-        std::vector<string_info> m_article_issue_strings;
-        std::vector<string_info> m_deprecated_macros;
-        std::vector<string_info> m_unencoded_strings;
-        std::vector<string_info> m_printf_single_numbers;
-        std::vector<string_info> m_ids_assigned_number;
-        std::vector<string_info> m_duplicates_value_assigned_to_ids;
-        std::vector<string_info> m_malformed_strings;
-        std::vector<string_info> m_trailing_spaces;
-        std::vector<string_info> m_tabs;
-        std::vector<string_info> m_wide_lines;
-        std::vector<string_info> m_comments_missing_space;
-        std::vector<string_info> m_suspect_i18n_usage;
+        // the functions, keywords, and patterns used to classify strings
+        // (shared with other analyzers until this one is customized)
+        std::shared_ptr<const rule_set> m_rules;
+        // results after parsing (and reviewing), each stored once with the
+        // categories (issues) that it is in
+        results_store m_results;
 
         wx_project_info m_wx_info;
 
@@ -1380,30 +1871,29 @@ namespace i18n_check
 
         std::filesystem::path m_file_name;
 
-        static const std::wregex m_url_email_regex;
-        static const std::wregex m_us_phone_number_regex;
-        static const std::wregex m_non_us_phone_number_regex;
-        static const std::wregex m_html_regex;
-        static const std::wregex m_html_element_with_content_regex;
-        static const std::wregex m_html_tag_regex;
-        static const std::wregex m_html_tag_unicode_regex;
-        static const std::wregex m_xml_element_regex;
-        static const std::wregex m_not_xml_element_regex;
-        static const std::wregex m_html_known_elements_regex;
-        static const std::wregex m_angle_braced_one_word_regex;
-        static const std::wregex m_2letter_regex;
+        static const regex_pattern m_url_email_regex;
+        static const regex_pattern m_us_phone_number_regex;
+        static const regex_pattern m_non_us_phone_number_regex;
+        static const regex_pattern m_html_regex;
+        static const regex_pattern m_html_element_with_content_regex;
+        static const regex_pattern m_html_tag_regex;
+        static const regex_pattern m_html_tag_unicode_regex;
+        static const regex_pattern m_xml_element_regex;
+        static const regex_pattern m_not_xml_element_regex;
+        static const regex_pattern m_html_known_elements_regex;
+        static const regex_pattern m_angle_braced_one_word_regex;
+        static const regex_pattern m_2letter_regex;
         static const std::wregex m_1word_regex;
         static const std::wregex m_keyboard_accelerator_regex;
-        static const std::wregex m_hashtag_regex;
-        static const std::wregex m_key_shortcut_regex;
-        static const std::wregex m_function_signature_regex;
-        static const std::wregex m_plural_regex;
-        static const std::wregex m_open_function_signature_regex;
-        static const std::wregex m_diagnostic_function_regex;
+        static const regex_pattern m_hashtag_regex;
+        static const regex_pattern m_key_shortcut_regex;
+        static const regex_pattern m_function_signature_regex;
+        static const regex_pattern m_plural_regex;
+        static const regex_pattern m_open_function_signature_regex;
         static const std::wregex m_id_assignment_regex;
-        static const std::wregex m_sql_code;
-        static const std::wregex m_malformed_html_tag;
-        static const std::wregex m_malformed_html_tag_bad_amp;
+        static const regex_pattern m_sql_code;
+        static const regex_pattern m_malformed_html_tag;
+        static const regex_pattern m_malformed_html_tag_bad_amp;
         static const std::wregex m_printf_cpp_int_regex;
         static const std::wregex m_printf_cpp_float_regex;
         static const std::wregex m_printf_cpp_string_regex;
@@ -1411,8 +1901,6 @@ namespace i18n_check
         static const std::wregex m_positional_command_regex;
         static const std::wregex m_file_filter_regex;
         static const std::wregex m_halfwidth_range_regex;
-        std::vector<std::wregex> m_untranslatable_regexes;
-        std::vector<std::wregex> m_translatable_regexes;
 
       private:
         [[nodiscard]]
@@ -1443,7 +1931,7 @@ namespace i18n_check
 
         // bookkeeping diagnostics
 #ifndef NDEBUG
-        mutable std::pair<std::wstring, std::wregex> m_longest_internal_string;
+        mutable std::pair<std::wstring, std::wstring> m_longest_internal_string;
 #endif
         };
     } // namespace i18n_check
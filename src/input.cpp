@@ -13,10 +13,88 @@
 
 #include "input.h"
 #include "i18n_review.h"
+#include "text_decode.h"
+#include <algorithm>
+#include <atomic>
+#include <cwctype>
 #include <iostream>
+#include <thread>
 
 namespace i18n_check
     {
+    //------------------------------------------------------
+    path_exclusions::path_exclusions(const std::vector<std::filesystem::path>& excludedPaths,
+                                     const std::vector<std::filesystem::path>& excludedFiles)
+        {
+        const auto addPath =
+            [](std::unordered_set<std::filesystem::path::string_type>& paths,
+               const std::filesystem::path& excPath)
+        {
+            paths.insert(make_key(excPath));
+            // also add where a symbolic link points to, so that it matches either way
+            std::error_code ec;
+            const auto canonicalPath = std::filesystem::weakly_canonical(excPath, ec);
+            if (!ec)
+                {
+                paths.insert(make_key(canonicalPath));
+                }
+        };
+
+        for (const auto& ePath : excludedPaths)
+            {
+            addPath(m_folders, ePath);
+            }
+        for (const auto& eFile : excludedFiles)
+            {
+            addPath(m_files, eFile);
+            }
+        }
+
+    //------------------------------------------------------
+    bool path_exclusions::is_in_excluded_folder(const std::filesystem::path& filePath) const
+        {
+        if (m_folders.empty())
+            {
+            return false;
+            }
+        const std::filesystem::path key{ make_key(filePath) };
+        for (auto folder = key.parent_path(); !folder.empty(); folder = folder.parent_path())
+            {
+            if (m_folders.contains(folder.native()))
+                {
+                return true;
+                }
+            // at the root
+            if (folder == folder.parent_path())
+                {
+                break;
+                }
+            }
+        return false;
+        }
+
+    //------------------------------------------------------
+    std::filesystem::path::string_type
+    path_exclusions::make_key(const std::filesystem::path& filePath)
+        {
+        auto key{ (filePath.is_absolute() ? filePath : std::filesystem::absolute(filePath))
+                      .lexically_normal() };
+        // remove trailing separator (unless it is the root)
+        if (!key.has_filename() && key.has_relative_path())
+            {
+            key = key.parent_path();
+            }
+#ifdef _WIN32
+        // paths are case insensitive on Windows
+        std::wstring keyText{ key.native() };
+        std::transform(keyText.begin(), keyText.end(), keyText.begin(),
+                       [](const wchar_t chr) { return std::towlower(chr); });
+        return keyText;
+#else
+        return key.native();
+#endif
+        }
+
     //------------------------------------------------------
     excluded_results get_paths_files_to_exclude(const std::filesystem::path& inputFolder,
                                                 const std::vector<std::filesystem::path>& excluded)
@@ -40,6 +118,8 @@ namespace i18n_check
                 }
         };
 
+        // subfolders are not added, as excluded folders are skipped entirely
+        // while the input folder is read
         for (const auto& excItem : excluded)
             {
             try
@@ -53,16 +133,6 @@ namespace i18n_check
                     if (std::filesystem::is_directory(excItem))
                         {
                         excResults.m_excludedPaths.push_back(excItem);
-                        const auto folderToRecurse{ excResults.m_excludedPaths.back() };
-                        // add subdirectories
-                        for (const auto& p :
-                             std::filesystem::recursive_directory_iterator(folderToRecurse))
-                            {
-                            if (std::filesystem::exists(p) && p.is_directory())
-                                {
-                                excResults.m_excludedPaths.push_back(p.path());
-                                }
-                            }
                         }
                     else
                         {
@@ -76,16 +146,6 @@ namespace i18n_check
                     if (std::filesystem::is_directory(relPath))
                         {
                         excResults.m_excludedPaths.push_back(relPath);
-                        const auto folderToRecurse{ excResults.m_excludedPaths.back() };
-                        // add subdirectories
-                        for (const auto& p :
-                             std::filesystem::recursive_directory_iterator(folderToRecurse))
-                            {
-                            if (std::filesystem::exists(p) && p.is_directory())
-                                {
-                                excResults.m_excludedPaths.push_back(p.path());
-                                }
-                            }
                         }
                     else
                         {
@@ -106,6 +166,86 @@ namespace i18n_check
         return excResults;
         }
 
+    //------------------------------------------------------
+    static bool is_file_to_analyze(const std::filesystem::directory_entry& p,
+                                   const path_exclusions& exclusions)
+        {
+        const auto ext = p.path().extension();
+        return (p.exists() && p.is_regular_file() &&
+                (ext.compare(std::filesystem::path(L".rc")) == 0 ||
+                 ext.compare(std::filesystem::path(L".plist")) == 0 ||
+                 ext.compare(std::filesystem::path(L".c")) == 0 ||
+                 ext.compare(std::filesystem::path(L".cs")) == 0 ||
+                 ext.compare(std::filesystem::path(L".cpp")) == 0 ||
+                 ext.compare(std::filesystem::path(L".h")) == 0 ||
+                 ext.compare(std::filesystem::path(L".hpp")) == 0 ||
+                 ext.compare(std::filesystem::path(L".po")) == 0 ||
+                 ext.compare(std::filesystem::path(L".pot")) == 0) &&
+                // ignore CMake build files
+                p.path().filename().compare(L"CMakeCXXCompilerId.cpp") != 0 &&
+                p.path().filename().compare(L"CMakeCCompilerId.c") != 0 &&
+                // main catch2 files
+                p.path().filename().compare(L"catch.hpp") != 0 &&
+                p.path().filename().compare(L"catch_amalgamated.cpp") != 0 &&
+                p.path().filename().compare(L"catch_amalgamated.hpp") != 0 &&
+                // ignore pseudo-translated message catalogs what we previously generated
+                !p.path().filename().wstring().starts_with(L"pseudo_") &&
+                !exclusions.is_excluded_file(p.path()));
+        }
+
+    //------------------------------------------------------
+    bool is_file_to_analyze(const std::filesystem::path& filePath,
+                            const std::vector<std::filesystem::path>& excludedPaths,
+                            const std::vector<std::filesystem::path>& excludedFiles)
+        {
+        const path_exclusions exclusions{ excludedPaths, excludedFiles };
+        return is_file_to_analyze(std::filesystem::directory_entry{ filePath }, exclusions) &&
+               !exclusions.is_in_excluded_folder(filePath);
+        }
+
+    //------------------------------------------------------
+    /** @brief Adds the files to analyze from a folder (and its subfolders),
+            skipping excluded folders without reading them.
+        @param folder The folder to read.
+        @param exclusions The excluded folders and files.
+        @param[out] filesToAnalyze The files to analyze.
+        @param[out] errors Any errors from reading the folder.*/
+    static void add_files_to_analyze(const std::filesystem::path& folder,
+                                     const path_exclusions& exclusions,
+                                     std::vector<std::filesystem::path>& filesToAnalyze,
+                                     std::vector<std::wstring>& errors)
+        {
+        try
+            {
+            for (auto p = std::filesystem::recursive_directory_iterator(folder);
+                 p != std::filesystem::recursive_directory_iterator{}; ++p)
+                {
+                try
+                    {
+                    if (p->is_directory())
+                        {
+                        if (exclusions.is_excluded_folder(p->path()))
+                            {
+                            p.disable_recursion_pending();
+                            }
+                        }
+                    else if (is_file_to_analyze(*p, exclusions))
+                        {
+                        filesToAnalyze.push_back(p->path());
+                        }
+                    }
+                catch (const std::exception& expt)
+                    {
+                    errors.push_back(i18n_string_util::lazy_string_to_wstring(expt.what()));
+                    }
+                }
+            }
+        catch (const std::exception& expt)
+            {
+            errors.push_back(i18n_string_util::lazy_string_to_wstring(expt.what()));
+            }
+        }
+
     //------------------------------------------------------
     std::vector<std::filesystem::path>
     get_files_to_analyze(const std::filesystem::path& inputFolder,
@@ -120,68 +260,316 @@ namespace i18n_check
             }
         else if (std::filesystem::is_directory(inputFolder) && std::filesystem::exists(inputFolder))
             {
-            for (const auto& p : std::filesystem::recursive_directory_iterator(inputFolder))
+            const path_exclusions exclusions{ excludedPaths, excludedFiles };
+            if (exclusions.is_excluded_folder(inputFolder))
                 {
-                const auto ext = p.path().extension();
-                bool inExcludedPath{ false };
-                try
+                return filesToAnalyze;
+                }
+
+            // read the top-level items, and then read each subfolder in parallel
+            std::vector<std::filesystem::directory_entry> topLevelItems;
+            std::vector<std::wstring> errors;
+            try
+                {
+                for (const auto& p : std::filesystem::directory_iterator(inputFolder))
                     {
-                    for (const auto& ePath : excludedPaths)
-                        {
-                        std::filesystem::path excPath(ePath,
-                                                      std::filesystem::path::format::native_format);
-                        if (p.exists() && std::filesystem::exists(excPath) &&
-                            std::filesystem::equivalent(p.path().parent_path(), excPath))
-                            {
-                            inExcludedPath = true;
-                            break;
-                            }
-                        }
-                    // compare against excluded files if not already in an excluded folder
-                    if (!inExcludedPath)
+                    topLevelItems.push_back(p);
+                    }
+                }
+            catch (const std::exception& expt)
+                {
+                errors.push_back(i18n_string_util::lazy_string_to_wstring(expt.what()));
+                }
+
+            // the files (and errors) from each item are kept separately and then combined,
+            // so that they are in the same order as reading through the folder sequentially
+            struct folder_files
+                {
+                std::vector<std::filesystem::path> m_files;
+                std::vector<std::wstring> m_errors;
+                };
+            std::vector<folder_files> itemFiles(topLevelItems.size());
+            std::atomic<size_t> nextItem{ 0 };
+            const auto readItems = [&]()
+            {
+                for (size_t i = nextItem++; i < topLevelItems.size(); i = nextItem++)
+                    {
+                    try
                         {
-                        for (const auto& eFile : excludedFiles)
+                        if (!topLevelItems[i].is_directory())
                             {
-                            std::filesystem::path excFile(
-                                eFile, std::filesystem::path::format::native_format);
-                            if (p.exists() && std::filesystem::exists(excFile) &&
-                                std::filesystem::equivalent(p, excFile))
+                            if (is_file_to_analyze(topLevelItems[i], exclusions))
                                 {
-                                inExcludedPath = true;
-                                break;
+                                itemFiles[i].m_files.push_back(topLevelItems[i].path());
                                 }
                             }
+                        else if (!exclusions.is_excluded_folder(topLevelItems[i].path()) &&
+                                 !topLevelItems[i].is_symlink())
+                            {
+                            add_files_to_analyze(topLevelItems[i].path(), exclusions,
+                                                 itemFiles[i].m_files, itemFiles[i].m_errors);
+                            }
                         }
-                    if (p.exists() && p.is_regular_file() && !inExcludedPath &&
-                        (ext.compare(std::filesystem::path(L".rc")) == 0 ||
-                         ext.compare(std::filesystem::path(L".plist")) == 0 ||
-                         ext.compare(std::filesystem::path(L".c")) == 0 ||
-                         ext.compare(std::filesystem::path(L".cs")) == 0 ||
-                         ext.compare(std::filesystem::path(L".cpp")) == 0 ||
-                         ext.compare(std::filesystem::path(L".h")) == 0 ||
-                         ext.compare(std::filesystem::path(L".hpp")) == 0 ||
-                         ext.compare(std::filesystem::path(L".po")) == 0 ||
-                         ext.compare(std::filesystem::path(L".pot")) == 0) &&
-                        // ignore CMake build files
-                        p.path().filename().compare(L"CMakeCXXCompilerId.cpp") != 0 &&
-                        p.path().filename().compare(L"CMakeCCompilerId.c") != 0 &&
-                        // main catch2 files
-                        p.path().filename().compare(L"catch.hpp") != 0 &&
-                        p.path().filename().compare(L"catch_amalgamated.cpp") != 0 &&
-                        p.path().filename().compare(L"catch_amalgamated.hpp") != 0 &&
-                        // ignore pseudo-translated message catalogs what we previously generated
-                        !p.path().filename().wstring().starts_with(L"pseudo_"))
+                    catch (const std::exception& expt)
                         {
-                        filesToAnalyze.push_back(p.path());
+                        itemFiles[i].m_errors.push_back(
+                            i18n_string_util::lazy_string_to_wstring(expt.what()));
                         }
                     }
-                catch (const std::exception& expt)
+            };
+
+                {
+                const size_t jobCount{ std::min<size_t>(
+                    topLevelItems.size(),
+                    std::max<size_t>(std::thread::hardware_concurrency(), 1)) };
+                std::vector<std::jthread> threads;
+                threads.reserve(jobCount);
+                for (size_t i = 1; i < jobCount; ++i)
                     {
-                    std::wcout << i18n_string_util::lazy_string_to_wstring(expt.what()) << L"\n";
+                    threads.emplace_back(readItems);
                     }
+                // the calling thread reads items also
+                readItems();
+                } // threads are joined here
+
+            for (auto& item : itemFiles)
+                {
+                filesToAnalyze.insert(filesToAnalyze.end(),
+                                      std::make_move_iterator(item.m_files.begin()),
+                                      std::make_move_iterator(item.m_files.end()));
+                errors.insert(errors.end(), std::make_move_iterator(item.m_errors.begin()),
+                              std::make_move_iterator(item.m_errors.end()));
+                }
+            for (const auto& error : errors)
+                {
+                std::wcout << error << L"\n";
+                }
+            }
+
+        return filesToAnalyze;
+        }
+
+    //------------------------------------------------------
+    std::vector<std::filesystem::path>
+    get_files_to_analyze(const changed_lines_map& changedLines,
+                         const std::vector<std::filesystem::path>& excludedPaths,
+                         const std::vector<std::filesystem::path>& excludedFiles)
+        {
+        std::vector<std::filesystem::path> filesToAnalyze;
+        const path_exclusions exclusions{ excludedPaths, excludedFiles };
+        for (const auto& [filePath, ranges] : changedLines)
+            {
+            try
+                {
+                if (is_file_to_analyze(std::filesystem::directory_entry{ filePath },
+                                       exclusions) &&
+                    !exclusions.is_in_excluded_folder(filePath))
+                    {
+                    filesToAnalyze.push_back(filePath);
+                    }
+                }
+            catch (const std::exception& expt)
+                {
+                std::wcout << i18n_string_util::lazy_string_to_wstring(expt.what()) << L"\n";
                 }
             }
 
         return filesToAnalyze;
         }
+
+    //------------------------------------------------------
+    /// @returns A path from a diff's file header, with any quotes that git put around it
+    ///     removed and its C-style escapes (e.g., octal bytes from non-ASCII characters)
+    ///     decoded.
+    static std::string read_diff_path(std::string_view path)
+        {
+        if (path.length() < 2 || path.front() != '"' || path.back() != '"')
+            {
+            return std::string{ path };
+            }
+        path = path.substr(1, path.length() - 2);
+
+        std::string unquotedPath;
+        unquotedPath.reserve(path.length());
+        while (!path.empty())
+            {
+            if (path.front() != '\\' || path.length() < 2)
+                {
+                unquotedPath += path.front();
+                path.remove_prefix(1);
+                continue;
+                }
+            path.remove_prefix(1);
+            // a byte as up to three octal digits (e.g., "\303\251" for é)
+            if (path.front() >= '0' && path.front() <= '7')
+                {
+                unsigned int value{ 0 };
+                for (size_t i = 0; i < 3 && !path.empty() && path.front() >= '0' &&
+                                   path.front() <= '7';
+                     ++i)
+                    {
+                    value = (value * 8) + static_cast<unsigned int>(path.front() - '0');
+                    path.remove_prefix(1);
+                    }
+                unquotedPath += static_cast<char>(value & 0xFF);
+                continue;
+                }
+            // other escapes are a single character (e.g., "\t"), or a quote or backslash
+            constexpr std::string_view escapes{ "abfnrtv" };
+            constexpr std::string_view escapedChars{ "\a\b\f\n\r\t\v" };
+            const size_t escape{ escapes.find(path.front()) };
+            unquotedPath += (escape != std::string_view::npos) ? escapedChars[escape] :
+                                                                   path.front();
+            path.remove_prefix(1);
+            }
+        return unquotedPath;
+        }
+
+    //------------------------------------------------------
+    changed_lines_map read_unified_diff(std::string_view diffText,
+                                        const std::filesystem::path& inputFolder)
+        {
+        changed_lines_map changedLines;
+
+        const auto readNumber = [](std::string_view& text)
+        {
+            size_t value{ 0 };
+            while (!text.empty() && text.front() >= '0' && text.front() <= '9')
+                {
+                value = (value * 10) + static_cast<size_t>(text.front() - '0');
+                text.remove_prefix(1);
+                }
+            return value;
+        };
+
+        line_ranges* currentRanges{ nullptr };
+        // whether the current file's paths have git's "a/" and "b/" prefixes
+        bool hasPathPrefixes{ false };
+        size_t currentLine{ 0 };
+        // lines left in the current hunk, from the original and new versions of the file
+        size_t oldLinesLeft{ 0 };
+        size_t newLinesLeft{ 0 };
+        while (!diffText.empty())
+            {
+            const size_t lineEnd{ diffText.find('\n') };
+            std::string_view line{ diffText.substr(0, lineEnd) };
+            diffText.remove_prefix((lineEnd == std::string_view::npos) ? diffText.length() :
+                                                                          lineEnd + 1);
+            if (line.ends_with('\r'))
+                {
+                line.remove_suffix(1);
+                }
+
+            // inside of a hunk
+            if (oldLinesLeft > 0 || newLinesLeft > 0)
+                {
+                if (line.starts_with('+'))
+                    {
+                    if (currentRanges != nullptr)
+                        {
+                        // extend the last range if this line follows it
+                        if (!currentRanges->empty() &&
+                            currentRanges->back().second + 1 == currentLine)
+                            {
+                            currentRanges->back().second = currentLine;
+                            }
+                        else
+                            {
+                            currentRanges->emplace_back(currentLine, currentLine);
+                            }
+                        }
+                    ++currentLine;
+                    newLinesLeft -= (newLinesLeft > 0) ? 1 : 0;
+                    }
+                else if (line.starts_with('-'))
+                    {
+                    oldLinesLeft -= (oldLinesLeft > 0) ? 1 : 0;
+                    }
+                // "\ No newline at end of file" isn't part of the counts
+                else if (!line.starts_with('\\'))
+                    {
+                    ++currentLine;
+                    oldLinesLeft -= (oldLinesLeft > 0) ? 1 : 0;
+                    newLinesLeft -= (newLinesLeft > 0) ? 1 : 0;
+                    }
+                }
+            // the start of a file's changes from git (e.g., "diff --git a/app.cpp b/app.cpp"),
+            // which won't have the "a/" and "b/" prefixes if "--no-prefix" was used
+            else if (line.starts_with("diff --git "))
+                {
+                line.remove_prefix(11);
+                hasPathPrefixes = line.starts_with("a/") || line.starts_with("\"a/");
+                }
+            // the original version of a file (which is "/dev/null" for new files,
+            // so the prefixes are only known from git's header line then)
+            else if (line.starts_with("--- "))
+                {
+                line.remove_prefix(4);
+                line = line.substr(0, line.find('\t'));
+                if (line != "/dev/null")
+                    {
+                    hasPathPrefixes = read_diff_path(line).starts_with("a/");
+                    }
+                }
+            // the new version of a file, which following hunks are for
+            else if (line.starts_with("+++ "))
+                {
+                line.remove_prefix(4);
+                // diff may add a timestamp after the file name
+                line = line.substr(0, line.find('\t'));
+                if (line == "/dev/null")
+                    {
+                    currentRanges = nullptr;
+                    continue;
+                    }
+                std::string diffPath{ read_diff_path(line) };
+                if (hasPathPrefixes && diffPath.starts_with("b/"))
+                    {
+                    diffPath.erase(0, 2);
+                    }
+                // paths are built from UTF-8 (rather than wide strings) so that
+                // they don't depend on the system's locale
+                std::wstring decodedPath;
+                const std::filesystem::path filePath{
+                    decode_utf8(diffPath, decodedPath) ?
+                        std::filesystem::path{ std::u8string{ diffPath.cbegin(),
+                                                              diffPath.cend() } } :
+                        std::filesystem::path{ diffPath }
+                };
+                const std::filesystem::path fullPath{ (inputFolder / filePath).lexically_normal() };
+                currentRanges = &changedLines[fullPath];
+                }
+            // a hunk header (e.g., "@@ -10,7 +10,8 @@")
+            else if (line.starts_with("@@ -"))
+                {
+                line.remove_prefix(4);
+                readNumber(line);
+                oldLinesLeft = 1;
+                if (line.starts_with(','))
+                    {
+                    line.remove_prefix(1);
+                    oldLinesLeft = readNumber(line);
+                    }
+                if (!line.starts_with(" +"))
+                    {
+                    oldLinesLeft = 0;
+                    continue;
+                    }
+                line.remove_prefix(2);
+                currentLine = readNumber(line);
+                newLinesLeft = 1;
+                if (line.starts_with(','))
+                    {
+                    line.remove_prefix(1);
+                    newLinesLeft = readNumber(line);
+                    }
+                }
+            }
+
+        // remove files that only had lines deleted from them
+        std::erase_if(changedLines,
+                      [](const auto& changedFile) { return changedFile.second.empty(); });
+
+        return changedLines;
+        }
     } // namespace i18n_check
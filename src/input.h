@@ -18,8 +18,11 @@
 #ifndef __I18N_INPUTS_H__
 #define __I18N_INPUTS_H__
 
+#include "i18n_review.h"
 #include <filesystem>
 #include <string>
+#include <string_view>
+#include <unordered_set>
 #include <vector>
 
 namespace i18n_check
@@ -30,17 +33,66 @@ namespace i18n_check
         std::vector<std::filesystem::path> m_excludedFiles;
         };
 
+    /** @brief Checks whether folders and files were requested to be ignored.
+        @details The excluded paths are hashed (by their absolute, normalized paths),
+            so that each check is a lookup rather than comparing against every
+            excluded path on the file system.*/
+    class path_exclusions
+        {
+      public:
+        /// @brief Constructor.
+        /// @param excludedPaths Folders that should be ignored (along with their subfolders).
+        /// @param excludedFiles Files that should be ignored.
+        path_exclusions(const std::vector<std::filesystem::path>& excludedPaths,
+                        const std::vector<std::filesystem::path>& excludedFiles);
+
+        /// @returns @c true if a folder was requested to be ignored.
+        /// @param folder The folder to review.
+        /// @note This does not check the folder's parents.
+        [[nodiscard]]
+        bool is_excluded_folder(const std::filesystem::path& folder) const
+            {
+            return !m_folders.empty() && m_folders.contains(make_key(folder));
+            }
+
+        /// @returns @c true if a file was requested to be ignored.
+        /// @param filePath The file to review.
+        /// @note This does not check the file's folders.
+        [[nodiscard]]
+        bool is_excluded_file(const std::filesystem::path& filePath) const
+            {
+            return !m_files.empty() && m_files.contains(make_key(filePath));
+            }
+
+        /// @returns @c true if a file (or folder) is inside of an excluded folder.
+        /// @param filePath The file to review.
+        [[nodiscard]]
+        bool is_in_excluded_folder(const std::filesystem::path& filePath) const;
+
+      private:
+        /// @returns The absolute, normalized path used for lookups.
+        [[nodiscard]]
+        static std::filesystem::path::string_type make_key(const std::filesystem::path& filePath);
+
+        std::unordered_set<std::filesystem::path::string_type> m_folders;
+        std::unordered_set<std::filesystem::path::string_type> m_files;
+        };
+
     /** @brief Returns a list of excluded folders and files from a list of patterns.
         @param inputFolder The root folder being analyzed.
         @param excluded The list of excluded files and folder.
             This can be full paths, relative paths, folder names, filenames, etc.
-        @returns The fully-expanded paths for folders and files to exclude.*/
+        @returns The fully-expanded paths for folders and files to exclude.\n
+            Subfolders of excluded folders are not included, as they are skipped
+            (along with everything else in the excluded folders) by get_files_to_analyze().*/
     [[nodiscard]]
     excluded_results get_paths_files_to_exclude(const std::filesystem::path& inputFolder,
                                                 const std::vector<std::filesystem::path>& excluded);
 
     /** @brief Retrieves a list of files to analyze from a root folder, excluding any files and
        paths that were requested to be ignored.
+        @details Excluded folders are not read at all, and the root folder's subfolders are
+            read in parallel.
         @param inputFolder The root folder to scan.
         @param excludedPaths Folders that should be ignored.
             These should be full paths, not folder names.
@@ -52,6 +104,48 @@ namespace i18n_check
     get_files_to_analyze(const std::filesystem::path& inputFolder,
                          const std::vector<std::filesystem::path>& excludedPaths,
                          const std::vector<std::filesystem::path>& excludedFiles);
+
+    /** @brief Determines whether a file should be analyzed, based on its type and
+            whether it was requested to be ignored.
+        @param filePath The file to review.
+        @param excludedPaths Folders that should be ignored.
+            These should be full paths, not folder names.
+        @param excludedFiles Files that should be ignored. These should be full paths, not
+       filenames.
+        @returns @c true if the file exists and can be analyzed.*/
+    [[nodiscard]]
+    bool is_file_to_analyze(const std::filesystem::path& filePath,
+                            const std::vector<std::filesystem::path>& excludedPaths,
+                            const std::vector<std::filesystem::path>& excludedFiles);
+
+    /** @brief Reads which lines were added or changed in each file from a unified diff
+            (e.g., the output from `git diff`).
+        @details Paths in the diff are read from its `+++` lines (unquoting and unescaping
+            them if git quoted them). A leading `b/` is removed if the file's `diff --git`
+            or `---` line shows that git's `a/` and `b/` prefixes are being used.\n
+            Files that were deleted, or only had lines removed from them, are not included.
+        @param diffText The diff's content (in UTF-8).
+        @param inputFolder The folder that the paths in the diff are relative to.
+        @returns The lines that were added or changed in each file.*/
+    [[nodiscard]]
+    changed_lines_map read_unified_diff(std::string_view diffText,
+                                        const std::filesystem::path& inputFolder);
+
+    /** @brief Retrieves the list of files to analyze from the files changed in a patch,
+            excluding any files and paths that were requested to be ignored.
+        @details This applies the same filtering as get_files_to_analyze(), but without
+            reading through the entire input folder.
+        @param changedLines The lines changed in each file (from read_unified_diff()).
+        @param excludedPaths Folders that should be ignored.
+            These should be full paths, not folder names.
+        @param excludedFiles Files that should be ignored. These should be full paths, not
+       filenames.
+        @returns A list of files that can be analyzed.*/
+    [[nodiscard]]
+    std::vector<std::filesystem::path>
+    get_files_to_analyze(const changed_lines_map& changedLines,
+                         const std::vector<std::filesystem::path>& excludedPaths,
+                         const std::vector<std::filesystem::path>& excludedFiles);
     } // namespace i18n_check
 
 /** @}*/
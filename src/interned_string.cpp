@@ -0,0 +1,134 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "interned_string.h"
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+
+namespace i18n_check
+    {
+    /// @brief The strings that have been interned.
+    /// @details The set's nodes are never moved, so handles to them stay valid
+    ///     as more strings are added.
+    template<typename StringT, typename HashT>
+    class intern_table
+        {
+      public:
+        /// @returns The interned copy of a string (which is added to the table if needed).
+        /// @param str The string.
+        template<typename KeyT>
+        const StringT* intern(const KeyT& str)
+            {
+                {
+                const std::shared_lock<std::shared_mutex> lock(m_mutex);
+                if (const auto foundPos = m_strings.find(str); foundPos != m_strings.cend())
+                    {
+                    return &(*foundPos);
+                    }
+                }
+            const std::unique_lock<std::shared_mutex> lock(m_mutex);
+            return &(*m_strings.emplace(str).first);
+            }
+
+        /// @returns The number of strings in the table.
+        size_t size() const
+            {
+            const std::shared_lock<std::shared_mutex> lock(m_mutex);
+            return m_strings.size();
+            }
+
+      private:
+        mutable std::shared_mutex m_mutex;
+        std::unordered_set<StringT, HashT, std::equal_to<>> m_strings;
+        };
+
+    /// @brief Hashes strings and string views the same way, so that the table can be
+    ///     searched without copying the string being looked up.
+    struct interned_string_hash
+        {
+        using is_transparent = void;
+
+        [[nodiscard]]
+        size_t operator()(const std::wstring_view str) const noexcept
+            {
+            return std::hash<std::wstring_view>{}(str);
+            }
+        };
+
+    /// @brief Hashes paths for the path table.
+    struct interned_path_hash
+        {
+        [[nodiscard]]
+        size_t operator()(const std::filesystem::path& path) const noexcept
+            {
+            return std::filesystem::hash_value(path);
+            }
+        };
+
+    //--------------------------------------------------
+    static intern_table<std::wstring, interned_string_hash>& get_string_table()
+        {
+        static intern_table<std::wstring, interned_string_hash> table;
+        return table;
+        }
+
+    //--------------------------------------------------
+    static intern_table<std::filesystem::path, interned_path_hash>& get_path_table()
+        {
+        static intern_table<std::filesystem::path, interned_path_hash> table;
+        return table;
+        }
+
+    //--------------------------------------------------
+    static const std::wstring& get_empty_string()
+        {
+        static const std::wstring emptyString;
+        return emptyString;
+        }
+
+    //--------------------------------------------------
+    static const std::filesystem::path& get_empty_path()
+        {
+        static const std::filesystem::path emptyPath;
+        return emptyPath;
+        }
+
+    //--------------------------------------------------
+    interned_string::interned_string() noexcept : m_string(&get_empty_string()) {}
+
+    //--------------------------------------------------
+    interned_string::interned_string(std::wstring_view str)
+        : m_string(str.empty() ? &get_empty_string() : get_string_table().intern(str))
+        {
+        }
+
+    //--------------------------------------------------
+    size_t interned_string::get_table_size() { return get_string_table().size(); }
+
+    //--------------------------------------------------
+    interned_path::interned_path() noexcept : m_path(&get_empty_path()) {}
+
+    //--------------------------------------------------
+    interned_path::interned_path(const std::filesystem::path& path)
+        : m_path(path.empty() ? &get_empty_path() : get_path_table().intern(path))
+        {
+        }
+
+    //--------------------------------------------------
+    void interned_path::clear() noexcept { m_path = &get_empty_path(); }
+
+    //--------------------------------------------------
+    size_t interned_path::get_table_size() { return get_path_table().size(); }
+    } // namespace i18n_check
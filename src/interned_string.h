@@ -0,0 +1,262 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __INTERNED_STRING_H__
+#define __INTERNED_STRING_H__
+
+#include <compare>
+#include <cstddef>
+#include <filesystem>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace i18n_check
+    {
+    /** @brief A handle to a string in a project-wide table of unique strings.
+        @details Results repeat the same function and variable names many times
+            (e.g., "_" or "MessageBox"), so storing them as handles (the size of a pointer)
+            means that each name is only stored once, no matter how many results use it
+            or how many times the results are copied.\n
+            The handle converts to a @c const @c std::wstring& and @c std::wstring_view, and
+            has the @c std::wstring members that are commonly used for reading, so it can
+            be used like the string that it refers to.
+        @note Interning is thread safe. Strings are never removed from the table, so this
+            should only be used for text that is repeated a lot.*/
+    class interned_string
+        {
+      public:
+        /// @brief Constructor, which refers to an empty string.
+        interned_string() noexcept;
+
+        /// @brief Constructor, which interns a string.
+        /// @param str The string.
+        interned_string(std::wstring_view str);
+
+        /// @brief Constructor, which interns a string.
+        /// @param str The string.
+        interned_string(const std::wstring& str) : interned_string(std::wstring_view{ str }) {}
+
+        /// @brief Constructor, which interns a string.
+        /// @param str The string.
+        interned_string(const wchar_t* str) : interned_string(std::wstring_view{ str }) {}
+
+        /// @returns The string.
+        [[nodiscard]]
+        const std::wstring& get() const noexcept
+            {
+            return *m_string;
+            }
+
+        /// @returns The string.
+        [[nodiscard]]
+        operator const std::wstring&() const noexcept
+            {
+            return *m_string;
+            }
+
+        /// @returns The string.
+        [[nodiscard]]
+        operator std::wstring_view() const noexcept
+            {
+            return *m_string;
+            }
+
+        /// @returns @c true if the string is empty.
+        [[nodiscard]]
+        bool empty() const noexcept
+            {
+            return m_string->empty();
+            }
+
+        /// @returns The length of the string.
+        [[nodiscard]]
+        size_t length() const noexcept
+            {
+            return m_string->length();
+            }
+
+        /// @returns The string as a null-terminated C string.
+        [[nodiscard]]
+        const wchar_t* c_str() const noexcept
+            {
+            return m_string->c_str();
+            }
+
+        /// @private
+        [[nodiscard]]
+        friend bool operator==(const interned_string& lhs, const interned_string& rhs) noexcept
+            {
+            // strings are unique in the table, so the handles can be compared directly
+            return lhs.m_string == rhs.m_string;
+            }
+
+        /// @private
+        [[nodiscard]]
+        friend bool operator==(const interned_string& lhs, const std::wstring& rhs) noexcept
+            {
+            return lhs.get() == rhs;
+            }
+
+        /// @private
+        [[nodiscard]]
+        friend bool operator==(const interned_string& lhs, const std::wstring_view rhs) noexcept
+            {
+            return lhs.get() == rhs;
+            }
+
+        /// @private
+        [[nodiscard]]
+        friend bool operator==(const interned_string& lhs, const wchar_t* rhs) noexcept
+            {
+            return lhs.get() == rhs;
+            }
+
+        /// @private
+        [[nodiscard]]
+        friend std::strong_ordering operator<=>(const interned_string& lhs,
+                                                const interned_string& rhs) noexcept
+            {
+            return lhs.get() <=> rhs.get();
+            }
+
+        /// @private
+        friend std::wostream& operator<<(std::wostream& stream, const interned_string& str)
+            {
+            return stream << str.get();
+            }
+
+        /// @returns The number of unique strings that have been interned.
+        [[nodiscard]]
+        static size_t get_table_size();
+
+      private:
+        const std::wstring* m_string{ nullptr };
+        };
+
+    /** @brief A handle to a file path in a project-wide table of unique paths
+            (i.e., a file ID).
+        @details Every result records the file that it is from, so storing the path as a
+            handle means that each file's path is only stored once.\n
+            The handle converts to a @c const @c std::filesystem::path& and has the members
+            of @c std::filesystem::path that are commonly used for reading.
+        @note Interning is thread safe. Paths are never removed from the table.*/
+    class interned_path
+        {
+      public:
+        /// @brief Constructor, which refers to an empty path.
+        interned_path() noexcept;
+
+        /// @brief Constructor, which interns a path.
+        /// @param path The path.
+        interned_path(const std::filesystem::path& path);
+
+        /// @brief Constructor, which interns a path.
+        /// @param path The path.
+        interned_path(const std::wstring& path) : interned_path(std::filesystem::path{ path }) {}
+
+        /// @brief Constructor, which interns a path.
+        /// @param path The path.
+        interned_path(const wchar_t* path) : interned_path(std::filesystem::path{ path }) {}
+
+        /// @returns The path.
+        [[nodiscard]]
+        const std::filesystem::path& get() const noexcept
+            {
+            return *m_path;
+            }
+
+        /// @returns The path.
+        [[nodiscard]]
+        operator const std::filesystem::path&() const noexcept
+            {
+            return *m_path;
+            }
+
+        /// @returns @c true if the path is empty.
+        [[nodiscard]]
+        bool empty() const noexcept
+            {
+            return m_path->empty();
+            }
+
+        /// @returns The path as a wide string.
+        [[nodiscard]]
+        std::wstring wstring() const
+            {
+            return m_path->wstring();
+            }
+
+        /// @returns The path as a string in the native format.
+        [[nodiscard]]
+        const std::filesystem::path::string_type& native() const noexcept
+            {
+            return m_path->native();
+            }
+
+        /// @returns The file name part of the path.
+        [[nodiscard]]
+        std::filesystem::path filename() const
+            {
+            return m_path->filename();
+            }
+
+        /// @brief Sets the handle to an empty path.
+        void clear() noexcept;
+
+        /// @private
+        [[nodiscard]]
+        friend bool operator==(const interned_path& lhs, const interned_path& rhs) noexcept
+            {
+            // paths are unique in the table, so the handles can be compared directly
+            return lhs.m_path == rhs.m_path;
+            }
+
+        /// @private
+        [[nodiscard]]
+        friend bool operator==(const interned_path& lhs,
+                               const std::filesystem::path& rhs) noexcept
+            {
+            return lhs.get() == rhs;
+            }
+
+        /// @private
+        [[nodiscard]]
+        friend std::strong_ordering operator<=>(const interned_path& lhs,
+                                                const interned_path& rhs) noexcept
+            {
+            return lhs.get() <=> rhs.get();
+            }
+
+        /// @brief Writes the path (quoted, the same as @c std::filesystem::path).
+        friend std::wostream& operator<<(std::wostream& stream, const interned_path& path)
+            {
+            return stream << path.get();
+            }
+
+        /// @returns The number of unique paths that have been interned.
+        [[nodiscard]]
+        static size_t get_table_size();
+
+      private:
+        const std::filesystem::path* m_path{ nullptr };
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__INTERNED_STRING_H__
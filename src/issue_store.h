@@ -0,0 +1,472 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __ISSUE_STORE_H__
+#define __ISSUE_STORE_H__
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace i18n_check
+    {
+    /** @brief Stores results (e.g., strings) once, along with which categories
+            (i.e., issues) each one is in.
+        @details Each result is stored in one list, with a bitmask of its categories next
+            to it. Each category is a list of indices into that, so a result that is in
+            multiple categories (e.g., a localizable string that also contains a URL)
+            isn't copied into each of them.\n
+            A category keeps its results in the order that they were added to it.
+        @tparam RecordT The type of result.
+        @tparam CategoryCount The number of categories.*/
+    template<typename RecordT, size_t CategoryCount>
+    class issue_store
+        {
+      public:
+        /// @brief Which categories a result is in.
+        using issue_mask = std::bitset<CategoryCount>;
+
+        /// @brief A read-only list of the results in a category.
+        /// @details This is invalidated when results are added to (or removed from)
+        ///     the category.
+        class view
+            {
+          public:
+            /// @brief Random-access iterator over the results.
+            class const_iterator
+                {
+              public:
+                /// @private
+                using iterator_category = std::random_access_iterator_tag;
+                /// @private
+                using value_type = RecordT;
+                /// @private
+                using difference_type = std::ptrdiff_t;
+                /// @private
+                using pointer = const RecordT*;
+                /// @private
+                using reference = const RecordT&;
+
+                /// @private
+                const_iterator() = default;
+
+                /// @private
+                const_iterator(const std::vector<RecordT>* records,
+                               std::vector<uint32_t>::const_iterator index)
+                    : m_records(records), m_index(index)
+                    {
+                    }
+
+                /// @private
+                reference operator*() const { return (*m_records)[*m_index]; }
+
+                /// @private
+                pointer operator->() const { return &(*m_records)[*m_index]; }
+
+                /// @private
+                reference operator[](const difference_type offset) const
+                    {
+                    return (*m_records)[m_index[offset]];
+                    }
+
+                /// @private
+                const_iterator& operator++()
+                    {
+                    ++m_index;
+                    return *this;
+                    }
+
+                /// @private
+                const_iterator operator++(int)
+                    {
+                    auto previous{ *this };
+                    ++m_index;
+                    return previous;
+                    }
+
+                /// @private
+                const_iterator& operator--()
+                    {
+                    --m_index;
+                    return *this;
+                    }
+
+                /// @private
+                const_iterator operator--(int)
+                    {
+                    auto previous{ *this };
+                    --m_index;
+                    return previous;
+                    }
+
+                /// @private
+                const_iterator& operator+=(const difference_type offset)
+                    {
+                    m_index += offset;
+                    return *this;
+                    }
+
+                /// @private
+                const_iterator& operator-=(const difference_type offset)
+                    {
+                    m_index -= offset;
+                    return *this;
+                    }
+
+                /// @private
+                [[nodiscard]]
+                friend const_iterator operator+(const_iterator iter, const difference_type offset)
+                    {
+                    return iter += offset;
+                    }
+
+                /// @private
+                [[nodiscard]]
+                friend const_iterator operator+(const difference_type offset, const_iterator iter)
+                    {
+                    return iter += offset;
+                    }
+
+                /// @private
+                [[nodiscard]]
+                friend const_iterator operator-(const_iterator iter, const difference_type offset)
+                    {
+                    return iter -= offset;
+                    }
+
+                /// @private
+                [[nodiscard]]
+                friend difference_type operator-(const const_iterator& lhs,
+                                                 const const_iterator& rhs)
+                    {
+                    return lhs.m_index - rhs.m_index;
+                    }
+
+                /// @private
+                [[nodiscard]]
+                friend bool operator==(const const_iterator& lhs, const const_iterator& rhs)
+                    {
+                    return lhs.m_index == rhs.m_index;
+                    }
+
+                /// @private
+                [[nodiscard]]
+                friend auto operator<=>(const const_iterator& lhs, const const_iterator& rhs)
+                    {
+                    return lhs.m_index <=> rhs.m_index;
+                    }
+
+              private:
+                const std::vector<RecordT>* m_records{ nullptr };
+                std::vector<uint32_t>::const_iterator m_index;
+                };
+
+            /// @private
+            view(const std::vector<RecordT>& records, const std::vector<uint32_t>& indices)
+                : m_records(&records), m_indices(&indices)
+                {
+                }
+
+            /// @returns The number of results.
+            [[nodiscard]]
+            size_t size() const noexcept
+                {
+                return m_indices->size();
+                }
+
+            /// @returns @c true if there are no results.
+            [[nodiscard]]
+            bool empty() const noexcept
+                {
+                return m_indices->empty();
+                }
+
+            /// @returns A result.
+            /// @param position The position of the result in the category.
+            [[nodiscard]]
+            const RecordT& operator[](const size_t position) const
+                {
+                return (*m_records)[(*m_indices)[position]];
+                }
+
+            /// @returns A result.
+            /// @param position The position of the result in the category.
+            /// @throws std::out_of_range If @c position is past the end of the results.
+            [[nodiscard]]
+            const RecordT& at(const size_t position) const
+                {
+                return (*m_records)[m_indices->at(position)];
+                }
+
+            /// @returns The first result.
+            [[nodiscard]]
+            const RecordT& front() const
+                {
+                return (*m_records)[m_indices->front()];
+                }
+
+            /// @returns The last result.
+            [[nodiscard]]
+            const RecordT& back() const
+                {
+                return (*m_records)[m_indices->back()];
+                }
+
+            /// @returns An iterator to the first result.
+            [[nodiscard]]
+            const_iterator begin() const
+                {
+                return const_iterator{ m_records, m_indices->cbegin() };
+                }
+
+            /// @returns An iterator past the last result.
+            [[nodiscard]]
+            const_iterator end() const
+                {
+                return const_iterator{ m_records, m_indices->cend() };
+                }
+
+            /// @returns An iterator to the first result.
+            [[nodiscard]]
+            const_iterator cbegin() const
+                {
+                return begin();
+                }
+
+            /// @returns An iterator past the last result.
+            [[nodiscard]]
+            const_iterator cend() const
+                {
+                return end();
+                }
+
+          private:
+            const std::vector<RecordT>* m_records{ nullptr };
+            const std::vector<uint32_t>* m_indices{ nullptr };
+            };
+
+        /** @brief Adds a new result to a category.
+            @param category The category.
+            @param args The arguments to construct the result with.
+            @returns The result's index in the store.*/
+        template<typename... ArgsT>
+        size_t add(const size_t category, ArgsT&&... args)
+            {
+            if (m_records.size() >= std::numeric_limits<uint32_t>::max())
+                {
+                throw std::length_error("Too many results.");
+                }
+            const auto index{ static_cast<uint32_t>(m_records.size()) };
+            m_records.emplace_back(std::forward<ArgsT>(args)...);
+            m_issues.emplace_back();
+            add_existing(category, index);
+            return index;
+            }
+
+        /** @brief Adds a result already in the store to another category.
+            @param category The category.
+            @param index The result's index in the store.*/
+        void add_existing(const size_t category, const size_t index)
+            {
+            m_issues[index].set(category);
+            m_categories[category].push_back(static_cast<uint32_t>(index));
+            }
+
+        /// @returns The results in a category.
+        /// @param category The category.
+        [[nodiscard]]
+        view get(const size_t category) const
+            {
+            return view{ m_records, m_categories[category] };
+            }
+
+        /// @returns The indices (into the store) of the results in a category.
+        /// @param category The category.
+        [[nodiscard]]
+        const std::vector<uint32_t>& get_indices(const size_t category) const noexcept
+            {
+            return m_categories[category];
+            }
+
+        /// @returns A result.
+        /// @param index The result's index in the store.
+        [[nodiscard]]
+        const RecordT& get_record(const size_t index) const
+            {
+            return m_records[index];
+            }
+
+        /// @returns A result.
+        /// @param index The result's index in the store.
+        [[nodiscard]]
+        RecordT& get_record(const size_t index)
+            {
+            return m_records[index];
+            }
+
+        /// @returns The categories that a result is in.
+        /// @param index The result's index in the store.
+        [[nodiscard]]
+        const issue_mask& get_issues(const size_t index) const
+            {
+            return m_issues[index];
+            }
+
+        /// @returns The number of results (each counted once, regardless of how
+        ///     many categories they are in).
+        [[nodiscard]]
+        size_t size() const noexcept
+            {
+            return m_records.size();
+            }
+
+        /// @brief Reserves space for a number of results.
+        /// @param count The number of results.
+        void reserve(const size_t count)
+            {
+            m_records.reserve(count);
+            m_issues.reserve(count);
+            }
+
+        /// @brief Removes all results.
+        void clear()
+            {
+            m_records.clear();
+            m_issues.clear();
+            for (auto& category : m_categories)
+                {
+                category.clear();
+                }
+            }
+
+        /// @brief Removes results from the store (and all of their categories).
+        /// @param shouldRemove Function returning whether a result should be removed.
+        template<typename PredicateT>
+        void remove_if(PredicateT shouldRemove)
+            {
+            constexpr auto REMOVED{ std::numeric_limits<uint32_t>::max() };
+            std::vector<uint32_t> newIndices(m_records.size(), REMOVED);
+            size_t keptCount{ 0 };
+            for (size_t i = 0; i < m_records.size(); ++i)
+                {
+                if (!shouldRemove(std::as_const(m_records[i])))
+                    {
+                    if (keptCount != i)
+                        {
+                        m_records[keptCount] = std::move(m_records[i]);
+                        m_issues[keptCount] = m_issues[i];
+                        }
+                    newIndices[i] = static_cast<uint32_t>(keptCount++);
+                    }
+                }
+            m_records.resize(keptCount);
+            m_issues.resize(keptCount);
+            for (auto& category : m_categories)
+                {
+                std::erase_if(category, [&newIndices](const uint32_t index)
+                              { return newIndices[index] == REMOVED; });
+                for (auto& index : category)
+                    {
+                    index = newIndices[index];
+                    }
+                }
+            }
+
+        /** @brief Moves the results from other stores into this one, and then sorts
+                each category's new results by a key (e.g., the file that they are from).
+            @details The new results are sorted after the ones already in each category,
+                and results with the same key are kept in the same order that they were in
+                the other stores (and in the order of the stores).
+            @param others The stores to move the results from.
+            @param sortKey Function returning a result's sort key.*/
+        template<typename SortKeyFunc>
+        void merge(const std::vector<issue_store*>& others, SortKeyFunc sortKey)
+            {
+            // append the other stores' results, remembering where each one starts
+            const size_t firstNewRecord{ m_records.size() };
+            std::vector<size_t> offsets;
+            offsets.reserve(others.size());
+            for (auto* other : others)
+                {
+                if (m_records.size() + other->m_records.size() >=
+                    std::numeric_limits<uint32_t>::max())
+                    {
+                    throw std::length_error("Too many results.");
+                    }
+                offsets.push_back(m_records.size());
+                m_records.insert(m_records.end(),
+                                 std::make_move_iterator(other->m_records.begin()),
+                                 std::make_move_iterator(other->m_records.end()));
+                m_issues.insert(m_issues.end(), other->m_issues.cbegin(),
+                                other->m_issues.cend());
+                }
+
+            // look up each result's sort key only once
+            std::vector<size_t> sortKeys(m_records.size() - firstNewRecord);
+            for (size_t i = 0; i < sortKeys.size(); ++i)
+                {
+                sortKeys[i] = sortKey(std::as_const(m_records[firstNewRecord + i]));
+                }
+
+            for (size_t category = 0; category < CategoryCount; ++category)
+                {
+                // (sort key, position in the combined lists, index in the store)
+                std::vector<std::tuple<size_t, size_t, uint32_t>> newIndices;
+                for (size_t otherIndex = 0; otherIndex < others.size(); ++otherIndex)
+                    {
+                    for (const auto index : others[otherIndex]->m_categories[category])
+                        {
+                        const auto mergedIndex{ static_cast<uint32_t>(offsets[otherIndex] +
+                                                                      index) };
+                        newIndices.emplace_back(sortKeys[mergedIndex - firstNewRecord],
+                                                newIndices.size(), mergedIndex);
+                        }
+                    }
+                std::sort(newIndices.begin(), newIndices.end());
+                auto& indices = m_categories[category];
+                indices.reserve(indices.size() + newIndices.size());
+                for (const auto& newIndex : newIndices)
+                    {
+                    indices.push_back(std::get<2>(newIndex));
+                    }
+                }
+
+            for (auto* other : others)
+                {
+                other->clear();
+                }
+            }
+
+      private:
+        std::vector<RecordT> m_records;
+        std::vector<issue_mask> m_issues;
+        std::array<std::vector<uint32_t>, CategoryCount> m_categories;
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__ISSUE_STORE_H__
@@ -0,0 +1,487 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "json.h"
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+
+namespace i18n_check
+    {
+    /// @brief Recursive descent parser for JSON text.
+    class json_value::parser
+        {
+      public:
+        explicit parser(std::string_view text) : m_text(text) {}
+
+        json_value parse_document()
+            {
+            json_value value{ parse_value(0) };
+            skip_whitespace();
+            if (m_position != m_text.length())
+                {
+                throw std::runtime_error("Unexpected content after JSON value.");
+                }
+            return value;
+            }
+
+      private:
+        // guards against stack overflows from deeply nested (or malicious) input
+        constexpr static size_t MAX_DEPTH{ 256 };
+
+        void skip_whitespace() noexcept
+            {
+            while (m_position < m_text.length() &&
+                   (m_text[m_position] == ' ' || m_text[m_position] == '\t' ||
+                    m_text[m_position] == '\n' || m_text[m_position] == '\r'))
+                {
+                ++m_position;
+                }
+            }
+
+        [[nodiscard]]
+        char peek()
+            {
+            skip_whitespace();
+            if (m_position >= m_text.length())
+                {
+                throw std::runtime_error("Unexpected end of JSON text.");
+                }
+            return m_text[m_position];
+            }
+
+        void expect(const char chr)
+            {
+            if (peek() != chr)
+                {
+                throw std::runtime_error(std::string{ "Expected '" } + chr + "' in JSON text.");
+                }
+            ++m_position;
+            }
+
+        [[nodiscard]]
+        bool consume_literal(std::string_view literal) noexcept
+            {
+            if (m_text.substr(m_position, literal.length()) == literal)
+                {
+                m_position += literal.length();
+                return true;
+                }
+            return false;
+            }
+
+        json_value parse_value(const size_t depth)
+            {
+            if (depth > MAX_DEPTH)
+                {
+                throw std::runtime_error("JSON text is nested too deeply.");
+                }
+            const char chr{ peek() };
+            if (chr == '{')
+                {
+                return parse_object(depth);
+                }
+            else if (chr == '[')
+                {
+                return parse_array(depth);
+                }
+            else if (chr == '"')
+                {
+                return json_value{ parse_string() };
+                }
+            else if (consume_literal("true"))
+                {
+                return json_value{ true };
+                }
+            else if (consume_literal("false"))
+                {
+                return json_value{ false };
+                }
+            else if (consume_literal("null"))
+                {
+                return json_value{};
+                }
+            return json_value{ parse_number() };
+            }
+
+        json_value parse_object(const size_t depth)
+            {
+            expect('{');
+            object members;
+            if (peek() == '}')
+                {
+                ++m_position;
+                return json_value{ std::move(members) };
+                }
+            while (true)
+                {
+                if (peek() != '"')
+                    {
+                    throw std::runtime_error("Expected a string key in JSON object.");
+                    }
+                std::string key{ parse_string() };
+                expect(':');
+                members.emplace_back(std::move(key), parse_value(depth + 1));
+                if (peek() == ',')
+                    {
+                    ++m_position;
+                    continue;
+                    }
+                expect('}');
+                return json_value{ std::move(members) };
+                }
+            }
+
+        json_value parse_array(const size_t depth)
+            {
+            expect('[');
+            array values;
+            if (peek() == ']')
+                {
+                ++m_position;
+                return json_value{ std::move(values) };
+                }
+            while (true)
+                {
+                values.push_back(parse_value(depth + 1));
+                if (peek() == ',')
+                    {
+                    ++m_position;
+                    continue;
+                    }
+                expect(']');
+                return json_value{ std::move(values) };
+                }
+            }
+
+        double parse_number()
+            {
+            const size_t start{ m_position };
+            while (m_position < m_text.length() &&
+                   std::string_view{ "+-0123456789.eE" }.find(m_text[m_position]) !=
+                       std::string_view::npos)
+                {
+                ++m_position;
+                }
+            double value{ 0 };
+            const auto [end, ec] =
+                std::from_chars(m_text.data() + start, m_text.data() + m_position, value);
+            if (start == m_position || ec != std::errc{} || end != m_text.data() + m_position)
+                {
+                throw std::runtime_error("Invalid value in JSON text.");
+                }
+            return value;
+            }
+
+        [[nodiscard]]
+        uint32_t parse_hex4()
+            {
+            if (m_position + 4 > m_text.length())
+                {
+                throw std::runtime_error("Invalid unicode escape in JSON string.");
+                }
+            uint32_t value{ 0 };
+            const auto [end, ec] = std::from_chars(m_text.data() + m_position,
+                                                   m_text.data() + m_position + 4, value, 16);
+            if (ec != std::errc{} || end != m_text.data() + m_position + 4)
+                {
+                throw std::runtime_error("Invalid unicode escape in JSON string.");
+                }
+            m_position += 4;
+            return value;
+            }
+
+        static void append_utf8(std::string& str, const uint32_t codePoint)
+            {
+            if (codePoint < 0x80)
+                {
+                str += static_cast<char>(codePoint);
+                }
+            else if (codePoint < 0x800)
+                {
+                str += static_cast<char>(0xC0 | (codePoint >> 6));
+                str += static_cast<char>(0x80 | (codePoint & 0x3F));
+                }
+            else if (codePoint < 0x10000)
+                {
+                str += static_cast<char>(0xE0 | (codePoint >> 12));
+                str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                str += static_cast<char>(0x80 | (codePoint & 0x3F));
+                }
+            else
+                {
+                str += static_cast<char>(0xF0 | (codePoint >> 18));
+                str += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                str += static_cast<char>(0x80 | (codePoint & 0x3F));
+                }
+            }
+
+        std::string parse_string()
+            {
+            expect('"');
+            std::string str;
+            while (true)
+                {
+                if (m_position >= m_text.length())
+                    {
+                    throw std::runtime_error("Unterminated JSON string.");
+                    }
+                const char chr{ m_text[m_position++] };
+                if (chr == '"')
+                    {
+                    return str;
+                    }
+                if (chr != '\\')
+                    {
+                    str += chr;
+                    continue;
+                    }
+                if (m_position >= m_text.length())
+                    {
+                    throw std::runtime_error("Unterminated JSON string.");
+                    }
+                const char escaped{ m_text[m_position++] };
+                if (escaped == 'n')
+                    {
+                    str += '\n';
+                    }
+                else if (escaped == 't')
+                    {
+                    str += '\t';
+                    }
+                else if (escaped == 'r')
+                    {
+                    str += '\r';
+                    }
+                else if (escaped == 'b')
+                    {
+                    str += '\b';
+                    }
+                else if (escaped == 'f')
+                    {
+                    str += '\f';
+                    }
+                else if (escaped == 'u')
+                    {
+                    uint32_t codePoint{ parse_hex4() };
+                    // surrogate pair
+                    if (codePoint >= 0xD800 && codePoint <= 0xDBFF &&
+                        consume_literal("\\u"))
+                        {
+                        const uint32_t lowSurrogate{ parse_hex4() };
+                        if (lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+                            {
+                            throw std::runtime_error("Invalid surrogate pair in JSON string.");
+                            }
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) +
+                                    (lowSurrogate - 0xDC00);
+                        }
+                    append_utf8(str, codePoint);
+                    }
+                // quotes, slashes, and backslashes
+                else
+                    {
+                    str += escaped;
+                    }
+                }
+            }
+
+        std::string_view m_text;
+        size_t m_position{ 0 };
+        };
+
+    //------------------------------------------------------
+    bool json_value::as_bool() const
+        {
+        if (const auto* value = std::get_if<bool>(&m_value))
+            {
+            return *value;
+            }
+        throw std::runtime_error("JSON value is not a boolean.");
+        }
+
+    //------------------------------------------------------
+    double json_value::as_number() const
+        {
+        if (const auto* value = std::get_if<double>(&m_value))
+            {
+            return *value;
+            }
+        throw std::runtime_error("JSON value is not a number.");
+        }
+
+    //------------------------------------------------------
+    const std::string& json_value::as_string() const
+        {
+        if (const auto* value = std::get_if<std::string>(&m_value))
+            {
+            return *value;
+            }
+        throw std::runtime_error("JSON value is not a string.");
+        }
+
+    //------------------------------------------------------
+    const json_value::array& json_value::as_array() const
+        {
+        if (const auto* value = std::get_if<array>(&m_value))
+            {
+            return *value;
+            }
+        throw std::runtime_error("JSON value is not an array.");
+        }
+
+    //------------------------------------------------------
+    const json_value& json_value::operator[](std::string_view key) const
+        {
+        static const json_value nullValue;
+        if (const auto* members = std::get_if<object>(&m_value))
+            {
+            for (const auto& member : *members)
+                {
+                if (member.first == key)
+                    {
+                    return member.second;
+                    }
+                }
+            }
+        return nullValue;
+        }
+
+    //------------------------------------------------------
+    json_value& json_value::operator[](std::string_view key)
+        {
+        auto* members = std::get_if<object>(&m_value);
+        if (members == nullptr)
+            {
+            throw std::runtime_error("JSON value is not an object.");
+            }
+        for (auto& member : *members)
+            {
+            if (member.first == key)
+                {
+                return member.second;
+                }
+            }
+        return members->emplace_back(std::string{ key }, json_value{}).second;
+        }
+
+    //------------------------------------------------------
+    std::string json_value::dump() const
+        {
+        std::string output;
+        dump(output);
+        return output;
+        }
+
+    //------------------------------------------------------
+    void json_value::dump_string(std::string& output, std::string_view str)
+        {
+        constexpr std::string_view HEX_DIGITS{ "0123456789abcdef" };
+        output += '"';
+        for (const char chr : str)
+            {
+            if (chr == '"' || chr == '\\')
+                {
+                output += '\\';
+                output += chr;
+                }
+            else if (chr == '\n')
+                {
+                output += "\\n";
+                }
+            else if (chr == '\r')
+                {
+                output += "\\r";
+                }
+            else if (chr == '\t')
+                {
+                output += "\\t";
+                }
+            else if (static_cast<unsigned char>(chr) < 0x20)
+                {
+                output += "\\u00";
+                output += HEX_DIGITS[(static_cast<unsigned char>(chr) >> 4) & 0xF];
+                output += HEX_DIGITS[static_cast<unsigned char>(chr) & 0xF];
+                }
+            else
+                {
+                output += chr;
+                }
+            }
+        output += '"';
+        }
+
+    //------------------------------------------------------
+    void json_value::dump(std::string& output) const
+        {
+        if (is_null())
+            {
+            output += "null";
+            }
+        else if (const auto* boolValue = std::get_if<bool>(&m_value))
+            {
+            output += *boolValue ? "true" : "false";
+            }
+        else if (const auto* number = std::get_if<double>(&m_value))
+            {
+            std::array<char, 32> buffer{};
+            // write whole numbers (e.g., IDs and line numbers) without a decimal
+            const auto [end, ec] =
+                (std::trunc(*number) == *number && std::abs(*number) < 1e15) ?
+                    std::to_chars(buffer.data(), buffer.data() + buffer.size(),
+                                  static_cast<int64_t>(*number)) :
+                    std::to_chars(buffer.data(), buffer.data() + buffer.size(), *number);
+            output.append(buffer.data(), (ec == std::errc{}) ? end : buffer.data());
+            }
+        else if (const auto* str = std::get_if<std::string>(&m_value))
+            {
+            dump_string(output, *str);
+            }
+        else if (const auto* values = std::get_if<array>(&m_value))
+            {
+            output += '[';
+            for (size_t i = 0; i < values->size(); ++i)
+                {
+                if (i > 0)
+                    {
+                    output += ',';
+                    }
+                (*values)[i].dump(output);
+                }
+            output += ']';
+            }
+        else if (const auto* members = std::get_if<object>(&m_value))
+            {
+            output += '{';
+            for (size_t i = 0; i < members->size(); ++i)
+                {
+                if (i > 0)
+                    {
+                    output += ',';
+                    }
+                dump_string(output, (*members)[i].first);
+                output += ':';
+                (*members)[i].second.dump(output);
+                }
+            output += '}';
+            }
+        }
+
+    //------------------------------------------------------
+    json_value json_value::parse(std::string_view text)
+        {
+        return parser{ text }.parse_document();
+        }
+    } // namespace i18n_check
@@ -0,0 +1,174 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __QUNEIFORM_JSON_H__
+#define __QUNEIFORM_JSON_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace i18n_check
+    {
+    /** @brief A JSON value, which is just enough to read and write
+            Language Server Protocol messages.
+        @details Strings are stored as UTF-8, and numbers are stored as doubles.
+        @par Example:
+        @code
+         auto message = i18n_check::json_value::parse(R"({"id":1,"method":"shutdown"})");
+         if (message["method"].as_string() == "shutdown")
+            {
+            i18n_check::json_value response{ i18n_check::json_value::object{} };
+            response["id"] = message["id"];
+            response["result"] = nullptr;
+            const std::string output = response.dump();
+            }
+        @endcode*/
+    class json_value
+        {
+      public:
+        /// @brief A JSON array.
+        using array = std::vector<json_value>;
+        /// @brief A JSON object (members are kept in the order that they were added).
+        using object = std::vector<std::pair<std::string, json_value>>;
+
+        /// @brief Constructs a null value.
+        json_value() = default;
+
+        /// @brief Constructs a null value.
+        json_value(std::nullptr_t) {}
+
+        /// @brief Constructs a boolean value.
+        /// @param value The value.
+        json_value(const bool value) : m_value(value) {}
+
+        /// @brief Constructs a number.
+        /// @param value The value.
+        json_value(const double value) : m_value(value) {}
+
+        /// @brief Constructs a number.
+        /// @param value The value.
+        json_value(const int value) : m_value(static_cast<double>(value)) {}
+
+        /// @brief Constructs a number.
+        /// @param value The value.
+        json_value(const size_t value) : m_value(static_cast<double>(value)) {}
+
+        /// @brief Constructs a string.
+        /// @param value The value (in UTF-8).
+        json_value(std::string value) : m_value(std::move(value)) {}
+
+        /// @brief Constructs a string.
+        /// @param value The value (in UTF-8).
+        json_value(const char* value) : m_value(std::string{ value }) {}
+
+        /// @brief Constructs an array.
+        /// @param value The value.
+        json_value(array value) : m_value(std::move(value)) {}
+
+        /// @brief Constructs an object.
+        /// @param value The value.
+        json_value(object value) : m_value(std::move(value)) {}
+
+        /// @returns @c true if the value is null (or missing).
+        [[nodiscard]]
+        bool is_null() const noexcept
+            {
+            return std::holds_alternative<std::nullptr_t>(m_value);
+            }
+
+        /// @returns @c true if the value is a string.
+        [[nodiscard]]
+        bool is_string() const noexcept
+            {
+            return std::holds_alternative<std::string>(m_value);
+            }
+
+        /// @returns @c true if the value is an array.
+        [[nodiscard]]
+        bool is_array() const noexcept
+            {
+            return std::holds_alternative<array>(m_value);
+            }
+
+        /// @returns @c true if the value is an object.
+        [[nodiscard]]
+        bool is_object() const noexcept
+            {
+            return std::holds_alternative<object>(m_value);
+            }
+
+        /// @returns The value as a boolean.
+        /// @throws std::runtime_error If the value is not a boolean.
+        [[nodiscard]]
+        bool as_bool() const;
+
+        /// @returns The value as a number.
+        /// @throws std::runtime_error If the value is not a number.
+        [[nodiscard]]
+        double as_number() const;
+
+        /// @returns The value as a string.
+        /// @throws std::runtime_error If the value is not a string.
+        [[nodiscard]]
+        const std::string& as_string() const;
+
+        /// @returns The value as an array.
+        /// @throws std::runtime_error If the value is not an array.
+        [[nodiscard]]
+        const array& as_array() const;
+
+        /// @returns The member of an object with the given key, or a null value
+        ///     if there is no such member (or this is not an object).
+        /// @param key The member's key.
+        [[nodiscard]]
+        const json_value& operator[](std::string_view key) const;
+
+        /// @returns The member of an object with the given key, which is added if necessary.
+        /// @param key The member's key.
+        /// @throws std::runtime_error If the value is not an object.
+        json_value& operator[](std::string_view key);
+
+        /// @returns The value written as JSON.
+        [[nodiscard]]
+        std::string dump() const;
+
+        /// @returns A value parsed from JSON text.
+        /// @param text The JSON text (in UTF-8).
+        /// @throws std::runtime_error If the text is malformed.
+        [[nodiscard]]
+        static json_value parse(std::string_view text);
+
+      private:
+        class parser;
+
+        /// @brief Writes the value as JSON.
+        void dump(std::string& output) const;
+        /// @brief Writes a string as JSON, with quotes and escapes.
+        static void dump_string(std::string& output, std::string_view str);
+
+        std::variant<std::nullptr_t, bool, double, std::string, array, object> m_value;
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__QUNEIFORM_JSON_H__
@@ -0,0 +1,233 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "lsp_protocol.h"
+#include "../text_decode.h"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cwctype>
+#include <stdexcept>
+
+namespace i18n_check
+    {
+    //------------------------------------------------------
+    std::filesystem::path uri_to_path(std::string_view uri)
+        {
+        constexpr std::string_view FILE_SCHEME{ "file://" };
+        if (!uri.starts_with(FILE_SCHEME))
+            {
+            return {};
+            }
+        uri.remove_prefix(FILE_SCHEME.length());
+
+        std::string decodedUri;
+        decodedUri.reserve(uri.length());
+        for (size_t i = 0; i < uri.length(); ++i)
+            {
+            uint8_t value{ 0 };
+            if (uri[i] == '%' && i + 2 < uri.length() &&
+                std::from_chars(uri.data() + i + 1, uri.data() + i + 3, value, 16).ptr ==
+                    uri.data() + i + 3)
+                {
+                decodedUri += static_cast<char>(value);
+                i += 2;
+                }
+            else
+                {
+                decodedUri += uri[i];
+                }
+            }
+#ifdef _WIN32
+        // "file:///c:/folder" is "c:/folder"
+        if (decodedUri.length() > 2 && decodedUri[0] == '/' && decodedUri[2] == ':')
+            {
+            decodedUri.erase(0, 1);
+            }
+#endif
+
+        std::wstring filePath;
+        if (!decode_utf8(decodedUri, filePath))
+            {
+            return {};
+            }
+        return std::filesystem::path{ filePath }.lexically_normal();
+        }
+
+    //------------------------------------------------------
+    std::string path_to_uri(const std::filesystem::path& filePath)
+        {
+        constexpr std::string_view HEX_DIGITS{ "0123456789ABCDEF" };
+        const std::string utf8Path{ encode_utf8(filePath.generic_wstring()) };
+        std::string uri{ "file://" };
+#ifdef _WIN32
+        uri += '/';
+#endif
+        for (const char chr : utf8Path)
+            {
+            const auto value{ static_cast<unsigned char>(chr) };
+            if ((value >= 'a' && value <= 'z') || (value >= 'A' && value <= 'Z') ||
+                (value >= '0' && value <= '9') ||
+                std::string_view{ "/-._~:" }.find(chr) != std::string_view::npos)
+                {
+                uri += chr;
+                }
+            else
+                {
+                uri += '%';
+                uri += HEX_DIGITS[value >> 4];
+                uri += HEX_DIGITS[value & 0xF];
+                }
+            }
+        return uri;
+        }
+
+    //------------------------------------------------------
+    const std::string* get_document_text(std::string_view method, const json_value& params)
+        {
+        const json_value* text{ nullptr };
+        if (method == "textDocument/didOpen")
+            {
+            text = &params["textDocument"]["text"];
+            }
+        else if (method == "textDocument/didChange" && params["contentChanges"].is_array() &&
+                 !params["contentChanges"].as_array().empty())
+            {
+            text = &params["contentChanges"].as_array().back()["text"];
+            }
+        return (text != nullptr && text->is_string()) ? &text->as_string() : nullptr;
+        }
+
+    //------------------------------------------------------
+    size_t utf16_length(std::wstring_view text) noexcept
+        {
+        if constexpr (sizeof(wchar_t) == 2)
+            {
+            return text.length();
+            }
+        else
+            {
+            // characters outside of the BMP are surrogate pairs in UTF-16
+            size_t length{ text.length() };
+            for (const wchar_t chr : text)
+                {
+                if (static_cast<uint32_t>(chr) > 0xFFFF)
+                    {
+                    ++length;
+                    }
+                }
+            return length;
+            }
+        }
+
+    //------------------------------------------------------
+    size_t get_issue_length(std::wstring_view line, const size_t column) noexcept
+        {
+        if (column >= line.length())
+            {
+            return 0;
+            }
+
+        // strings are reported at their first character, after the opening quote
+        if (column > 0 && (line[column - 1] == L'"' || line[column - 1] == L'\''))
+            {
+            const wchar_t quote{ line[column - 1] };
+            // C# verbatim strings escape quotes by doubling them, rather than with a backslash
+            const bool isVerbatim{ column > 1 && line[column - 2] == L'@' };
+            for (size_t i = column; i < line.length(); ++i)
+                {
+                if (!isVerbatim && line[i] == L'\\')
+                    {
+                    ++i;
+                    }
+                else if (line[i] == quote)
+                    {
+                    if (isVerbatim && i + 1 < line.length() && line[i + 1] == quote)
+                        {
+                        ++i;
+                        continue;
+                        }
+                    return i - column;
+                    }
+                }
+            // the string continues onto the next line
+            return line.length() - column;
+            }
+
+        const bool isSpace{ static_cast<bool>(std::iswspace(line[column])) };
+        size_t end{ column };
+        while (end < line.length() &&
+               (isSpace ? static_cast<bool>(std::iswspace(line[end])) :
+                          (static_cast<bool>(std::iswalnum(line[end])) || line[end] == L'_')))
+            {
+            ++end;
+            }
+        // at least highlight the character that the issue is at
+        return std::max<size_t>(end - column, 1);
+        }
+
+    //------------------------------------------------------
+    std::optional<std::string> read_lsp_message(std::istream& input)
+        {
+        std::optional<size_t> contentLength;
+        std::string headerLine;
+        while (std::getline(input, headerLine))
+            {
+            if (!headerLine.empty() && headerLine.back() == '\r')
+                {
+                headerLine.pop_back();
+                }
+            // a blank line ends the header
+            if (headerLine.empty())
+                {
+                if (!contentLength)
+                    {
+                    throw std::runtime_error("LSP message is missing its Content-Length.");
+                    }
+                std::string content(contentLength.value(), '\0');
+                if (!input.read(content.data(), static_cast<std::streamsize>(content.length())))
+                    {
+                    return std::nullopt;
+                    }
+                return content;
+                }
+            constexpr std::string_view CONTENT_LENGTH{ "Content-Length:" };
+            if (headerLine.starts_with(CONTENT_LENGTH))
+                {
+                std::string_view value{ headerLine };
+                value.remove_prefix(CONTENT_LENGTH.length());
+                while (!value.empty() && value.front() == ' ')
+                    {
+                    value.remove_prefix(1);
+                    }
+                size_t length{ 0 };
+                const auto [end, ec] =
+                    std::from_chars(value.data(), value.data() + value.length(), length);
+                if (ec != std::errc{})
+                    {
+                    throw std::runtime_error("LSP message has an invalid Content-Length.");
+                    }
+                contentLength = length;
+                }
+            }
+        return std::nullopt;
+        }
+
+    //------------------------------------------------------
+    void write_lsp_message(std::ostream& output, const json_value& message)
+        {
+        const std::string content{ message.dump() };
+        output << "Content-Length: " << content.length() << "\r\n\r\n" << content;
+        output.flush();
+        }
+    } // namespace i18n_check
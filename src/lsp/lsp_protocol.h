@@ -0,0 +1,84 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __QUNEIFORM_LSP_PROTOCOL_H__
+#define __QUNEIFORM_LSP_PROTOCOL_H__
+
+#include "json.h"
+#include <filesystem>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace i18n_check
+    {
+    /// @returns The local path of a `file://` URI, or an empty path if it is not a file URI.
+    /// @param uri The URI (in UTF-8).
+    [[nodiscard]]
+    std::filesystem::path uri_to_path(std::string_view uri);
+
+    /// @returns A `file://` URI (in UTF-8) for a local path.
+    /// @param filePath The (absolute) path.
+    [[nodiscard]]
+    std::string path_to_uri(const std::filesystem::path& filePath);
+
+    /** @returns The full text of a document from the parameters of a
+            `textDocument/didOpen` or `textDocument/didChange` notification,
+            or null if the parameters don't include it.
+        @details Documents are synced in full, so a change's text is the last
+            item in its `contentChanges`.
+        @param method The notification's method.
+        @param params The notification's parameters.*/
+    [[nodiscard]]
+    const std::string* get_document_text(std::string_view method, const json_value& params);
+
+    /** @returns The length of text in UTF-16 code units, which is what
+            Language Server Protocol positions count columns in.
+        @param text The text.*/
+    [[nodiscard]]
+    size_t utf16_length(std::wstring_view text) noexcept;
+
+    /** @returns The length of the source code that an issue refers to, starting from
+            the issue's column.
+        @details If the issue is for a string, then this is the length of the string
+            literal's content (up to its closing quote, or the end of the line).
+            Otherwise, it is the length of the whitespace (e.g., a tab) or name
+            (e.g., a deprecated function) at the column.
+        @param line The text of the issue's line.
+        @param column The (zero-indexed) position of the issue in the line.*/
+    [[nodiscard]]
+    size_t get_issue_length(std::wstring_view line, const size_t column) noexcept;
+
+    /** @brief Reads a Language Server Protocol message (a `Content-Length` header,
+            followed by the JSON content).
+        @param input The stream to read from.
+        @returns The message's content, or @c std::nullopt if the stream ended.
+        @throws std::runtime_error If the header is malformed.*/
+    [[nodiscard]]
+    std::optional<std::string> read_lsp_message(std::istream& input);
+
+    /** @brief Writes a Language Server Protocol message.
+        @param output The stream to write to.
+        @param message The message's content.*/
+    void write_lsp_message(std::ostream& output, const json_value& message);
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__QUNEIFORM_LSP_PROTOCOL_H__
@@ -0,0 +1,440 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "lsp_server.h"
+#include "../input.h"
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+namespace i18n_check
+    {
+    //------------------------------------------------------
+    lsp_server::lsp_server(std::istream& input, std::ostream& output)
+        : m_input(input), m_output(output)
+        {
+        m_analyzer.set_jobs(0);
+        }
+
+    //------------------------------------------------------
+    int lsp_server::run()
+        {
+        // messages are read on a separate thread, so that edits can be debounced
+        // while waiting for more input
+        std::thread reader(
+            [queue = m_message_queue, &input = m_input]()
+            {
+                while (true)
+                    {
+                    std::optional<std::string> message;
+                    try
+                        {
+                        message = read_lsp_message(input);
+                        }
+                    catch (const std::exception& expt)
+                        {
+                        std::cerr << expt.what() << "\n";
+                        }
+                        {
+                        std::lock_guard<std::mutex> lock(queue->m_mutex);
+                        queue->m_messages.push_back(message);
+                        }
+                    queue->m_changed.notify_one();
+                    if (!message)
+                        {
+                        return;
+                        }
+                    }
+            });
+        // the client may not close the input after exiting,
+        // so don't wait on the reader after the server is finished
+        reader.detach();
+
+        while (true)
+            {
+            std::optional<std::string> message;
+                {
+                std::unique_lock<std::mutex> lock(m_message_queue->m_mutex);
+                const auto hasMessage = [this]() { return !m_message_queue->m_messages.empty(); };
+                if (m_pending_documents.empty() && m_closed_documents.empty())
+                    {
+                    m_message_queue->m_changed.wait(lock, hasMessage);
+                    }
+                // wait for the user to stop typing before analyzing the edited documents
+                else if (!m_message_queue->m_changed.wait_until(
+                             lock, m_last_edit + m_debounce_delay, hasMessage))
+                    {
+                    lock.unlock();
+                    analyze_pending_documents();
+                    continue;
+                    }
+                message = std::move(m_message_queue->m_messages.front());
+                m_message_queue->m_messages.pop_front();
+                }
+
+            // the input ended
+            if (!message)
+                {
+                return m_shutdown_requested ? 0 : 1;
+                }
+
+            json_value parsedMessage;
+            try
+                {
+                parsedMessage = json_value::parse(message.value());
+                }
+            catch (const std::exception& expt)
+                {
+                constexpr int PARSE_ERROR{ -32'700 };
+                send_error(json_value{}, PARSE_ERROR, expt.what());
+                continue;
+                }
+
+            try
+                {
+                if (!handle_message(parsedMessage))
+                    {
+                    return m_shutdown_requested ? 0 : 1;
+                    }
+                }
+            catch (const std::exception& expt)
+                {
+                // notifications can't be responded to, so just log the error
+                if (parsedMessage["id"].is_null())
+                    {
+                    std::cerr << expt.what() << "\n";
+                    }
+                else
+                    {
+                    constexpr int INTERNAL_ERROR{ -32'603 };
+                    send_error(parsedMessage["id"], INTERNAL_ERROR, expt.what());
+                    }
+                }
+            }
+        }
+
+    //------------------------------------------------------
+    bool lsp_server::handle_message(const json_value& message)
+        {
+        const json_value& id{ message["id"] };
+        const json_value& params{ message["params"] };
+        const std::string method{ message["method"].is_string() ? message["method"].as_string() :
+                                                                  std::string{} };
+
+        if (method == "initialize")
+            {
+            initialize(params);
+            json_value textDocumentSync{ json_value::object{} };
+            textDocumentSync["openClose"] = true;
+            // the full text of a document is sent with each change
+            textDocumentSync["change"] = 1;
+            json_value capabilities{ json_value::object{} };
+            capabilities["textDocumentSync"] = std::move(textDocumentSync);
+            // columns are converted from the analyzers' characters to UTF-16 code units
+            // (the encoding that every client supports)
+            capabilities["positionEncoding"] = "utf-16";
+            json_value serverInfo{ json_value::object{} };
+            serverInfo["name"] = "quneiform";
+            json_value result{ json_value::object{} };
+            result["capabilities"] = std::move(capabilities);
+            result["serverInfo"] = std::move(serverInfo);
+            send_response(id, std::move(result));
+            }
+        else if (method == "initialized")
+            {
+            analyze_workspace();
+            }
+        else if (method == "shutdown")
+            {
+            m_shutdown_requested = true;
+            send_response(id, json_value{});
+            }
+        else if (method == "exit")
+            {
+            return false;
+            }
+        else if (method == "textDocument/didOpen" || method == "textDocument/didChange")
+            {
+            const std::filesystem::path filePath{ uri_to_path(
+                params["textDocument"]["uri"].as_string()) };
+            // malformed notifications (e.g., a change without any content) are ignored
+            const std::string* text{ get_document_text(method, params) };
+            if (filePath.empty() || get_file_type(filePath) == file_review_type::unknown ||
+                text == nullptr)
+                {
+                return true;
+                }
+            std::wstring documentText;
+            if (!decode_utf8(*text, documentText))
+                {
+                throw std::runtime_error("Document is not valid UTF-8.");
+                }
+            m_pending_documents.insert_or_assign(filePath, std::move(documentText));
+            std::erase(m_closed_documents, filePath);
+            m_last_edit = std::chrono::steady_clock::now();
+            if (std::find(m_files.cbegin(), m_files.cend(), filePath) == m_files.cend())
+                {
+                m_files.push_back(filePath);
+                }
+            }
+        else if (method == "textDocument/didClose")
+            {
+            const std::filesystem::path filePath{ uri_to_path(
+                params["textDocument"]["uri"].as_string()) };
+            if (filePath.empty())
+                {
+                return true;
+                }
+            m_pending_documents.erase(filePath);
+            m_closed_documents.push_back(filePath);
+            m_last_edit = std::chrono::steady_clock::now();
+            }
+        // requests that aren't supported
+        else if (!id.is_null())
+            {
+            constexpr int METHOD_NOT_FOUND{ -32'601 };
+            send_error(id, METHOD_NOT_FOUND, "Unsupported method: " + method);
+            }
+
+        return true;
+        }
+
+    //------------------------------------------------------
+    void lsp_server::send_response(const json_value& id, json_value result)
+        {
+        json_value response{ json_value::object{} };
+        response["jsonrpc"] = "2.0";
+        response["id"] = id;
+        response["result"] = std::move(result);
+        write_lsp_message(m_output, response);
+        }
+
+    //------------------------------------------------------
+    void lsp_server::send_error(const json_value& id, const int code, std::string message)
+        {
+        json_value error{ json_value::object{} };
+        error["code"] = code;
+        error["message"] = std::move(message);
+        json_value response{ json_value::object{} };
+        response["jsonrpc"] = "2.0";
+        response["id"] = id;
+        response["error"] = std::move(error);
+        write_lsp_message(m_output, response);
+        }
+
+    //------------------------------------------------------
+    void lsp_server::initialize(const json_value& params)
+        {
+        if (params["rootUri"].is_string())
+            {
+            m_workspace_folder = uri_to_path(params["rootUri"].as_string());
+            }
+        else if (params["rootPath"].is_string())
+            {
+            std::wstring rootPath;
+            if (decode_utf8(params["rootPath"].as_string(), rootPath))
+                {
+                m_workspace_folder = rootPath;
+                }
+            }
+        }
+
+    //------------------------------------------------------
+    void lsp_server::analyze_workspace()
+        {
+        if (!m_workspace_folder.empty() && std::filesystem::is_directory(m_workspace_folder))
+            {
+            const auto excludedInfo = get_paths_files_to_exclude(m_workspace_folder, {});
+            for (auto& file : get_files_to_analyze(m_workspace_folder, excludedInfo.m_excludedPaths,
+                                                   excludedInfo.m_excludedFiles))
+                {
+                file = file.lexically_normal();
+                if (std::find(m_files.cbegin(), m_files.cend(), file) == m_files.cend())
+                    {
+                    m_files.push_back(std::move(file));
+                    }
+                }
+            }
+
+        m_analyzer.get_log_report().clear();
+        m_analyzer.analyze(
+            m_files, []([[maybe_unused]] const size_t) {},
+            []([[maybe_unused]] const size_t, [[maybe_unused]] const std::filesystem::path&)
+            { return true; });
+
+        std::map<std::filesystem::path, std::vector<analysis_issue>> issues;
+        // files without issues need to be sent too, to clear their previous diagnostics
+        for (const auto& file : m_files)
+            {
+            issues.try_emplace(file);
+            }
+        m_analyzer.for_each_issue(
+            [&issues](const analysis_issue& issue)
+            {
+                if (!issue.m_file.empty())
+                    {
+                    issues[issue.m_file.lexically_normal()].push_back(issue);
+                    }
+            });
+        for (const auto& [file, fileIssues] : issues)
+            {
+            // a file is only read again if its issues' source code needs to be found
+            publish_diagnostics(file, fileIssues.empty() ? std::wstring{} : read_document(file),
+                                fileIssues);
+            }
+
+        // documents opened before the workspace was analyzed
+        analyze_pending_documents();
+        }
+
+    //------------------------------------------------------
+    void lsp_server::analyze_pending_documents()
+        {
+        for (const auto& closedDocument : m_closed_documents)
+            {
+            // documents outside of the workspace are only reviewed while they are open
+            const auto [workspaceEnd, documentEnd] =
+                std::mismatch(m_workspace_folder.begin(), m_workspace_folder.end(),
+                              closedDocument.begin(), closedDocument.end());
+            if (m_workspace_folder.empty() || workspaceEnd != m_workspace_folder.end())
+                {
+                std::erase(m_files, closedDocument);
+                }
+            // otherwise, its saved text is reviewed again
+            if (std::find(m_files.cbegin(), m_files.cend(), closedDocument) != m_files.cend())
+                {
+                analyze_document(closedDocument, read_document(closedDocument));
+                }
+            else
+                {
+                publish_diagnostics(closedDocument, std::wstring_view{}, {});
+                }
+            }
+        m_closed_documents.clear();
+
+        for (const auto& [filePath, text] : m_pending_documents)
+            {
+            analyze_document(filePath, text);
+            }
+        m_pending_documents.clear();
+        }
+
+    //------------------------------------------------------
+    void lsp_server::analyze_document(const std::filesystem::path& file, const std::wstring& text)
+        {
+        std::vector<analysis_issue> issues;
+        m_analyzer.analyze_document(file, text, [&issues](const analysis_issue& issue)
+                                    { issues.push_back(issue); });
+        publish_diagnostics(file, text, issues);
+        }
+
+    //------------------------------------------------------
+    std::wstring lsp_server::read_document(const std::filesystem::path& file) const
+        {
+        const mapped_file fileData(file);
+        if (!fileData.is_open())
+            {
+            return {};
+            }
+        return read_text(fileData.get_data(), m_analyzer.get_legacy_encoding()).m_text;
+        }
+
+    //------------------------------------------------------
+    void lsp_server::publish_diagnostics(const std::filesystem::path& file, std::wstring_view text,
+                                         const std::vector<analysis_issue>& issues)
+        {
+        // split the lines once, rather than searching for each issue's line
+        std::vector<std::wstring_view> lines;
+        while (!text.empty())
+            {
+            const size_t lineEnd{ std::min(text.find(L'\n'), text.length()) };
+            std::wstring_view line{ text.substr(0, lineEnd) };
+            if (!line.empty() && line.back() == L'\r')
+                {
+                line.remove_suffix(1);
+                }
+            lines.push_back(line);
+            text.remove_prefix(std::min(lineEnd + 1, text.length()));
+            }
+
+        json_value::array diagnostics;
+        for (const auto& issue : issues)
+            {
+            // positions are zero-indexed in LSP (unknown positions may be npos)
+            const size_t line{ (issue.m_line && issue.m_line.value() > 0 &&
+                                issue.m_line.value() != std::wstring::npos) ?
+                                   issue.m_line.value() - 1 :
+                                   0 };
+            const std::wstring_view lineText{ (line < lines.size()) ? lines[line] :
+                                                                      std::wstring_view{} };
+            json_value start{ json_value::object{} };
+            json_value end{ json_value::object{} };
+            if (issue.m_column && issue.m_column.value() > 0 &&
+                issue.m_column.value() != std::wstring::npos)
+                {
+                const size_t column{ std::min(issue.m_column.value() - 1, lineText.length()) };
+                const size_t startCharacter{ utf16_length(lineText.substr(0, column)) };
+                start["line"] = line;
+                start["character"] = startCharacter;
+                end["line"] = line;
+                end["character"] =
+                    startCharacter +
+                    utf16_length(lineText.substr(column, get_issue_length(lineText, column)));
+                }
+            // without a column, the issue is for the whole line
+            else
+                {
+                start["line"] = line;
+                start["character"] = 0;
+                end["line"] = line + 1;
+                end["character"] = 0;
+                }
+            json_value range{ json_value::object{} };
+            range["start"] = std::move(start);
+            range["end"] = std::move(end);
+
+            json_value diagnostic{ json_value::object{} };
+            diagnostic["range"] = std::move(range);
+            constexpr int WARNING_SEVERITY{ 2 };
+            diagnostic["severity"] = WARNING_SEVERITY;
+            diagnostic["code"] = encode_utf8(issue.m_warning_id);
+            diagnostic["source"] = "quneiform";
+            diagnostic["message"] = encode_utf8(
+                issue.m_value.empty() ? issue.m_explanation :
+                                        issue.m_explanation + L"\n" + issue.m_value);
+            diagnostics.push_back(std::move(diagnostic));
+            }
+
+        const std::string uri{ path_to_uri(file) };
+        json_value diagnosticsValue{ std::move(diagnostics) };
+        std::string diagnosticsText{ diagnosticsValue.dump() };
+        const auto previousDiagnostics = m_published_diagnostics.find(uri);
+        if (previousDiagnostics != m_published_diagnostics.cend() ?
+                previousDiagnostics->second == diagnosticsText :
+                diagnosticsText == "[]")
+            {
+            return;
+            }
+
+        json_value params{ json_value::object{} };
+        params["uri"] = uri;
+        params["diagnostics"] = std::move(diagnosticsValue);
+        json_value notification{ json_value::object{} };
+        notification["jsonrpc"] = "2.0";
+        notification["method"] = "textDocument/publishDiagnostics";
+        notification["params"] = std::move(params);
+        write_lsp_message(m_output, notification);
+        m_published_diagnostics.insert_or_assign(uri, std::move(diagnosticsText));
+        }
+    } // namespace i18n_check
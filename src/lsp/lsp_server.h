@@ -0,0 +1,143 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __QUNEIFORM_LSP_SERVER_H__
+#define __QUNEIFORM_LSP_SERVER_H__
+
+#include "../analyze.h"
+#include "json.h"
+#include "lsp_protocol.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <istream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace i18n_check
+    {
+    /** @brief Language Server Protocol server, which publishes the analyzers'
+            results as diagnostics.
+        @details The workspace is analyzed once when the client is initialized.
+            When a document is edited, only that document's (unsaved) text is analyzed
+            again, and its diagnostics are built directly from its results
+            (the rest of the workspace isn't reviewed again).\n
+            Edits are debounced, so that a document is not analyzed on every keystroke.\n
+            Diagnostics' ranges are measured from the document's source code, with columns
+            in UTF-16 code units.
+        @par Example:
+        @code
+         i18n_check::lsp_server server(std::cin, std::cout);
+         return server.run();
+        @endcode*/
+    class lsp_server
+        {
+      public:
+        /// @brief Constructor.
+        /// @param input The stream that messages from the client are read from.
+        /// @param output The stream that messages to the client are written to.
+        lsp_server(std::istream& input, std::ostream& output);
+        /// @private
+        lsp_server(const lsp_server&) = delete;
+        /// @private
+        lsp_server& operator=(const lsp_server&) = delete;
+
+        /// @brief Sets how long to wait after a document is edited before analyzing it.
+        /// @param delay The delay (the default is 300 milliseconds).
+        void set_debounce_delay(const std::chrono::milliseconds delay) noexcept
+            {
+            m_debounce_delay = delay;
+            }
+
+        /// @brief Processes messages until the client exits.
+        /// @returns The exit code for the server (@c 0 if the client requested a
+        ///     shutdown before exiting).
+        int run();
+
+      private:
+        /// @brief Handles a message from the client.
+        /// @returns @c false if the client requested to exit.
+        bool handle_message(const json_value& message);
+        /// @brief Sends a response to a request.
+        void send_response(const json_value& id, json_value result);
+        /// @brief Sends an error response to a request.
+        void send_error(const json_value& id, const int code, std::string message);
+        /// @brief Sets the workspace's folder from the client's initialization parameters.
+        void initialize(const json_value& params);
+        /// @brief Finds the files in the workspace and analyzes them.
+        void analyze_workspace();
+        /// @brief Analyzes the edited documents, and the saved text of closed documents.
+        void analyze_pending_documents();
+        /// @brief Analyzes a document's text by itself and sends its diagnostics.
+        void analyze_document(const std::filesystem::path& file, const std::wstring& text);
+        /// @returns The saved text of a file, or an empty string if it can't be read.
+        [[nodiscard]]
+        std::wstring read_document(const std::filesystem::path& file) const;
+        /// @brief Sends the diagnostics for a file, if they changed since they were last sent.
+        /// @param file The file.
+        /// @param text The file's text, which the diagnostics' ranges are measured from.
+        /// @param issues The file's issues.
+        void publish_diagnostics(const std::filesystem::path& file, std::wstring_view text,
+                                 const std::vector<analysis_issue>& issues);
+
+        std::istream& m_input;
+        std::ostream& m_output;
+
+        cpp_i18n_review m_cpp{ false };
+        rc_file_review m_rc{ false };
+        po_file_review m_po{ false };
+        csharp_i18n_review m_csharp{ false };
+        info_plist_file_review m_plist{ false };
+        batch_analyze m_analyzer{ &m_cpp, &m_rc, &m_po, &m_csharp, &m_plist };
+
+        std::filesystem::path m_workspace_folder;
+        std::vector<std::filesystem::path> m_files;
+        /// @brief The text of documents that were edited, but not analyzed yet.
+        std::map<std::filesystem::path, std::wstring> m_pending_documents;
+        /// @brief The documents that were closed, whose results need to be read from the file.
+        std::vector<std::filesystem::path> m_closed_documents;
+        /// @brief The last diagnostics sent for each file (as JSON),
+        ///     so that only the files whose diagnostics change are sent again.
+        std::map<std::string, std::string> m_published_diagnostics;
+        std::chrono::milliseconds m_debounce_delay{ 300 };
+        std::chrono::steady_clock::time_point m_last_edit;
+        bool m_shutdown_requested{ false };
+
+        /// @brief Messages read by the reader thread, waiting to be handled.
+        /// @details This is shared with the reader thread, as that thread may still be
+        ///     blocked on reading the input after the server is finished.
+        struct message_queue
+            {
+            std::mutex m_mutex;
+            std::condition_variable m_changed;
+            /// @brief The messages (an empty message is added when the input ends).
+            std::deque<std::optional<std::string>> m_messages;
+            };
+        std::shared_ptr<message_queue> m_message_queue{ std::make_shared<message_queue>() };
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__QUNEIFORM_LSP_SERVER_H__
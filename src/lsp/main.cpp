@@ -0,0 +1,40 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "lsp_server.h"
+#include <cstdlib>
+#include <iostream>
+#ifdef _WIN32
+    #include <fcntl.h>
+    #include <io.h>
+#endif
+
+//-------------------------------------------------
+int main()
+    {
+#ifdef _WIN32
+    // message lengths are in bytes, so don't let newlines be translated
+    _setmode(_fileno(stdin), _O_BINARY);
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    // stdout is only used for messages to the client; anything else should go to stderr
+    std::ios::sync_with_stdio(false);
+
+    i18n_check::lsp_server server(std::cin, std::cout);
+    const int exitCode{ server.run() };
+    // The reader thread may still be blocked on reading the input, so end the process
+    // without destroying the standard streams out from under it.
+    std::cout.flush();
+    std::cerr.flush();
+    std::_Exit(exitCode);
+    }
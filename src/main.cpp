@@ -13,8 +13,13 @@
 
 #include "analyze.h"
 #include "cxxopts/include/cxxopts.hpp"
+#include "file_watcher.h"
 #include "input.h"
+#include "report_writer.h"
+#include <algorithm>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <numeric>
 #include <sstream>
 
@@ -60,8 +65,29 @@ int main(int argc, char* argv[])
          cxxopts::value<bool>()->default_value("false"))
         ("i,ignore", "Folders and files to ignore (can be used multiple times)",
                                cxxopts::value<std::vector<std::string>>())
-        ("o,output", "The output report path (tab-delimited format)",
+        ("o,output", "The output report path (the format follows the extension: .csv "
+                     "writes RFC 4180 CSV, anything else is tab-delimited)",
          cxxopts::value<std::string>())
+        ("legacy-encoding", "The encoding to read files with if they are not Unicode "
+                            "(windows-1252, iso-8859-1, or iso-8859-15). (Default is windows-1252.)",
+         cxxopts::value<std::string>())
+        ("j,jobs", "The number of files to analyze at the same time. "
+                   "(Default is 0, which uses the number of processor cores.)",
+         cxxopts::value<int>())
+        ("cache", "Folder to cache each file's analysis in (e.g., .quneiform-cache), "
+                  "so that unchanged files are not analyzed again on later runs.",
+         cxxopts::value<std::string>())
+        ("diff", "A unified diff (e.g., from git diff) to limit the analysis to; only the files "
+                 "and lines that it changes are reviewed. Use - to read it from stdin. Paths in "
+                 "the diff are relative to the input folder; git's a/ and b/ prefixes are "
+                 "removed when the diff's headers show that they are being used.",
+         cxxopts::value<std::string>())
+        ("watch", "Keep running and re-analyze files whenever they are changed, "
+                  "writing the report again after each change (Linux only).",
+         cxxopts::value<bool>()->default_value("false"))
+        ("profile", "Print how long each check (and each phase of the analysis) took. "
+                    "Use --profile=json to print it as JSON.",
+         cxxopts::value<std::string>()->implicit_value("table"))
         ("q,quiet", "Only print errors and the final output",
          cxxopts::value<bool>()->default_value("false"))
         ("v,verbose", "Display debug information",
@@ -157,9 +183,65 @@ int main(int argc, char* argv[])
     const auto excludedInfo =
         i18n_check::get_paths_files_to_exclude(inputFolder, providedIgnoredPathsWidened);
 
-    // input folder
-    const auto filesToAnalyze = i18n_check::get_files_to_analyze(
-        inputFolder, excludedInfo.m_excludedPaths, excludedInfo.m_excludedFiles);
+    const bool watchFolder{ readBoolOption("watch", false) };
+    if (watchFolder && result.count("diff"))
+        {
+        std::wcout << L"--watch and --diff cannot be used together.\n";
+        return 0;
+        }
+
+    // per-check timings
+    const std::string profileFormat{ result.count("profile") ?
+                                         result["profile"].as<std::string>() :
+                                         std::string{} };
+    if (!profileFormat.empty() && profileFormat != "table" && profileFormat != "json")
+        {
+        std::wcout << L"Unknown format passed to --profile: "
+                   << i18n_string_util::lazy_string_to_wstring(profileFormat)
+                   << L" (use table or json).\n";
+        return 0;
+        }
+    if (!profileFormat.empty() && !i18n_check::check_profile::is_available())
+        {
+        std::wcout << L"Profiling is not available in this build "
+                      L"(rebuild with QUNEIFORM_PROFILING enabled).\n";
+        }
+
+    // lines changed by a patch (if only reviewing those)
+    i18n_check::changed_lines_map changedLines;
+    if (result.count("diff"))
+        {
+        const std::string diffPath{ result["diff"].as<std::string>() };
+        std::string diffText;
+        if (diffPath == "-")
+            {
+            diffText.assign(std::istreambuf_iterator<char>(std::cin),
+                            std::istreambuf_iterator<char>());
+            }
+        else
+            {
+            std::ifstream diffFile(fs::path{ diffPath, fs::path::native_format },
+                                   std::ios::in | std::ios::binary);
+            if (!diffFile.is_open())
+                {
+                std::wcout << L"Unable to open diff file: "
+                           << i18n_string_util::lazy_string_to_wstring(diffPath) << L"\n";
+                return 0;
+                }
+            diffText.assign(std::istreambuf_iterator<char>(diffFile),
+                            std::istreambuf_iterator<char>());
+            }
+        changedLines = i18n_check::read_unified_diff(
+            diffText, fs::is_directory(inputFolder) ? inputFolder : inputFolder.parent_path());
+        }
+
+    // input folder (or just the files changed by the patch)
+    auto filesToAnalyze =
+        result.count("diff") ?
+            i18n_check::get_files_to_analyze(changedLines, excludedInfo.m_excludedPaths,
+                                             excludedInfo.m_excludedFiles) :
+            i18n_check::get_files_to_analyze(inputFolder, excludedInfo.m_excludedPaths,
+                                             excludedInfo.m_excludedFiles);
 
     const auto setSourceParserInfo = [&readBoolOption, &readIntOption](auto& parser)
     {
@@ -492,6 +574,30 @@ int main(int argc, char* argv[])
 
     const bool isQuiet{ readBoolOption("quiet", false) };
     i18n_check::batch_analyze analyzer(&cpp, &rc, &po, &csharp, &infoPlist);
+    analyzer.set_jobs(static_cast<size_t>(std::max(readIntOption("jobs", 0), 0)));
+    if (result.count("cache"))
+        {
+        analyzer.set_cache_folder(
+            fs::path{ result["cache"].as<std::string>(), fs::path::native_format });
+        }
+    analyzer.set_changed_lines(std::move(changedLines));
+    // when watching, only the files that change will need to be analyzed again
+    analyzer.keep_results_resident(watchFolder);
+    analyzer.set_profiling(!profileFormat.empty() && i18n_check::check_profile::is_available());
+    if (result.count("legacy-encoding"))
+        {
+        const auto legacyEncoding = i18n_check::get_legacy_encoding_from_name(
+            result["legacy-encoding"].as<std::string>());
+        if (!legacyEncoding)
+            {
+            std::wcout << L"Unsupported legacy encoding: "
+                       << i18n_string_util::lazy_string_to_wstring(
+                              result["legacy-encoding"].as<std::string>())
+                       << L"\n";
+            return 0;
+            }
+        analyzer.set_legacy_encoding(legacyEncoding.value());
+        }
     analyzer.analyze(
         filesToAnalyze, [](const size_t) {},
         [&filesToAnalyze, isQuiet](const size_t currentFileIndex, const fs::path& file)
@@ -504,38 +610,48 @@ int main(int argc, char* argv[])
             return true;
         });
 
-    const std::wstringstream report = analyzer.format_results(readBoolOption("verbose", false));
+    const auto writeReport = [&result, &analyzer, &readBoolOption]()
+    {
+        // write the output to file (if requested)
+        if (result.count("output"))
+            {
+            const fs::path outPath{ result["output"].as<std::string>() };
+            std::ofstream ofs(outPath, std::ios::binary);
 
-    // write the output to file (if requested)
-    if (result.count("output"))
-        {
-        fs::path outPath{ result["output"].as<std::string>() };
-        std::ofstream ofs(outPath);
+            // stream the results report to the file in UTF-8, a row at a time
+            i18n_check::report_writer writer{
+                ofs, (string_util::stricmp(outPath.extension().wstring().c_str(), L".csv") == 0) ?
+                         i18n_check::report_format::csv :
+                         i18n_check::report_format::tab_delimited
+            };
+            std::wostream report{ &writer };
+            analyzer.format_results(report, readBoolOption("verbose", false));
+            report.flush();
+            }
+        // ...otherwise, send it to the console
+        else
+            {
+            analyzer.format_results(std::wcout, readBoolOption("verbose", false));
+            }
+    };
+    writeReport();
 
-        // write the results report in UTF-8
-        std::string utf8Str;
-        const auto resText = report.str();
-        if constexpr (sizeof(wchar_t) == sizeof(uint16_t))
+    const auto writeProfile = [&analyzer, &profileFormat]()
+    {
+        if (!analyzer.is_profiling())
             {
-            utf8::utf16to8(resText.cbegin(), resText.cend(), std::back_inserter(utf8Str));
+            return;
             }
-        else if constexpr (sizeof(wchar_t) == sizeof(uint32_t))
+        if (profileFormat == "json")
             {
-            utf8::utf32to8(resText.cbegin(), resText.cend(), std::back_inserter(utf8Str));
+            std::wcout << i18n_string_util::lazy_string_to_wstring(
+                analyzer.get_profile().format_json());
             }
-
-        if (outPath.extension().compare(L"csv") == 0)
+        else
             {
-            string_util::replace_all<std::string>(utf8Str, "\t", ",");
+            std::wcout << L"\n" << analyzer.get_profile().format_table();
             }
-
-        ofs << utf8Str;
-        }
-    // ...otherwise, send it to the console
-    else
-        {
-        std::wcout << report.str();
-        }
+    };
 
     if (!readBoolOption("quiet", false))
         {
@@ -558,6 +674,104 @@ int main(int argc, char* argv[])
 
         std::wcout << analyzer.format_summary(true).str();
         }
+    writeProfile();
+
+    if (watchFolder)
+        {
+        const fs::path watchedFolder{ fs::is_directory(inputFolder) ? inputFolder :
+                                                                      inputFolder.parent_path() };
+        try
+            {
+            i18n_check::file_watcher watcher(watchedFolder);
+            if (!isQuiet)
+                {
+                std::wcout << L"\nWatching " << watchedFolder
+                           << L" for changes (press Ctrl+C to stop)...\n";
+                }
+            std::wcout.flush();
+            while (true)
+                {
+                auto changedFiles = watcher.wait_for_changes(std::chrono::milliseconds{ 100 });
+                // if only analyzing one file, then ignore changes to the other files near it
+                if (!fs::is_directory(inputFolder))
+                    {
+                    std::erase_if(changedFiles, [&inputFolder](const fs::path& file)
+                                  { return file != inputFolder; });
+                    }
+                // a changed path is either an analyzed file or a (deleted) folder containing them
+                const auto isInPath = [](const fs::path& analyzedFile, const fs::path& changedPath)
+                {
+                    const auto [changedPathEnd, analyzedFileEnd] = std::mismatch(
+                        changedPath.begin(), changedPath.end(), analyzedFile.begin(),
+                        analyzedFile.end());
+                    return changedPathEnd == changedPath.end();
+                };
+                // changes to files that aren't being analyzed (e.g., build output)
+                // don't need a new report
+                std::erase_if(changedFiles,
+                              [&](const fs::path& file)
+                              {
+                                  return std::none_of(filesToAnalyze.cbegin(),
+                                                      filesToAnalyze.cend(),
+                                                      [&](const fs::path& analyzedFile)
+                                                      { return isInPath(analyzedFile, file); }) &&
+                                         !i18n_check::is_file_to_analyze(
+                                             file, excludedInfo.m_excludedPaths,
+                                             excludedInfo.m_excludedFiles);
+                              });
+                if (changedFiles.empty())
+                    {
+                    continue;
+                    }
+
+                const auto changeTime{ std::chrono::high_resolution_clock::now() };
+                analyzer.invalidate_files(changedFiles);
+                for (const auto& file : changedFiles)
+                    {
+                    // drop deleted files (and the files in deleted folders)...
+                    std::erase_if(filesToAnalyze,
+                                  [&](const fs::path& analyzedFile) {
+                                      return isInPath(analyzedFile, file) &&
+                                             !fs::exists(analyzedFile);
+                                  });
+                    // ...and add new ones
+                    if (std::find(filesToAnalyze.cbegin(), filesToAnalyze.cend(), file) ==
+                            filesToAnalyze.cend() &&
+                        i18n_check::is_file_to_analyze(file, excludedInfo.m_excludedPaths,
+                                                       excludedInfo.m_excludedFiles))
+                        {
+                        filesToAnalyze.push_back(file);
+                        }
+                    }
+
+                analyzer.get_log_report().clear();
+                analyzer.analyze(
+                    filesToAnalyze, [](const size_t) {},
+                    []([[maybe_unused]] const size_t, [[maybe_unused]] const fs::path&)
+                    { return true; });
+                writeReport();
+                writeProfile();
+
+                if (!isQuiet)
+                    {
+                    std::wcout << L"\nRe-analyzed "
+                               << (filesToAnalyze.size() - analyzer.get_resident_file_count())
+                               << L" changed file(s) in "
+                               << std::chrono::duration_cast<std::chrono::milliseconds>(
+                                      std::chrono::high_resolution_clock::now() - changeTime)
+                                      .count()
+                               << L" milliseconds.\n";
+                    }
+                // the report may be piped to another program that is waiting on it
+                std::wcout.flush();
+                }
+            }
+        catch (const std::exception& expt)
+            {
+            std::wcout << i18n_string_util::lazy_string_to_wstring(expt.what()) << L"\n";
+            return 1;
+            }
+        }
 
     return 0;
     }
@@ -0,0 +1,158 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "mapped_file.h"
+#include <fstream>
+#include <iterator>
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace i18n_check
+    {
+    //------------------------------------------------------
+    mapped_file::mapped_file(const std::filesystem::path& filePath)
+        {
+#ifdef _WIN32
+        HANDLE fileHandle =
+            ::CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                          nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+            {
+            return;
+            }
+        m_file_handle = fileHandle;
+        m_is_open = true;
+
+        LARGE_INTEGER fileSize{};
+        if (!::GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+            {
+            // empty files can't be mapped, but there is nothing to read anyway
+            close();
+            return;
+            }
+
+        m_mapping_handle = ::CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_mapping_handle != nullptr)
+            {
+            const void* view = ::MapViewOfFile(m_mapping_handle, FILE_MAP_READ, 0, 0, 0);
+            if (view != nullptr)
+                {
+                m_data = static_cast<const char*>(view);
+                m_size = static_cast<size_t>(fileSize.QuadPart);
+                m_is_mapped = true;
+                return;
+                }
+            }
+        close();
+        read_into_buffer(filePath);
+#else
+        const int fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+        if (fileDescriptor == -1)
+            {
+            return;
+            }
+        m_is_open = true;
+
+        struct stat fileInfo{};
+        if (::fstat(fileDescriptor, &fileInfo) == -1 || !S_ISREG(fileInfo.st_mode))
+            {
+            ::close(fileDescriptor);
+            read_into_buffer(filePath);
+            return;
+            }
+        // empty files can't be mapped, but there is nothing to read anyway
+        if (fileInfo.st_size == 0)
+            {
+            ::close(fileDescriptor);
+            return;
+            }
+
+        void* view = ::mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ,
+                            MAP_PRIVATE, fileDescriptor, 0);
+        // the mapping stays valid after the file is closed
+        ::close(fileDescriptor);
+        if (view == MAP_FAILED)
+            {
+            read_into_buffer(filePath);
+            return;
+            }
+        m_data = static_cast<const char*>(view);
+        m_size = static_cast<size_t>(fileInfo.st_size);
+        m_is_mapped = true;
+        // files are read front to back, so let the OS read ahead
+        ::posix_madvise(view, m_size, POSIX_MADV_SEQUENTIAL);
+#endif
+        }
+
+    //------------------------------------------------------
+    mapped_file::~mapped_file() { close(); }
+
+    //------------------------------------------------------
+    void mapped_file::read_into_buffer(const std::filesystem::path& filePath)
+        {
+        std::ifstream fs(filePath, std::ios::in | std::ios::binary);
+        if (!fs.is_open())
+            {
+            m_is_open = false;
+            return;
+            }
+        m_buffer.assign(std::istreambuf_iterator<char>(fs), std::istreambuf_iterator<char>());
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+        m_is_open = true;
+        }
+
+    //------------------------------------------------------
+    void mapped_file::close() noexcept
+        {
+#ifdef _WIN32
+        if (m_is_mapped)
+            {
+            ::UnmapViewOfFile(m_data);
+            }
+        if (m_mapping_handle != nullptr)
+            {
+            ::CloseHandle(m_mapping_handle);
+            m_mapping_handle = nullptr;
+            }
+        if (m_file_handle != nullptr)
+            {
+            ::CloseHandle(m_file_handle);
+            m_file_handle = nullptr;
+            }
+#else
+        if (m_is_mapped)
+            {
+            ::munmap(const_cast<char*>(m_data), m_size);
+            }
+#endif
+        if (m_is_mapped)
+            {
+            m_data = nullptr;
+            m_size = 0;
+            m_is_mapped = false;
+            }
+        }
+    } // namespace i18n_check
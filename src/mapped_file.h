@@ -0,0 +1,87 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __MAPPED_FILE_H__
+#define __MAPPED_FILE_H__
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace i18n_check
+    {
+    /** @brief Read-only view of a file's content, which is memory mapped
+            (when possible) so that it is only read once.
+        @details If the file can't be mapped (e.g., it is empty or on a filesystem
+            that doesn't support mapping), then it is read into a buffer instead.
+        @par Example:
+        @code
+         const i18n_check::mapped_file fileData(L"/home/user/src/main.cpp");
+         if (fileData.is_open())
+            {
+            const std::string_view content = fileData.get_data();
+            }
+        @endcode*/
+    class mapped_file
+        {
+      public:
+        /// @brief Constructor, which opens and maps the file.
+        /// @param filePath The file to open.
+        explicit mapped_file(const std::filesystem::path& filePath);
+        /// @private
+        mapped_file(const mapped_file&) = delete;
+        /// @private
+        mapped_file& operator=(const mapped_file&) = delete;
+        /// @private
+        ~mapped_file();
+
+        /// @returns @c true if the file was opened successfully.
+        [[nodiscard]]
+        bool is_open() const noexcept
+            {
+            return m_is_open;
+            }
+
+        /// @returns The (raw) content of the file.
+        [[nodiscard]]
+        std::string_view get_data() const noexcept
+            {
+            return { m_data, m_size };
+            }
+
+      private:
+        /// @brief Reads the file into a buffer, if it can't be mapped.
+        void read_into_buffer(const std::filesystem::path& filePath);
+        /// @brief Unmaps the file.
+        void close() noexcept;
+
+        const char* m_data{ nullptr };
+        size_t m_size{ 0 };
+        bool m_is_open{ false };
+        bool m_is_mapped{ false };
+#ifdef _WIN32
+        void* m_file_handle{ nullptr };
+        void* m_mapping_handle{ nullptr };
+#endif
+        std::string m_buffer;
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__MAPPED_FILE_H__
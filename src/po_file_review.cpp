@@ -11,6 +11,7 @@
  *   Blake Madden - initial implementation
  ********************************************************************************/
 #include "po_file_review.h"
+#include "results_cache.h"
 
 namespace i18n_check
     {
@@ -73,6 +74,8 @@ namespace i18n_check
             currentPos = newLinePos + 1;
             }
 
+        m_line_index.index(originalPoFileText);
+
         while (!poFileText.empty())
             {
             auto [entryFound, entry, entryPos] = read_po_catalog_entry(poFileText);
@@ -184,5 +187,14 @@ namespace i18n_check
                     pofs, std::vector<std::pair<translation_issue, std::wstring>>{},
                     get_line_and_column(currentPos, originalPoFileText).first, comment }));
             }
+
+        m_line_index.clear();
+        }
+
+    //------------------------------------------------
+    uint64_t po_file_review::get_settings_hash() const
+        {
+        return combine_cache_hash(translation_catalog_review::get_settings_hash(),
+                                  m_reviewFuzzy ? "fuzzy" : "no-fuzzy");
         }
     } // namespace i18n_check
@@ -40,6 +40,13 @@ namespace i18n_check
             @param fileName The (optional) name of source file being analyzed.*/
         void operator()(std::wstring_view poFileText, const std::filesystem::path& fileName) final;
 
+        /// @returns A copy of the analyzer's settings (without any results).
+        [[nodiscard]]
+        std::unique_ptr<i18n_review> clone() const final
+            {
+            return clone_settings(*this);
+            }
+
         /// @brief Whether fuzzy translations should be reviewed.
         /// @param enable @c true to review fuzzy translation entries; @c false to ignore them.
         /// @note It is recommended that this be false, as fuzzy translations are generally
@@ -54,6 +61,10 @@ namespace i18n_check
             return m_reviewFuzzy;
             }
 
+        /// @returns A hash of the settings that affect the results from `operator()`.
+        [[nodiscard]]
+        uint64_t get_settings_hash() const final;
+
         /** @brief Finalizes the review process after all files have been loaded.
             @details Reviews the catalogs in all loaded PO files.
             @param resetCallback Callback function to tell the progress system in @c callback
@@ -25,6 +25,8 @@ namespace i18n_check
             return;
             }
 
+        m_line_index.index(rcFileText);
+
         if (static_cast<bool>(get_style() & check_l10n_strings))
             {
             /* This regex:
@@ -90,119 +92,77 @@ namespace i18n_check
                     {
                     tableEntry.second.pop_back();
                     }
-                if (is_untranslatable_string(tableEntry.second, false).first)
-                    {
-                    m_unsafe_localizable_strings.emplace_back(
-                        tableEntry.second,
-                        string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                std::wstring{}, std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
-                    }
-                else
-                    {
-                    m_localizable_strings.emplace_back(
-                        tableEntry.second,
-                        string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                std::wstring{}, std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
-                    }
+                // the entry is stored once, and added to the categories of any issues in it
+                const size_t entryIndex = add_result(
+                    classify_untranslatable_string(tableEntry.second, false).first ?
+                        result_category::unsafe_localizable :
+                        result_category::localizable,
+                    tableEntry.second,
+                    string_info::usage_info(string_info::usage_info::usage_type::orphan,
+                                            std::wstring{}, std::wstring{}, std::wstring{}),
+                    m_file_name,
+                    std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
+                                   std::wstring::npos));
 
                 if (m_review_styles & check_l10n_contains_url)
                     {
-                    std::wsmatch results;
-                    if (std::regex_search(tableEntry.second, results, m_url_email_regex))
+                    I18N_PROFILE_SCOPE(get_profile(), check_l10n_contains_url, 1);
+                    if (m_url_email_regex.search(tableEntry.second))
                         {
-                        m_localizable_strings_with_urls.emplace_back(
-                            tableEntry.second,
-                            string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                    std::wstring{}, std::wstring{}, std::wstring{}),
-                            m_file_name,
-                            std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                           std::wstring::npos));
+                        add_result_to_category(result_category::with_urls, entryIndex);
                         }
                     }
 
                 if (m_review_styles & check_l10n_contains_excessive_nonl10n_content)
                     {
+                    I18N_PROFILE_SCOPE(get_profile(),
+                                       check_l10n_contains_excessive_nonl10n_content, 1);
                     const auto [isunTranslatable, translatableContentLength] =
-                        is_untranslatable_string(tableEntry.second, false);
+                        classify_untranslatable_string(tableEntry.second, false);
                     if ((m_review_styles & check_l10n_contains_excessive_nonl10n_content) &&
                         !isunTranslatable &&
                         tableEntry.second.length() > (translatableContentLength * 3))
                         {
-                        m_localizable_strings_with_unlocalizable_content.emplace_back(
-                            tableEntry.second,
-                            string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                    std::wstring{}, std::wstring{}, std::wstring{}),
-                            m_file_name,
-                            std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                           std::wstring::npos));
+                        add_result_to_category(result_category::with_unlocalizable_content,
+                                               entryIndex);
                         }
                     }
 
                 if (m_review_styles & check_multipart_strings &&
-                    is_string_multipart(tableEntry.second))
+                    I18N_PROFILED(get_profile(), check_multipart_strings,
+                                  is_string_multipart(tableEntry.second)))
                     {
-                    m_multipart_strings.emplace_back(
-                        tableEntry.second,
-                        string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                std::wstring{}, std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                    add_result_to_category(result_category::multipart, entryIndex);
                     }
 
                 if (m_review_styles & check_pluaralization &&
-                    is_string_faux_plural(tableEntry.second))
+                    I18N_PROFILED(get_profile(), check_pluaralization,
+                                  is_string_faux_plural(tableEntry.second)))
                     {
-                    m_faux_plural_strings.emplace_back(
-                        tableEntry.second,
-                        string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                std::wstring{}, std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                    add_result_to_category(result_category::faux_plural, entryIndex);
                     }
 
                 if (m_review_styles & check_articles_proceeding_placeholder &&
-                    (is_string_article_issue(tableEntry.second) ||
-                     is_string_pronoun(tableEntry.second)))
+                    I18N_PROFILED(get_profile(), check_articles_proceeding_placeholder,
+                                  (is_string_article_issue(tableEntry.second) ||
+                                   is_string_pronoun(tableEntry.second))))
                     {
-                    m_article_issue_strings.emplace_back(
-                        tableEntry.second,
-                        string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                std::wstring{}, std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                    add_result_to_category(result_category::article_issue, entryIndex);
                     }
 
                 if ((m_review_styles & check_l10n_concatenated_strings) &&
-                    has_surrounding_spaces(tableEntry.second))
+                    I18N_PROFILED(get_profile(), check_l10n_concatenated_strings,
+                                  has_surrounding_spaces(tableEntry.second)))
                     {
-                    m_localizable_strings_being_concatenated.emplace_back(
-                        tableEntry.second,
-                        string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                std::wstring{}, std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                    add_result_to_category(result_category::being_concatenated, entryIndex);
                     }
 
                 if ((m_review_styles & check_halfwidth) &&
-                    !load_matches(tableEntry.second, m_halfwidth_range_regex).empty())
+                    I18N_PROFILED(get_profile(), check_halfwidth,
+                                  !load_matches(tableEntry.second, m_halfwidth_range_regex)
+                                       .empty()))
                     {
-                    m_localizable_strings_with_halfwidths.emplace_back(
-                        tableEntry.second,
-                        string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                std::wstring{}, std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                    add_result_to_category(result_category::with_halfwidths, entryIndex);
                     }
                 }
             }
@@ -210,6 +170,7 @@ namespace i18n_check
         // read the fonts
         if (static_cast<bool>(get_style() & check_fonts))
             {
+            I18N_PROFILE_SCOPE(get_profile(), check_fonts, 1);
             std::vector<std::pair<size_t, std::wstring>> fontEntries;
             const std::wregex fontRE{ L"\\bFONT[ ]*([0-9]+),[ ]*\"([^\"]*)\"" };
 
@@ -302,5 +263,7 @@ namespace i18n_check
                     }
                 }
             }
+
+        m_line_index.clear();
         }
     } // namespace i18n_check
@@ -64,6 +64,57 @@ namespace i18n_check
             m_nonSystemFontNames.clear();
             }
 
+        /// @returns A copy of the analyzer's settings (without any results).
+        [[nodiscard]]
+        std::unique_ptr<i18n_review> clone() const final
+            {
+            return clone_settings(*this);
+            }
+
+        /// @brief Moves the results from other RC file analyzers into this one.
+        /// @param analyzers The analyzers to move results from.
+        /// @param fileIndex Function returning a file's position in the original list of files.
+        void merge_results(const std::vector<i18n_review*>& analyzers,
+                           const file_index_callback& fileIndex) final
+            {
+            i18n_review::merge_results(analyzers, fileIndex);
+            const auto stringFilePath = [](const string_info& str) -> const std::filesystem::path&
+            { return str.m_file_name; };
+            merge_results_by_file(&rc_file_review::m_badFontSizes, analyzers, fileIndex,
+                                  stringFilePath);
+            merge_results_by_file(&rc_file_review::m_nonSystemFontNames, analyzers, fileIndex,
+                                  stringFilePath);
+            }
+
+        /// @brief Removes the results that are not on the lines set by set_changed_lines().
+        void remove_results_outside_changed_lines() final
+            {
+            i18n_review::remove_results_outside_changed_lines();
+            remove_strings_outside_changed_lines(m_badFontSizes);
+            remove_strings_outside_changed_lines(m_nonSystemFontNames);
+            }
+
+        /// @brief Writes the results (from `operator()`) to a stream, so that they can be cached.
+        /// @param stream The stream to write to.
+        /// @param filePath The file that was reviewed.
+        void write_results(std::ostream& stream,
+                           const std::filesystem::path& filePath) const final
+            {
+            i18n_review::write_results(stream, filePath);
+            write_string_infos(stream, m_badFontSizes, filePath);
+            write_string_infos(stream, m_nonSystemFontNames, filePath);
+            }
+
+        /// @brief Reads results written by write_results() and adds them to this analyzer.
+        /// @param stream The stream to read from.
+        /// @param filePath The file that the results are for.
+        void read_results(std::istream& stream, const std::filesystem::path& filePath) final
+            {
+            i18n_review::read_results(stream, filePath);
+            read_string_infos(stream, m_badFontSizes, filePath);
+            read_string_infos(stream, m_nonSystemFontNames, filePath);
+            }
+
       private:
         std::vector<string_info> m_badFontSizes;
         std::vector<string_info> m_nonSystemFontNames;
@@ -0,0 +1,902 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "regex_pattern.h"
+#include <algorithm>
+#include <limits>
+#include <locale>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace i18n_check
+    {
+    /// @brief A parsed piece of a regular expression.
+    struct regex_node
+        {
+        enum class node_type
+            {
+            empty,
+            char_set,
+            concatenation,
+            alternation,
+            repetition,
+            assertion
+            };
+
+        node_type m_type{ node_type::empty };
+        // for char_set
+        size_t m_set{ 0 };
+        // for assertion
+        linear_regex::opcode m_assertion{ linear_regex::opcode::match };
+        std::vector<regex_node> m_children;
+        // for repetition (npos for no maximum)
+        size_t m_min{ 0 };
+        size_t m_max{ 0 };
+        };
+
+    /// @brief Parses a pattern and compiles it into a linear_regex's program.
+    class linear_regex_compiler
+        {
+      public:
+        linear_regex_compiler(linear_regex& regex, const std::wstring_view pattern,
+                              const bool caseInsensitive)
+            : m_regex(regex), m_pattern(pattern), m_case_insensitive(caseInsensitive),
+              m_program_start(regex.m_program.size())
+            {
+            }
+
+        /// @brief Compiles the pattern, appending it to the regex's program.
+        /// @param patternIndex The index of the pattern, which its match instruction reports.
+        void compile(const size_t patternIndex)
+            {
+            const regex_node root{ parse_alternation() };
+            if (m_position < m_pattern.length())
+                {
+                throw std::invalid_argument("Unbalanced parenthesis in regular expression.");
+                }
+            emit(root);
+            push(linear_regex::opcode::match, patternIndex);
+            }
+
+      private:
+        // Expanding counted repetitions (e.g., "{1,256}") can make a large program,
+        // which isn't worth simulating.
+        constexpr static size_t MAX_PROGRAM_SIZE{ 4096 };
+
+        struct set_builder
+            {
+            std::vector<std::pair<wchar_t, wchar_t>> m_ranges;
+            std::vector<std::regex_traits<wchar_t>::char_class_type> m_classes;
+            std::vector<std::regex_traits<wchar_t>::char_class_type> m_negated_classes;
+            bool m_negated{ false };
+            };
+
+        [[nodiscard]]
+        bool is_at_end() const noexcept
+            {
+            return m_position >= m_pattern.length();
+            }
+
+        [[nodiscard]]
+        wchar_t peek() const
+            {
+            if (is_at_end())
+                {
+                throw std::invalid_argument("Unexpected end of regular expression.");
+                }
+            return m_pattern[m_position];
+            }
+
+        wchar_t next()
+            {
+            const wchar_t chr{ peek() };
+            ++m_position;
+            return chr;
+            }
+
+        [[nodiscard]]
+        regex_node make_set(const set_builder& builder)
+            {
+            linear_regex::char_set chSet;
+            chSet.m_ranges = builder.m_ranges;
+            chSet.m_classes = builder.m_classes;
+            chSet.m_negated_classes = builder.m_negated_classes;
+            chSet.m_negated = builder.m_negated;
+            chSet.m_case_insensitive = m_case_insensitive;
+            for (size_t chr = 0; chr < chSet.m_ascii.size(); ++chr)
+                {
+                chSet.m_ascii[chr] = m_regex.is_in_set_slow(chSet, static_cast<wchar_t>(chr));
+                }
+            m_regex.m_sets.push_back(std::move(chSet));
+
+            regex_node node;
+            node.m_type = regex_node::node_type::char_set;
+            node.m_set = m_regex.m_sets.size() - 1;
+            return node;
+            }
+
+        [[nodiscard]]
+        regex_node make_char(const wchar_t chr)
+            {
+            set_builder builder;
+            builder.m_ranges.emplace_back(chr, chr);
+            return make_set(builder);
+            }
+
+        [[nodiscard]]
+        static regex_node make_assertion(const linear_regex::opcode op)
+            {
+            regex_node node;
+            node.m_type = regex_node::node_type::assertion;
+            node.m_assertion = op;
+            return node;
+            }
+
+        [[nodiscard]]
+        std::regex_traits<wchar_t>::char_class_type lookup_class(const std::wstring_view name)
+            {
+            const auto charClass =
+                m_regex.m_traits.lookup_classname(name.cbegin(), name.cend(), m_case_insensitive);
+            if (charClass == std::regex_traits<wchar_t>::char_class_type{})
+                {
+                throw std::invalid_argument("Unknown character class in regular expression.");
+                }
+            return charClass;
+            }
+
+        [[nodiscard]]
+        size_t read_hex(const size_t digitCount)
+            {
+            size_t value{ 0 };
+            for (size_t i = 0; i < digitCount; ++i)
+                {
+                const wchar_t chr{ next() };
+                value *= 16;
+                if (chr >= L'0' && chr <= L'9')
+                    {
+                    value += static_cast<size_t>(chr - L'0');
+                    }
+                else if (chr >= L'a' && chr <= L'f')
+                    {
+                    value += static_cast<size_t>(chr - L'a') + 10;
+                    }
+                else if (chr >= L'A' && chr <= L'F')
+                    {
+                    value += static_cast<size_t>(chr - L'A') + 10;
+                    }
+                else
+                    {
+                    throw std::invalid_argument("Invalid hex escape in regular expression.");
+                    }
+                }
+            return value;
+            }
+
+        /// @returns The character from an escape (after the '\'), or adds the class
+        ///     that it represents to @c builder and returns @c std::nullopt.
+        [[nodiscard]]
+        std::optional<wchar_t> read_escape(set_builder& builder, const bool inBrackets)
+            {
+            const wchar_t chr{ next() };
+            if (chr == L'd' || chr == L's' || chr == L'w')
+                {
+                builder.m_classes.push_back(lookup_class(std::wstring_view{ &chr, 1 }));
+                return std::nullopt;
+                }
+            if (chr == L'D' || chr == L'S' || chr == L'W')
+                {
+                const wchar_t lower{ static_cast<wchar_t>(chr - L'A' + L'a') };
+                builder.m_negated_classes.push_back(lookup_class(std::wstring_view{ &lower, 1 }));
+                return std::nullopt;
+                }
+            if (chr == L'n')
+                {
+                return L'\n';
+                }
+            if (chr == L't')
+                {
+                return L'\t';
+                }
+            if (chr == L'r')
+                {
+                return L'\r';
+                }
+            if (chr == L'f')
+                {
+                return L'\f';
+                }
+            if (chr == L'v')
+                {
+                return L'\v';
+                }
+            if (chr == L'0')
+                {
+                return L'\0';
+                }
+            if (chr == L'b' && inBrackets)
+                {
+                return L'\b';
+                }
+            if (chr == L'u')
+                {
+                return static_cast<wchar_t>(read_hex(4));
+                }
+            if (chr == L'x')
+                {
+                return static_cast<wchar_t>(read_hex(2));
+                }
+            if (chr == L'c')
+                {
+                return static_cast<wchar_t>(next() % 32);
+                }
+            // backreferences and unknown escapes aren't supported
+            if ((chr >= L'0' && chr <= L'9') || (chr >= L'a' && chr <= L'z') ||
+                (chr >= L'A' && chr <= L'Z'))
+                {
+                throw std::invalid_argument("Unsupported escape in regular expression.");
+                }
+            return chr;
+            }
+
+        [[nodiscard]]
+        regex_node parse_bracket()
+            {
+            set_builder builder;
+            if (!is_at_end() && peek() == L'^')
+                {
+                builder.m_negated = true;
+                ++m_position;
+                }
+            while (peek() != L']')
+                {
+                std::optional<wchar_t> first;
+                if (m_pattern.substr(m_position).starts_with(L"[:"))
+                    {
+                    const size_t nameEnd{ m_pattern.find(L":]", m_position + 2) };
+                    if (nameEnd == std::wstring_view::npos)
+                        {
+                        throw std::invalid_argument("Unterminated character class.");
+                        }
+                    builder.m_classes.push_back(
+                        lookup_class(m_pattern.substr(m_position + 2, nameEnd - m_position - 2)));
+                    m_position = nameEnd + 2;
+                    continue;
+                    }
+                if (m_pattern.substr(m_position).starts_with(L"[.") ||
+                    m_pattern.substr(m_position).starts_with(L"[="))
+                    {
+                    throw std::invalid_argument("Unsupported bracket expression.");
+                    }
+                if (peek() == L'\\')
+                    {
+                    ++m_position;
+                    first = read_escape(builder, true);
+                    if (!first)
+                        {
+                        continue;
+                        }
+                    }
+                else
+                    {
+                    first = next();
+                    }
+                // a range (unless the '-' is at the end of the brackets)
+                if (peek() == L'-' && m_position + 1 < m_pattern.length() &&
+                    m_pattern[m_position + 1] != L']')
+                    {
+                    ++m_position;
+                    std::optional<wchar_t> last;
+                    if (peek() == L'\\')
+                        {
+                        ++m_position;
+                        last = read_escape(builder, true);
+                        if (!last)
+                            {
+                            throw std::invalid_argument("Invalid range in regular expression.");
+                            }
+                        }
+                    else
+                        {
+                        last = next();
+                        }
+                    if (*last < *first)
+                        {
+                        throw std::invalid_argument("Invalid range in regular expression.");
+                        }
+                    builder.m_ranges.emplace_back(*first, *last);
+                    }
+                else
+                    {
+                    builder.m_ranges.emplace_back(*first, *first);
+                    }
+                }
+            ++m_position;
+            return make_set(builder);
+            }
+
+        [[nodiscard]]
+        regex_node parse_atom()
+            {
+            const wchar_t chr{ next() };
+            if (chr == L'(')
+                {
+                if (!is_at_end() && peek() == L'?')
+                    {
+                    ++m_position;
+                    if (next() != L':')
+                        {
+                        throw std::invalid_argument("Lookaheads are not supported.");
+                        }
+                    }
+                regex_node group{ parse_alternation() };
+                if (next() != L')')
+                    {
+                    throw std::invalid_argument("Unbalanced parenthesis in regular expression.");
+                    }
+                return group;
+                }
+            if (chr == L'[')
+                {
+                return parse_bracket();
+                }
+            if (chr == L'.')
+                {
+                set_builder builder;
+                builder.m_negated = true;
+                builder.m_ranges.emplace_back(L'\n', L'\n');
+                builder.m_ranges.emplace_back(L'\r', L'\r');
+                return make_set(builder);
+                }
+            if (chr == L'^')
+                {
+                return make_assertion(linear_regex::opcode::line_start);
+                }
+            if (chr == L'$')
+                {
+                return make_assertion(linear_regex::opcode::line_end);
+                }
+            if (chr == L'\\')
+                {
+                if (peek() == L'b' || peek() == L'B')
+                    {
+                    return make_assertion((next() == L'b') ?
+                                              linear_regex::opcode::word_boundary :
+                                              linear_regex::opcode::not_word_boundary);
+                    }
+                set_builder builder;
+                const auto escaped{ read_escape(builder, false) };
+                return escaped ? make_char(*escaped) : make_set(builder);
+                }
+            if (chr == L'*' || chr == L'+' || chr == L'?' || chr == L'{')
+                {
+                throw std::invalid_argument("Quantifier without an expression to repeat.");
+                }
+            return make_char(chr);
+            }
+
+        [[nodiscard]]
+        size_t read_number()
+            {
+            if (is_at_end() || peek() < L'0' || peek() > L'9')
+                {
+                throw std::invalid_argument("Invalid quantifier in regular expression.");
+                }
+            size_t value{ 0 };
+            while (!is_at_end() && peek() >= L'0' && peek() <= L'9')
+                {
+                value = (value * 10) + static_cast<size_t>(next() - L'0');
+                if (value > MAX_PROGRAM_SIZE)
+                    {
+                    throw std::invalid_argument("Quantifier is too large.");
+                    }
+                }
+            return value;
+            }
+
+        [[nodiscard]]
+        regex_node parse_quantified()
+            {
+            regex_node atom{ parse_atom() };
+            if (is_at_end())
+                {
+                return atom;
+                }
+            size_t minCount{ 0 };
+            size_t maxCount{ 0 };
+            const wchar_t chr{ peek() };
+            if (chr == L'*')
+                {
+                maxCount = std::wstring_view::npos;
+                }
+            else if (chr == L'+')
+                {
+                minCount = 1;
+                maxCount = std::wstring_view::npos;
+                }
+            else if (chr == L'?')
+                {
+                maxCount = 1;
+                }
+            else if (chr == L'{')
+                {
+                ++m_position;
+                minCount = read_number();
+                maxCount = minCount;
+                if (peek() == L',')
+                    {
+                    ++m_position;
+                    maxCount = (peek() == L'}') ? std::wstring_view::npos : read_number();
+                    }
+                if (peek() != L'}' || maxCount < minCount)
+                    {
+                    throw std::invalid_argument("Invalid quantifier in regular expression.");
+                    }
+                }
+            else
+                {
+                return atom;
+                }
+            ++m_position;
+            if (atom.m_type == regex_node::node_type::assertion)
+                {
+                throw std::invalid_argument("Assertions cannot be repeated.");
+                }
+            // lazy and greedy quantifiers find the same matches
+            // (just different sub-matches), so that doesn't matter here
+            if (!is_at_end() && peek() == L'?')
+                {
+                ++m_position;
+                }
+
+            regex_node repetition;
+            repetition.m_type = regex_node::node_type::repetition;
+            repetition.m_min = minCount;
+            repetition.m_max = maxCount;
+            repetition.m_children.push_back(std::move(atom));
+            return repetition;
+            }
+
+        [[nodiscard]]
+        regex_node parse_concatenation()
+            {
+            regex_node node;
+            node.m_type = regex_node::node_type::concatenation;
+            while (!is_at_end() && peek() != L'|' && peek() != L')')
+                {
+                node.m_children.push_back(parse_quantified());
+                }
+            return node;
+            }
+
+        [[nodiscard]]
+        regex_node parse_alternation()
+            {
+            regex_node node;
+            node.m_type = regex_node::node_type::alternation;
+            node.m_children.push_back(parse_concatenation());
+            while (!is_at_end() && peek() == L'|')
+                {
+                ++m_position;
+                node.m_children.push_back(parse_concatenation());
+                }
+            return (node.m_children.size() == 1) ? std::move(node.m_children.front()) : node;
+            }
+
+        size_t push(const linear_regex::opcode op, const size_t first = 0,
+                    const size_t second = 0)
+            {
+            if (m_regex.m_program.size() - m_program_start >= MAX_PROGRAM_SIZE)
+                {
+                throw std::invalid_argument("Regular expression is too large.");
+                }
+            m_regex.m_program.push_back(linear_regex::instruction{
+                op, static_cast<uint32_t>(first), static_cast<uint32_t>(second) });
+            return m_regex.m_program.size() - 1;
+            }
+
+        [[nodiscard]]
+        size_t get_next_instruction() const noexcept
+            {
+            return m_regex.m_program.size();
+            }
+
+        void emit(const regex_node& node)
+            {
+            if (node.m_type == regex_node::node_type::char_set)
+                {
+                push(linear_regex::opcode::character_set, node.m_set);
+                }
+            else if (node.m_type == regex_node::node_type::assertion)
+                {
+                push(node.m_assertion);
+                }
+            else if (node.m_type == regex_node::node_type::concatenation)
+                {
+                for (const auto& child : node.m_children)
+                    {
+                    emit(child);
+                    }
+                }
+            else if (node.m_type == regex_node::node_type::alternation)
+                {
+                std::vector<size_t> jumpsToEnd;
+                for (size_t i = 0; i + 1 < node.m_children.size(); ++i)
+                    {
+                    const size_t split{ push(linear_regex::opcode::split,
+                                             get_next_instruction() + 1) };
+                    emit(node.m_children[i]);
+                    jumpsToEnd.push_back(push(linear_regex::opcode::jump));
+                    m_regex.m_program[split].m_second =
+                        static_cast<uint32_t>(get_next_instruction());
+                    }
+                emit(node.m_children.back());
+                for (const auto jump : jumpsToEnd)
+                    {
+                    m_regex.m_program[jump].m_first = static_cast<uint32_t>(get_next_instruction());
+                    }
+                }
+            else if (node.m_type == regex_node::node_type::repetition)
+                {
+                for (size_t i = 0; i < node.m_min; ++i)
+                    {
+                    emit(node.m_children.front());
+                    }
+                if (node.m_max == std::wstring_view::npos)
+                    {
+                    const size_t split{ push(linear_regex::opcode::split,
+                                             get_next_instruction() + 1) };
+                    emit(node.m_children.front());
+                    push(linear_regex::opcode::jump, split);
+                    m_regex.m_program[split].m_second =
+                        static_cast<uint32_t>(get_next_instruction());
+                    }
+                else
+                    {
+                    // each optional repetition can skip to the end
+                    std::vector<size_t> splits;
+                    for (size_t i = node.m_min; i < node.m_max; ++i)
+                        {
+                        splits.push_back(
+                            push(linear_regex::opcode::split, get_next_instruction() + 1));
+                        emit(node.m_children.front());
+                        }
+                    for (const auto split : splits)
+                        {
+                        m_regex.m_program[split].m_second =
+                            static_cast<uint32_t>(get_next_instruction());
+                        }
+                    }
+                }
+            }
+
+        linear_regex& m_regex;
+        std::wstring_view m_pattern;
+        bool m_case_insensitive{ false };
+        size_t m_program_start{ 0 };
+        size_t m_position{ 0 };
+        };
+
+    //--------------------------------------------------
+    linear_regex::linear_regex()
+        {
+        const std::wstring_view wordClassName{ L"w" };
+        m_word_class = m_traits.lookup_classname(wordClassName.cbegin(), wordClassName.cend());
+        for (size_t chr = 0; chr < m_ascii_word_chars.size(); ++chr)
+            {
+            m_ascii_word_chars[chr] = m_traits.isctype(static_cast<wchar_t>(chr), m_word_class);
+            }
+        }
+
+    //--------------------------------------------------
+    void linear_regex::add_pattern(std::wstring_view pattern, const bool caseInsensitive)
+        {
+        const size_t programSize{ m_program.size() };
+        const size_t setCount{ m_sets.size() };
+        try
+            {
+            linear_regex_compiler(*this, pattern, caseInsensitive).compile(m_starts.size());
+            }
+        catch (...)
+            {
+            m_program.resize(programSize);
+            m_sets.resize(setCount);
+            throw;
+            }
+        m_starts.push_back(static_cast<uint32_t>(programSize));
+        }
+
+    //--------------------------------------------------
+    bool linear_regex::is_in_set_slow(const char_set& chSet, const wchar_t chr) const
+        {
+        const auto isInRanges = [&chSet](const wchar_t value)
+        {
+            return std::any_of(chSet.m_ranges.cbegin(), chSet.m_ranges.cend(),
+                               [value](const auto& range)
+                               { return (value >= range.first && value <= range.second); });
+        };
+
+        bool isInSet{ isInRanges(chr) };
+        if (!isInSet && chSet.m_case_insensitive)
+            {
+            const auto& ctype = std::use_facet<std::ctype<wchar_t>>(m_traits.getloc());
+            isInSet = isInRanges(ctype.tolower(chr)) || isInRanges(ctype.toupper(chr));
+            }
+        if (!isInSet)
+            {
+            isInSet = std::any_of(chSet.m_classes.cbegin(), chSet.m_classes.cend(),
+                                  [this, chr](const auto& charClass)
+                                  { return m_traits.isctype(chr, charClass); }) ||
+                      std::any_of(chSet.m_negated_classes.cbegin(),
+                                  chSet.m_negated_classes.cend(),
+                                  [this, chr](const auto& charClass)
+                                  { return !m_traits.isctype(chr, charClass); });
+            }
+        return (isInSet != chSet.m_negated);
+        }
+
+    //--------------------------------------------------
+    bool linear_regex::is_in_set(const char_set& chSet, const wchar_t chr) const
+        {
+        const auto value{ static_cast<std::make_unsigned_t<wchar_t>>(chr) };
+        return (value < chSet.m_ascii.size()) ? chSet.m_ascii[value] :
+                                                is_in_set_slow(chSet, chr);
+        }
+
+    //--------------------------------------------------
+    bool linear_regex::is_word_char(const std::wstring_view text, const size_t position) const
+        {
+        if (position >= text.length())
+            {
+            return false;
+            }
+        const auto value{ static_cast<std::make_unsigned_t<wchar_t>>(text[position]) };
+        return (value < m_ascii_word_chars.size()) ?
+                   m_ascii_word_chars[value] :
+                   m_traits.isctype(text[position], m_word_class);
+        }
+
+    //--------------------------------------------------
+    bool linear_regex::is_assertion_true(const opcode op, const std::wstring_view text,
+                                         const size_t position) const
+        {
+        if (op == opcode::line_start)
+            {
+            return (position == 0);
+            }
+        if (op == opcode::line_end)
+            {
+            return (position == text.length());
+            }
+        const bool isBoundary{ (position > 0 && is_word_char(text, position - 1)) !=
+                               is_word_char(text, position) };
+        return (op == opcode::word_boundary) ? isBoundary : !isBoundary;
+        }
+
+    //--------------------------------------------------
+    void linear_regex::add_state(std::vector<uint32_t>& states, std::vector<uint32_t>& marks,
+                                 const uint32_t generation, std::vector<uint32_t>& stack,
+                                 uint32_t state, const std::wstring_view text,
+                                 const size_t position) const
+        {
+        // follow the empty transitions (splits, jumps, and assertions) to the states
+        // that read a character (or are a match)
+        stack.clear();
+        stack.push_back(state);
+        while (!stack.empty())
+            {
+            state = stack.back();
+            stack.pop_back();
+            if (marks[state] == generation)
+                {
+                continue;
+                }
+            marks[state] = generation;
+            const instruction& instr{ m_program[state] };
+            if (instr.m_op == opcode::split)
+                {
+                stack.push_back(instr.m_second);
+                stack.push_back(instr.m_first);
+                }
+            else if (instr.m_op == opcode::jump)
+                {
+                stack.push_back(instr.m_first);
+                }
+            else if (instr.m_op == opcode::character_set || instr.m_op == opcode::match)
+                {
+                states.push_back(state);
+                }
+            else if (is_assertion_true(instr.m_op, text, position))
+                {
+                stack.push_back(state + 1);
+                }
+            }
+        }
+
+    //--------------------------------------------------
+    size_t linear_regex::run(const std::wstring_view text, const bool searching) const
+        {
+        // scratch buffers, reused between calls (and shared by all patterns) on each thread
+        thread_local std::vector<uint32_t> currentStates;
+        thread_local std::vector<uint32_t> nextStates;
+        thread_local std::vector<uint32_t> marks;
+        thread_local std::vector<uint32_t> stack;
+        thread_local uint32_t generation{ 0 };
+
+        if (marks.size() < m_program.size())
+            {
+            marks.resize(m_program.size(), 0);
+            }
+        const auto nextGeneration = []()
+        {
+            if (generation == std::numeric_limits<uint32_t>::max())
+                {
+                std::fill(marks.begin(), marks.end(), 0);
+                generation = 0;
+                }
+            return ++generation;
+        };
+
+        currentStates.clear();
+        const uint32_t startGeneration{ nextGeneration() };
+        for (const auto start : m_starts)
+            {
+            add_state(currentStates, marks, startGeneration, stack, start, text, 0);
+            }
+        for (size_t position = 0; /* in loop*/; ++position)
+            {
+            if (searching || position == text.length())
+                {
+                // if more than one pattern matched, then use the first one
+                size_t matchedPattern{ std::wstring_view::npos };
+                for (const auto state : currentStates)
+                    {
+                    if (m_program[state].m_op == opcode::match)
+                        {
+                        if (searching)
+                            {
+                            return m_program[state].m_first;
+                            }
+                        matchedPattern = std::min<size_t>(matchedPattern, m_program[state].m_first);
+                        }
+                    }
+                if (matchedPattern != std::wstring_view::npos)
+                    {
+                    return matchedPattern;
+                    }
+                }
+            if (position == text.length() || (currentStates.empty() && !searching))
+                {
+                return std::wstring_view::npos;
+                }
+
+            const uint32_t stepGeneration{ nextGeneration() };
+            nextStates.clear();
+            for (const auto state : currentStates)
+                {
+                const instruction& instr{ m_program[state] };
+                if (instr.m_op == opcode::character_set &&
+                    is_in_set(m_sets[instr.m_first], text[position]))
+                    {
+                    add_state(nextStates, marks, stepGeneration, stack, state + 1, text,
+                              position + 1);
+                    }
+                }
+            // a search can also start a match at any position
+            if (searching)
+                {
+                for (const auto start : m_starts)
+                    {
+                    add_state(nextStates, marks, stepGeneration, stack, start, text,
+                              position + 1);
+                    }
+                }
+            std::swap(currentStates, nextStates);
+            }
+        }
+
+    //--------------------------------------------------
+    static bool is_linear_syntax(const std::regex_constants::syntax_option_type flags) noexcept
+        {
+        return ((flags & ~(std::regex_constants::ECMAScript | std::regex_constants::icase)) ==
+                std::regex_constants::syntax_option_type{});
+        }
+
+    //--------------------------------------------------
+    std::variant<linear_regex, std::wregex>
+    regex_pattern::make_backend(const std::wstring& pattern,
+                                const std::regex_constants::syntax_option_type flags)
+        {
+        if (is_linear_syntax(flags))
+            {
+            try
+                {
+                return linear_regex{ pattern, static_cast<bool>(
+                                                  flags & std::regex_constants::icase) };
+                }
+            catch (const std::invalid_argument&)
+                {
+                // not supported, so fall back to the standard library
+                }
+            }
+        return std::wregex{ pattern, flags };
+        }
+
+    //--------------------------------------------------
+    regex_set::regex_set(std::initializer_list<regex_source> patterns)
+        {
+        m_patterns.reserve(patterns.size());
+        for (const auto& pattern : patterns)
+            {
+            add(pattern);
+            }
+        }
+
+    //--------------------------------------------------
+    void regex_set::add(regex_source pattern)
+        {
+        bool isLinear{ false };
+        if (is_linear_syntax(pattern.m_flags))
+            {
+            try
+                {
+                m_linear.add_pattern(pattern.m_pattern,
+                                     static_cast<bool>(pattern.m_flags &
+                                                       std::regex_constants::icase));
+                isLinear = true;
+                }
+            catch (const std::invalid_argument&)
+                {
+                // not supported, so fall back to the standard library
+                }
+            }
+        if (isLinear)
+            {
+            m_linear_indices.push_back(m_patterns.size());
+            }
+        else
+            {
+            m_fallbacks.emplace_back(m_patterns.size(),
+                                     std::wregex{ pattern.m_pattern, pattern.m_flags });
+            }
+        m_patterns.push_back(std::move(pattern));
+        }
+
+    //--------------------------------------------------
+    std::optional<size_t> regex_set::find_match(const std::wstring_view text) const
+        {
+        size_t matchedPattern{ std::wstring_view::npos };
+        if (const auto linearMatch = m_linear.find_match(text))
+            {
+            matchedPattern = m_linear_indices[*linearMatch];
+            }
+        // only the fallbacks before the linear match (if any) need to be checked
+        for (const auto& [index, regex] : m_fallbacks)
+            {
+            if (index >= matchedPattern)
+                {
+                break;
+                }
+            if (std::regex_match(text.cbegin(), text.cend(), regex))
+                {
+                matchedPattern = index;
+                break;
+                }
+            }
+        if (matchedPattern == std::wstring_view::npos)
+            {
+            return std::nullopt;
+            }
+        return matchedPattern;
+        }
+    } // namespace i18n_check
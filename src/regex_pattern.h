@@ -0,0 +1,334 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __REGEX_PATTERN_H__
+#define __REGEX_PATTERN_H__
+
+#include <bitset>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace i18n_check
+    {
+    /** @brief A regular expression that is matched by simulating its NFA
+            (rather than backtracking), so matching is linear to the text's length.
+        @details This supports the subset of ECMAScript syntax used by our built-in patterns:
+            literals, escapes (including @c \\d, @c \\s, @c \\w, and @c \\uXXXX),
+            bracket expressions (including POSIX classes like @c [:alnum:]), @c .,
+            groups, alternation, greedy and lazy quantifiers, and the @c ^, @c $,
+            @c \\b, and @c \\B assertions.\n
+            Character classes and case folding are done with the same @c std::regex_traits
+            as @c std::wregex, so results are the same as @c std::regex_match()
+            and @c std::regex_search().\n
+            Because it only tracks whether a match exists, it does not support sub-matches,
+            backreferences, or lookaheads; use @c std::wregex for those.\n
+            Multiple patterns can be added, which are then all matched in a single pass.
+        @note This is thread safe (after construction).*/
+    class linear_regex
+        {
+      public:
+        /// @brief Constructor, which creates an empty regex (which matches nothing)
+        ///     that patterns can be added to.
+        linear_regex();
+
+        /** @brief Constructor, which compiles the pattern.
+            @param pattern The pattern.
+            @param caseInsensitive @c true to ignore case when matching.
+            @throws std::invalid_argument If the pattern uses syntax that is not supported
+                (or is malformed).*/
+        explicit linear_regex(std::wstring_view pattern, const bool caseInsensitive = false)
+            : linear_regex()
+            {
+            add_pattern(pattern, caseInsensitive);
+            }
+
+        /** @brief Adds a pattern, which will be matched along with the previously added ones.
+            @param pattern The pattern.
+            @param caseInsensitive @c true to ignore case when matching this pattern.
+            @throws std::invalid_argument If the pattern uses syntax that is not supported
+                (or is malformed). If this happens, then the regex is left unchanged.*/
+        void add_pattern(std::wstring_view pattern, const bool caseInsensitive = false);
+
+        /// @returns The number of patterns.
+        [[nodiscard]]
+        size_t get_pattern_count() const noexcept
+            {
+            return m_starts.size();
+            }
+
+        /// @returns @c true if the whole text matches any of the patterns
+        ///     (like @c std::regex_match()).
+        /// @param text The text to review.
+        [[nodiscard]]
+        bool matches(const std::wstring_view text) const
+            {
+            return (run(text, false) != std::wstring_view::npos);
+            }
+
+        /// @returns The index of the first pattern (in the order they were added)
+        ///     that matches the whole text, or @c std::nullopt if none match.
+        /// @param text The text to review.
+        [[nodiscard]]
+        std::optional<size_t> find_match(const std::wstring_view text) const
+            {
+            const size_t pattern{ run(text, false) };
+            return (pattern != std::wstring_view::npos) ? std::optional<size_t>{ pattern } :
+                                                          std::nullopt;
+            }
+
+        /// @returns @c true if any of the patterns match anywhere in the text
+        ///     (like @c std::regex_search()).
+        /// @param text The text to review.
+        [[nodiscard]]
+        bool search(const std::wstring_view text) const
+            {
+            return (run(text, true) != std::wstring_view::npos);
+            }
+
+        /// @private
+        enum class opcode : uint8_t
+            {
+            character_set,
+            split,
+            jump,
+            line_start,
+            line_end,
+            word_boundary,
+            not_word_boundary,
+            match
+            };
+
+        /// @private
+        struct instruction
+            {
+            opcode m_op{ opcode::match };
+            // the character set (for character_set), the first branch (for jump and split),
+            // or the pattern (for match)
+            uint32_t m_first{ 0 };
+            // the second branch (for split)
+            uint32_t m_second{ 0 };
+            };
+
+        /// @private
+        struct char_set
+            {
+            // fully resolved (including negation and case folding) for 7-bit characters
+            std::bitset<128> m_ascii;
+            // the rest are for characters outside of 7-bit ASCII
+            std::vector<std::pair<wchar_t, wchar_t>> m_ranges;
+            std::vector<std::regex_traits<wchar_t>::char_class_type> m_classes;
+            std::vector<std::regex_traits<wchar_t>::char_class_type> m_negated_classes;
+            bool m_negated{ false };
+            bool m_case_insensitive{ false };
+            };
+
+      private:
+        /// @returns The index of the pattern that matched (for a search, the first one found;
+        ///     otherwise, the first one added), or @c npos if none did.
+        [[nodiscard]]
+        size_t run(const std::wstring_view text, const bool searching) const;
+
+        [[nodiscard]]
+        bool is_in_set(const char_set& chSet, const wchar_t chr) const;
+
+        [[nodiscard]]
+        bool is_in_set_slow(const char_set& chSet, const wchar_t chr) const;
+
+        [[nodiscard]]
+        bool is_word_char(const std::wstring_view text, const size_t position) const;
+
+        [[nodiscard]]
+        bool is_assertion_true(const opcode op, const std::wstring_view text,
+                               const size_t position) const;
+
+        void add_state(std::vector<uint32_t>& states, std::vector<uint32_t>& marks,
+                       const uint32_t generation, std::vector<uint32_t>& stack, uint32_t state,
+                       const std::wstring_view text, const size_t position) const;
+
+        friend class linear_regex_compiler;
+
+        std::regex_traits<wchar_t> m_traits;
+        std::regex_traits<wchar_t>::char_class_type m_word_class{};
+        std::bitset<128> m_ascii_word_chars;
+        std::vector<char_set> m_sets;
+        std::vector<instruction> m_program;
+        // where each pattern's instructions start
+        std::vector<uint32_t> m_starts;
+        };
+
+    /** @brief A regular expression, which is matched by the fastest backend that supports it.
+        @details Patterns that linear_regex supports are matched with that; anything else
+            (including patterns supplied by the client) falls back to @c std::wregex.\n
+            This is meant for patterns that are only checked for whether they match; use
+            @c std::wregex directly if the sub-matches are needed.*/
+    class regex_pattern
+        {
+      public:
+        /** @brief Constructor.
+            @param pattern The pattern.
+            @param flags The syntax flags. If anything other than @c ECMAScript and @c icase
+                are used, then @c std::wregex is used as the backend.
+            @throws std::regex_error If the pattern is malformed.*/
+        explicit regex_pattern(std::wstring pattern,
+                               const std::regex_constants::syntax_option_type flags =
+                                   std::regex_constants::ECMAScript)
+            : m_pattern(std::move(pattern)), m_flags(flags),
+              m_regex(make_backend(m_pattern, m_flags))
+            {
+            }
+
+        /// @brief Constructor, which uses a @c std::wregex as the backend.
+        /// @param regex The regular expression.
+        explicit regex_pattern(std::wregex regex) : m_regex(std::move(regex)) {}
+
+        /// @returns @c true if the whole text matches the pattern.
+        /// @param text The text to review.
+        [[nodiscard]]
+        bool matches(const std::wstring_view text) const
+            {
+            if (const auto* linearRegex = std::get_if<linear_regex>(&m_regex))
+                {
+                return linearRegex->matches(text);
+                }
+            return std::regex_match(text.cbegin(), text.cend(), std::get<std::wregex>(m_regex));
+            }
+
+        /// @returns @c true if the pattern matches anywhere in the text.
+        /// @param text The text to review.
+        [[nodiscard]]
+        bool search(const std::wstring_view text) const
+            {
+            if (const auto* linearRegex = std::get_if<linear_regex>(&m_regex))
+                {
+                return linearRegex->search(text);
+                }
+            return std::regex_search(text.cbegin(), text.cend(), std::get<std::wregex>(m_regex));
+            }
+
+        /// @returns @c true if the pattern is matched with linear_regex
+        ///     (rather than @c std::wregex).
+        [[nodiscard]]
+        bool is_linear() const noexcept
+            {
+            return std::holds_alternative<linear_regex>(m_regex);
+            }
+
+        /// @returns The pattern (empty if constructed from a @c std::wregex).
+        [[nodiscard]]
+        const std::wstring& get_pattern() const noexcept { return m_pattern; }
+
+        /// @returns The syntax flags.
+        [[nodiscard]]
+        std::regex_constants::syntax_option_type get_flags() const noexcept
+            {
+            return m_flags;
+            }
+
+      private:
+        [[nodiscard]]
+        static std::variant<linear_regex, std::wregex>
+        make_backend(const std::wstring& pattern,
+                     const std::regex_constants::syntax_option_type flags);
+
+        std::wstring m_pattern;
+        std::regex_constants::syntax_option_type m_flags{ std::regex_constants::ECMAScript };
+        std::variant<linear_regex, std::wregex> m_regex;
+        };
+
+    /// @brief A regular expression's pattern and syntax flags.
+    struct regex_source
+        {
+        /// @brief Constructor.
+        /// @param pattern The pattern.
+        /// @param flags The syntax flags.
+        regex_source(std::wstring pattern, const std::regex_constants::syntax_option_type flags =
+                                               std::regex_constants::ECMAScript)
+            : m_pattern(std::move(pattern)), m_flags(flags)
+            {
+            }
+
+        /// @brief The pattern.
+        std::wstring m_pattern;
+        /// @brief The syntax flags.
+        std::regex_constants::syntax_option_type m_flags{ std::regex_constants::ECMAScript };
+        };
+
+    /** @brief A list of regular expressions that a text is matched against,
+            to see which one (if any) matches it.
+        @details The patterns that linear_regex supports are combined and matched in a single
+            pass over the text, rather than one pass per pattern; the rest are matched
+            with @c std::wregex.*/
+    class regex_set
+        {
+      public:
+        /// @private
+        regex_set() = default;
+
+        /// @brief Constructor.
+        /// @param patterns The patterns.
+        /// @throws std::regex_error If a pattern is malformed.
+        regex_set(std::initializer_list<regex_source> patterns);
+
+        /// @brief Adds a pattern.
+        /// @param pattern The pattern.
+        /// @throws std::regex_error If the pattern is malformed.
+        void add(regex_source pattern);
+
+        /// @returns The index of the first pattern (in the order they were added)
+        ///     that matches the whole text, or @c std::nullopt if none match.
+        /// @param text The text to review.
+        [[nodiscard]]
+        std::optional<size_t> find_match(const std::wstring_view text) const;
+
+        /// @returns A pattern.
+        /// @param index The index of the pattern.
+        [[nodiscard]]
+        const regex_source& get_pattern(const size_t index) const { return m_patterns[index]; }
+
+        /// @returns The number of patterns.
+        [[nodiscard]]
+        size_t size() const noexcept { return m_patterns.size(); }
+
+        /// @returns @c true if there are no patterns.
+        [[nodiscard]]
+        bool empty() const noexcept { return m_patterns.empty(); }
+
+        /// @returns The number of patterns that are matched with linear_regex.
+        [[nodiscard]]
+        size_t get_linear_count() const noexcept { return m_linear_indices.size(); }
+
+      private:
+        std::vector<regex_source> m_patterns;
+        // the patterns that linear_regex supports, combined into one
+        linear_regex m_linear;
+        // the index into m_patterns for each of m_linear's patterns
+        std::vector<size_t> m_linear_indices;
+        // the patterns that it doesn't support (along with their index into m_patterns)
+        std::vector<std::pair<size_t, std::wregex>> m_fallbacks;
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__REGEX_PATTERN_H__
@@ -0,0 +1,179 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "report_writer.h"
+#include "text_decode.h"
+#include <algorithm>
+#include <vector>
+
+namespace i18n_check
+    {
+    // The report used to be written in text mode, so keep the platform's line endings
+    // now that the output is binary.
+#ifdef _WIN32
+    constexpr std::string_view REPORT_NEWLINE{ "\r\n" };
+#else
+    constexpr std::string_view REPORT_NEWLINE{ "\n" };
+#endif
+
+    //--------------------------------------------------
+    /// @brief Appends a column to a CSV row, quoting it if it was quoted in the
+    ///     tab-delimited report or if it contains anything that CSV requires to be quoted.
+    /// @param csvRow The CSV row to append to.
+    /// @param column The column from the tab-delimited report.
+    /// @param isPath @c true if the column is a (quoted) file path, whose quotes
+    ///     escape backslashes and quotes with a backslash.
+    static void append_csv_column(std::wstring& csvRow, std::wstring_view column,
+                                  const bool isPath)
+        {
+        const bool isQuoted{ column.length() >= 2 && column.front() == L'"' &&
+                             column.back() == L'"' };
+        if (isQuoted)
+            {
+            column = column.substr(1, column.length() - 2);
+            }
+        if (!isQuoted && column.find_first_of(L",\"\r\n") == std::wstring_view::npos)
+            {
+            csvRow.append(column);
+            return;
+            }
+
+        csvRow += L'"';
+        for (size_t i = 0; i < column.length(); ++i)
+            {
+            if (isPath && isQuoted && column[i] == L'\\' && i + 1 < column.length())
+                {
+                ++i;
+                }
+            if (column[i] == L'"')
+                {
+                csvRow += L'"';
+                }
+            csvRow += column[i];
+            }
+        csvRow += L'"';
+        }
+
+    //--------------------------------------------------
+    std::wstring report_writer::to_csv_row(std::wstring_view row)
+        {
+        // File, Line, Column, Value, Explanation, and Warning ID.
+        // The explanation is the only column after the value that could contain a tab,
+        // so it is everything in front of the warning ID (the last column).
+        constexpr size_t COLUMN_COUNT{ 6 };
+        const size_t rowLength{ row.length() };
+        std::vector<std::wstring_view> columns;
+        columns.reserve(COLUMN_COUNT);
+        const auto splitColumn = [&row, &columns]()
+        {
+            const size_t tabPos{ row.find(L'\t') };
+            columns.push_back(row.substr(0, tabPos));
+            row.remove_prefix(tabPos + 1);
+        };
+        if (static_cast<size_t>(std::count(row.cbegin(), row.cend(), L'\t')) >= COLUMN_COUNT - 1)
+            {
+            while (columns.size() < COLUMN_COUNT - 2)
+                {
+                splitColumn();
+                }
+            const size_t explanationEnd{ row.rfind(L'\t') };
+            columns.push_back(row.substr(0, explanationEnd));
+            row.remove_prefix(explanationEnd + 1);
+            }
+        // (not a full row, so just split it on its tabs)
+        else
+            {
+            while (row.find(L'\t') != std::wstring_view::npos)
+                {
+                splitColumn();
+                }
+            }
+        columns.push_back(row);
+
+        std::wstring csvRow;
+        csvRow.reserve(rowLength + (columns.size() * 2));
+        for (size_t i = 0; i < columns.size(); ++i)
+            {
+            if (i > 0)
+                {
+                csvRow += L',';
+                }
+            append_csv_column(csvRow, columns[i], i == 0);
+            }
+        return csvRow;
+        }
+
+    //--------------------------------------------------
+    report_writer::int_type report_writer::overflow(int_type ch)
+        {
+        if (traits_type::eq_int_type(ch, traits_type::eof()))
+            {
+            return traits_type::not_eof(ch);
+            }
+        const char_type character{ traits_type::to_char_type(ch) };
+        if (character == L'\n')
+            {
+            end_row();
+            }
+        else
+            {
+            m_row += character;
+            }
+        return m_output ? ch : traits_type::eof();
+        }
+
+    //--------------------------------------------------
+    std::streamsize report_writer::xsputn(const char_type* text, std::streamsize count)
+        {
+        std::wstring_view remainingText{ text, static_cast<size_t>(count) };
+        for (size_t newLine = remainingText.find(L'\n'); newLine != std::wstring_view::npos;
+             newLine = remainingText.find(L'\n'))
+            {
+            m_row.append(remainingText.substr(0, newLine));
+            end_row();
+            remainingText.remove_prefix(newLine + 1);
+            }
+        m_row.append(remainingText);
+        return m_output ? count : 0;
+        }
+
+    //--------------------------------------------------
+    int report_writer::sync()
+        {
+        // a partial row is held until the rest of it is written
+        m_output.flush();
+        return m_output ? 0 : -1;
+        }
+
+    //--------------------------------------------------
+    void report_writer::end_row()
+        {
+        write_row();
+        m_output.write(REPORT_NEWLINE.data(),
+                       static_cast<std::streamsize>(REPORT_NEWLINE.length()));
+        }
+
+    //--------------------------------------------------
+    void report_writer::write_row()
+        {
+        if (m_row.empty())
+            {
+            return;
+            }
+        const std::string utf8Row{ (m_format == report_format::csv) ?
+                                       encode_utf8(to_csv_row(m_row)) :
+                                       encode_utf8(m_row) };
+        m_output.write(utf8Row.data(), static_cast<std::streamsize>(utf8Row.length()));
+        m_row.clear();
+        }
+    } // namespace i18n_check
@@ -0,0 +1,104 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __REPORT_WRITER_H__
+#define __REPORT_WRITER_H__
+
+#include <cstdint>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+
+namespace i18n_check
+    {
+    /// @brief The file formats that a report can be written as.
+    enum class report_format : uint8_t
+        {
+        /// @brief Tab-delimited text (the format that batch_analyze::format_results() writes).
+        tab_delimited,
+        /// @brief Comma-separated values (RFC 4180).
+        csv
+        };
+
+    /** @brief A stream buffer that writes the tab-delimited report from
+            batch_analyze::format_results() to a (byte) output stream as UTF-8,
+            one row at a time.
+        @details Only the row being written is kept in memory, so the memory used does not
+            grow with the number of issues in the report.\n
+            If writing CSV, each row is split into its columns and rewritten with
+            CSV quoting. The quotes around the file, value, and explanation columns
+            in the tab-delimited report are replaced with CSV quotes (with any quotes
+            inside of them doubled), and the file path's escaped backslashes are unescaped.
+        @note The output stream should be opened in binary mode, so that the UTF-8 text
+            is written as-is. Rows are ended with the platform's newline (CRLF on Windows),
+            as the report was when it was written in text mode.
+        @par Example:
+        @code
+         std::ofstream ofs(outPath, std::ios::binary);
+         report_writer writer{ ofs, report_format::csv };
+         std::wostream report{ &writer };
+         analyzer.format_results(report);
+         report.flush();
+        @endcode*/
+    class report_writer final : public std::wstreambuf
+        {
+      public:
+        /// @brief Constructor.
+        /// @param output The stream to write the UTF-8 report to.
+        /// @param format The format to write the report as.
+        report_writer(std::ostream& output, const report_format format)
+            : m_output(output), m_format(format)
+            {
+            }
+
+        /// @private
+        report_writer(const report_writer&) = delete;
+        /// @private
+        report_writer& operator=(const report_writer&) = delete;
+
+        /// @brief Writes the last row (if it wasn't ended with a newline).
+        ~report_writer() override { write_row(); }
+
+        /** @returns A row from the tab-delimited report, converted to CSV.
+            @param row The row (without its newline).*/
+        [[nodiscard]]
+        static std::wstring to_csv_row(std::wstring_view row);
+
+      protected:
+        /// @private
+        int_type overflow(int_type ch) override;
+        /// @private
+        std::streamsize xsputn(const char_type* text, std::streamsize count) override;
+        /// @private
+        int sync() override;
+
+      private:
+        /// @brief Writes the current row to the output (and clears it).
+        void write_row();
+        /// @brief Writes the current row and a newline (CRLF on Windows) to the output.
+        void end_row();
+
+        std::ostream& m_output;
+        report_format m_format{ report_format::tab_delimited };
+        std::wstring m_row;
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__REPORT_WRITER_H__
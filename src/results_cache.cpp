@@ -0,0 +1,201 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "results_cache.h"
+#include "text_decode.h"
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+
+namespace i18n_check
+    {
+    //------------------------------------------------------
+    void write_cache_value(std::ostream& stream, const uint64_t value)
+        {
+        std::array<char, sizeof(uint64_t)> bytes{};
+        for (size_t i = 0; i < bytes.size(); ++i)
+            {
+            bytes[i] = static_cast<char>((value >> (i * 8)) & 0xFF);
+            }
+        stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        }
+
+    //------------------------------------------------------
+    uint64_t read_cache_value(std::istream& stream)
+        {
+        std::array<char, sizeof(uint64_t)> bytes{};
+        if (!stream.read(bytes.data(), static_cast<std::streamsize>(bytes.size())))
+            {
+            throw std::runtime_error("Cached results are truncated.");
+            }
+        uint64_t value{ 0 };
+        for (size_t i = 0; i < bytes.size(); ++i)
+            {
+            value |= static_cast<uint64_t>(static_cast<unsigned char>(bytes[i])) << (i * 8);
+            }
+        return value;
+        }
+
+    //------------------------------------------------------
+    void write_cache_string(std::ostream& stream, std::wstring_view str)
+        {
+        const std::string utf8Str{ encode_utf8(str) };
+        write_cache_value(stream, utf8Str.length());
+        stream.write(utf8Str.data(), static_cast<std::streamsize>(utf8Str.length()));
+        }
+
+    //------------------------------------------------------
+    std::wstring read_cache_string(std::istream& stream)
+        {
+        const uint64_t length{ read_cache_value(stream) };
+        std::string utf8Str;
+        // read in blocks, so that a corrupt length doesn't try to allocate a huge string
+        constexpr uint64_t BLOCK_SIZE{ 4'096 };
+        while (utf8Str.length() < length)
+            {
+            const auto blockLength{ static_cast<size_t>(
+                std::min<uint64_t>(BLOCK_SIZE, length - utf8Str.length())) };
+            const size_t previousLength{ utf8Str.length() };
+            utf8Str.resize(previousLength + blockLength);
+            if (!stream.read(std::next(utf8Str.data(), static_cast<ptrdiff_t>(previousLength)),
+                             static_cast<std::streamsize>(blockLength)))
+                {
+                throw std::runtime_error("Cached results are truncated.");
+                }
+            }
+        std::wstring str;
+        if (!decode_utf8(utf8Str, str))
+            {
+            throw std::runtime_error("Cached results contain a malformed string.");
+            }
+        return str;
+        }
+
+    //------------------------------------------------------
+    uint64_t combine_cache_hash(uint64_t hash, std::string_view data) noexcept
+        {
+        constexpr uint64_t FNV_PRIME{ 1'099'511'628'211ULL };
+        for (const char chr : data)
+            {
+            hash ^= static_cast<unsigned char>(chr);
+            hash *= FNV_PRIME;
+            }
+        return hash;
+        }
+
+    //------------------------------------------------------
+    results_cache::results_cache(std::filesystem::path cacheFolder, const uint64_t settingsHash)
+        : m_cache_folder(std::move(cacheFolder)),
+          // entries from a different version of the cache's format are never looked up
+          m_settings_hash(combine_cache_hash(settingsHash, FORMAT_VERSION))
+        {
+        // if this fails, then entries will just fail to be written later
+        std::error_code ec;
+        std::filesystem::create_directories(m_cache_folder, ec);
+        }
+
+    //------------------------------------------------------
+    std::filesystem::path results_cache::get_entry_path(const file_review_type fileType,
+                                                        const uint64_t contentHash) const
+        {
+        constexpr std::wstring_view HEX_DIGITS{ L"0123456789abcdef" };
+        const auto toHex = [&HEX_DIGITS](uint64_t value)
+        {
+            std::wstring hexValue(16, L'0');
+            for (auto hexDigit = hexValue.rbegin(); hexDigit != hexValue.rend(); ++hexDigit)
+                {
+                *hexDigit = HEX_DIGITS[value & 0xF];
+                value >>= 4;
+                }
+            return hexValue;
+        };
+
+        return m_cache_folder / (toHex(contentHash) + L"-" + toHex(m_settings_hash) + L"-" +
+                                 std::to_wstring(static_cast<int>(fileType)) + L".bin");
+        }
+
+    //------------------------------------------------------
+    std::optional<std::string> results_cache::load(const file_review_type fileType,
+                                                   const uint64_t contentHash) const
+        {
+        std::ifstream entryFile(get_entry_path(fileType, contentHash),
+                                std::ios::in | std::ios::binary);
+        if (!entryFile.is_open())
+            {
+            return std::nullopt;
+            }
+        std::string results{ std::istreambuf_iterator<char>(entryFile),
+                             std::istreambuf_iterator<char>() };
+        // verify the entry's header, and that its content hasn't been corrupted
+        // (e.g., from a write that was interrupted)
+        if (entryFile.bad() || results.length() < ENTRY_HEADER_SIZE ||
+            !std::string_view{ results }.starts_with(ENTRY_SIGNATURE))
+            {
+            return std::nullopt;
+            }
+        std::istringstream headerStream(
+            results.substr(ENTRY_SIGNATURE.length(), sizeof(uint64_t)));
+        const uint64_t resultsHash{ read_cache_value(headerStream) };
+        results.erase(0, ENTRY_HEADER_SIZE);
+        if (resultsHash != hash_content(results))
+            {
+            return std::nullopt;
+            }
+        return results;
+        }
+
+    //------------------------------------------------------
+    void results_cache::store(const file_review_type fileType, const uint64_t contentHash,
+                              std::string_view results) const
+        {
+        const std::filesystem::path entryPath{ get_entry_path(fileType, contentHash) };
+        // identical files on different threads may be writing the same entry,
+        // so each thread writes to its own temporary file
+        std::filesystem::path tempPath{ entryPath };
+        tempPath += L"." +
+                    std::to_wstring(std::hash<std::thread::id>{}(std::this_thread::get_id())) +
+                    L".tmp";
+
+            {
+            std::ofstream entryFile(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!entryFile.is_open())
+                {
+                return;
+                }
+            entryFile.write(ENTRY_SIGNATURE.data(),
+                            static_cast<std::streamsize>(ENTRY_SIGNATURE.length()));
+            write_cache_value(entryFile, hash_content(results));
+            entryFile.write(results.data(), static_cast<std::streamsize>(results.length()));
+            if (!entryFile.flush())
+                {
+                entryFile.close();
+                std::error_code ec;
+                std::filesystem::remove(tempPath, ec);
+                return;
+                }
+            }
+
+        std::error_code ec;
+        std::filesystem::rename(tempPath, entryPath, ec);
+        if (ec)
+            {
+            std::filesystem::remove(tempPath, ec);
+            }
+        }
+    } // namespace i18n_check
@@ -0,0 +1,147 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __RESULTS_CACHE_H__
+#define __RESULTS_CACHE_H__
+
+#include "i18n_review.h"
+#include <cstdint>
+#include <filesystem>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace i18n_check
+    {
+    /** @brief Writes an integer to a cache stream (in little-endian order).
+        @param stream The stream to write to.
+        @param value The value to write.*/
+    void write_cache_value(std::ostream& stream, const uint64_t value);
+
+    /** @brief Reads an integer written by write_cache_value().
+        @param stream The stream to read from.
+        @returns The value.
+        @throws std::runtime_error If the stream ends prematurely.*/
+    [[nodiscard]]
+    uint64_t read_cache_value(std::istream& stream);
+
+    /** @brief Writes a string to a cache stream (as length-prefixed UTF-8).
+        @param stream The stream to write to.
+        @param str The string to write.*/
+    void write_cache_string(std::ostream& stream, std::wstring_view str);
+
+    /** @brief Reads a string written by write_cache_string().
+        @param stream The stream to read from.
+        @returns The string.
+        @throws std::runtime_error If the stream ends prematurely or the string is malformed.*/
+    [[nodiscard]]
+    std::wstring read_cache_string(std::istream& stream);
+
+    /** @brief Combines a value into a hash (using FNV-1a).
+        @param hash The hash to update.
+        @param data The value to combine into the hash.
+        @returns The updated hash.*/
+    [[nodiscard]]
+    uint64_t combine_cache_hash(uint64_t hash, std::string_view data) noexcept;
+
+    /** @brief On-disk cache of the results from analyzing files, so that files which
+            haven't changed since a previous run don't need to be analyzed again.
+        @details Each entry is keyed by the hash of a file's content, along with a hash of
+            the analyzers' settings. Because of that, entries are never stale; changing a file
+            or an option simply results in different entries being looked up.\n
+            Entries from older runs are not removed; deleting the cache folder is safe
+            and will just cause all files to be analyzed again on the next run.
+        @par Example:
+        @code
+         const i18n_check::results_cache cache(L".quneiform-cache", settingsHash);
+         const auto contentHash = cache.hash_content(fileContent);
+         if (const auto entry = cache.load(file_review_type::cpp, contentHash))
+            {
+            // read the results from *entry
+            }
+        @endcode*/
+    class results_cache
+        {
+      public:
+        /// @brief The initial value of hashes.
+        constexpr static uint64_t HASH_SEED{ 14'695'981'039'346'656'037ULL };
+        /// @brief The version of the format that results are cached in.
+        /// @details This should be changed whenever the analyzers' results change
+        ///     (e.g., a member is added to `string_info`), so that entries from
+        ///     older versions are not read.
+        constexpr static std::string_view FORMAT_VERSION{ "quneiform-cache-1" };
+
+        /** @brief Constructor.
+            @param cacheFolder The folder to store the cache in (it is created if necessary).
+            @param settingsHash A hash of the analyzers' settings.*/
+        results_cache(std::filesystem::path cacheFolder, const uint64_t settingsHash);
+
+        /// @returns The folder that the cache is stored in.
+        [[nodiscard]]
+        const std::filesystem::path& get_cache_folder() const noexcept
+            {
+            return m_cache_folder;
+            }
+
+        /// @returns The hash of a file's (raw) content.
+        /// @param content The file's content.
+        [[nodiscard]]
+        static uint64_t hash_content(std::string_view content) noexcept
+            {
+            return combine_cache_hash(HASH_SEED, content);
+            }
+
+        /** @brief Loads the cached results for a file.
+            @param fileType The type of analyzer that the results are from.
+            @param contentHash The hash of the file's content (from hash_content()).
+            @returns The cached results, or @c std::nullopt if the file isn't cached.*/
+        [[nodiscard]]
+        std::optional<std::string> load(const file_review_type fileType,
+                                        const uint64_t contentHash) const;
+
+        /** @brief Stores the results for a file.
+            @details The entry is written to a temporary file first and then renamed,
+                so that other threads (or processes) never see a partially written entry.\n
+                Failing to write the entry is not an error; the file will simply
+                be analyzed again next time.
+            @param fileType The type of analyzer that the results are from.
+            @param contentHash The hash of the file's content (from hash_content()).
+            @param results The results to cache.*/
+        void store(const file_review_type fileType, const uint64_t contentHash,
+                   std::string_view results) const;
+
+      private:
+        /// @returns The path of the cache entry for a file.
+        [[nodiscard]]
+        std::filesystem::path get_entry_path(const file_review_type fileType,
+                                             const uint64_t contentHash) const;
+
+        /// @brief The signature that each entry starts with.
+        constexpr static std::string_view ENTRY_SIGNATURE{ "QNFCACHE" };
+        /// @brief The size of an entry's signature and hash of its content.
+        constexpr static size_t ENTRY_HEADER_SIZE{ ENTRY_SIGNATURE.length() + sizeof(uint64_t) };
+
+        std::filesystem::path m_cache_folder;
+        uint64_t m_settings_hash{ 0 };
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__RESULTS_CACHE_H__
@@ -0,0 +1,99 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __RULE_SET_H__
+#define __RULE_SET_H__
+
+#include "flat_string_set.h"
+#include "regex_pattern.h"
+#include <map>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace i18n_check
+    {
+    /// @brief A deprecated function, indexed by its name (without the punctuation around it).
+    struct deprecated_function_entry
+        {
+        /// @brief The function, as it is listed in rule_set::m_deprecated_string_functions.
+        std::wstring_view m_function;
+        /// @brief The number of characters in front of the name (e.g., 1 for "*wxConvCurrent").
+        size_t m_prefix_length{ 0 };
+        /// @brief The function's order in rule_set::m_deprecated_string_functions.
+        size_t m_order{ 0 };
+        };
+
+    /** @brief The functions, keywords, and patterns that an analyzer uses to decide
+            how strings are being used.
+        @details Building these (especially the regexes) is expensive, so the built-in rules
+            are built once per process and shared by all analyzers and their clones
+            (see i18n_review::get_default_rules()).\n
+            Rules are never changed once they are shared. An analyzer that is customized
+            (e.g., by i18n_review::add_function_to_ignore()) switches to its own copy instead.\n
+            The names and known strings are looked up for nearly every string in a file,
+            so they are stored in flat hash sets rather than trees.*/
+    struct rule_set
+        {
+        /// @brief Functions/macros that indicate that a string will be localizable.
+        flat_string_set<> m_localization_functions;
+        /// @brief Localization functions that take a context argument.
+        flat_string_set<> m_localization_with_context_functions;
+        /// @brief Functions that explicitly mark a string as not translatable.
+        flat_string_set<> m_non_localizable_functions;
+        /// @brief Functions whose strings are internal (e.g., debug functions).
+        flat_string_set<> m_internal_functions;
+        /// @brief Logging functions.
+        flat_string_set<> m_log_functions;
+        /// @brief Exception classes.
+        flat_string_set<> m_exceptions;
+        /// @brief Constructors and macros that are skipped over when backtracing.
+        flat_string_set<> m_ctors_to_ignore;
+        /// @brief Known strings that are internal.
+        case_insensitive_flat_string_set m_known_internal_strings;
+        /// @brief Keywords that can appear in front of a string.
+        flat_string_set<> m_keywords;
+        /// @brief Deprecated text macros and what to suggest instead.
+        std::map<std::wstring_view, std::wstring> m_deprecated_string_macros;
+        /// @brief Deprecated functions and what to suggest instead.
+        std::map<std::wstring_view, std::wstring> m_deprecated_string_functions;
+        /// @brief The functions in @c m_deprecated_string_functions, by their names
+        ///     (without any punctuation around them), for finding them in a file's tokens.
+        std::unordered_map<std::wstring_view, std::vector<deprecated_function_entry>>
+            m_deprecated_function_names;
+        /// @brief Patterns of strings that are always translatable.
+        regex_set m_translatable_regexes;
+        /// @brief Patterns of strings that are never translatable.
+        regex_set m_untranslatable_regexes;
+        /// @brief Exceptions to the untranslatable patterns.
+        flat_string_set<> m_untranslatable_exceptions;
+        /// @brief Patterns of variable names whose strings are internal.
+        std::vector<regex_pattern> m_variable_name_patterns_to_ignore;
+        /// @brief Variable types whose constructors take internal strings.
+        flat_string_set<> m_variable_types_to_ignore;
+        /// @brief Font names.
+        case_insensitive_flat_string_set m_font_names;
+        /// @brief File extensions.
+        case_insensitive_flat_string_set m_file_extensions;
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__RULE_SET_H__
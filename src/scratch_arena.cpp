@@ -0,0 +1,50 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "scratch_arena.h"
+#include <algorithm>
+#include <bit>
+
+namespace i18n_check
+    {
+    //--------------------------------------------------
+    void scratch_arena::reset()
+        {
+        const bool overflowed{ m_heap.get_count() > 0 };
+        // leave some room for the padding that alignment adds
+        const size_t bytesNeeded{ m_requests.get_bytes() + (m_requests.get_bytes() / 4) };
+        m_requests.clear_counts();
+        m_heap.clear_counts();
+
+        if (overflowed && m_buffer_size < MAX_BUFFER_SIZE)
+            {
+            build_arena(std::min(std::max(m_buffer_size * 2, std::bit_ceil(bytesNeeded)),
+                                 MAX_BUFFER_SIZE));
+            }
+        else
+            {
+            m_arena->release();
+            }
+        }
+
+    //--------------------------------------------------
+    void scratch_arena::build_arena(const size_t bufferSize)
+        {
+        // the old arena returns its overflow to the heap before its buffer is replaced
+        m_arena.reset();
+        m_buffer = std::make_unique_for_overwrite<std::byte[]>(bufferSize);
+        m_buffer_size = bufferSize;
+        m_arena.emplace(m_buffer.get(), m_buffer_size, &m_heap);
+        m_requests.set_upstream(&m_arena.value());
+        }
+    } // namespace i18n_check
@@ -0,0 +1,164 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __SCRATCH_ARENA_H__
+#define __SCRATCH_ARENA_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace i18n_check
+    {
+    /** @brief Memory for the temporary buffers and strings used while reviewing a file,
+            which is all released at once when the file is finished.
+        @details Allocations are taken from a buffer that the arena owns (and are never freed
+            individually), so scanning a file doesn't go to the heap for its scratch containers.
+            If a file needs more than the buffer, the extra is taken from the heap and the
+            buffer is grown to fit it when the arena is reset, so that later files of that size
+            don't need the heap either.\n
+            Use get_resource() with @c std::pmr containers that are local to a file's review.
+        @note An arena is not thread safe; each analyzer (i.e., each worker thread) has its own.
+            Copying an arena gives a new, empty arena, rather than sharing the buffer.*/
+    class scratch_arena
+        {
+      public:
+        /// @brief Constructor.
+        scratch_arena() { build_arena(INITIAL_BUFFER_SIZE); }
+
+        /// @brief Copy constructor, which creates a new arena (nothing is copied).
+        scratch_arena(const scratch_arena&) : scratch_arena() {}
+
+        /// @brief Copy assignment, which leaves the arena as-is (nothing is copied).
+        scratch_arena& operator=(const scratch_arena&) noexcept { return *this; }
+
+        /// @returns The memory resource to use for scratch containers.
+        /// @warning Containers using this must be destroyed before reset() is called.
+        [[nodiscard]]
+        std::pmr::memory_resource* get_resource() noexcept
+            {
+            return &m_requests;
+            }
+
+        /// @brief Releases everything that has been allocated, and resets the counters.
+        /// @details If the buffer overflowed since the last reset, then it is grown.
+        void reset();
+
+        /// @returns The size of the arena's buffer, in bytes.
+        [[nodiscard]]
+        size_t get_buffer_size() const noexcept
+            {
+            return m_buffer_size;
+            }
+
+        /// @returns The number of allocations served since the last reset.
+        [[nodiscard]]
+        uint64_t get_allocation_count() const noexcept
+            {
+            return m_requests.get_count();
+            }
+
+        /// @returns The number of allocations that had to go to the heap
+        ///     (because the buffer was full) since the last reset.
+        [[nodiscard]]
+        uint64_t get_heap_allocation_count() const noexcept
+            {
+            return m_heap.get_count();
+            }
+
+        /// @brief The initial size of the buffer (64 KiB).
+        constexpr static size_t INITIAL_BUFFER_SIZE{ 64 * 1024 };
+        /// @brief The largest that the buffer will grow to (16 MiB).
+        /// @details Larger files will still work, but will use the heap for the overflow.
+        constexpr static size_t MAX_BUFFER_SIZE{ 16 * 1024 * 1024 };
+
+      private:
+        /// @brief Passes allocations to another resource, counting them along the way.
+        class counting_resource final : public std::pmr::memory_resource
+            {
+          public:
+            /// @brief Sets the resource to allocate from.
+            /// @param upstream The resource.
+            void set_upstream(std::pmr::memory_resource* upstream) noexcept
+                {
+                m_upstream = upstream;
+                }
+
+            /// @returns The number of allocations.
+            [[nodiscard]]
+            uint64_t get_count() const noexcept
+                {
+                return m_count;
+                }
+
+            /// @returns The number of bytes allocated.
+            [[nodiscard]]
+            size_t get_bytes() const noexcept
+                {
+                return m_bytes;
+                }
+
+            /// @brief Resets the counters.
+            void clear_counts() noexcept
+                {
+                m_count = 0;
+                m_bytes = 0;
+                }
+
+          private:
+            void* do_allocate(size_t bytes, size_t alignment) final
+                {
+                ++m_count;
+                m_bytes += bytes;
+                return m_upstream->allocate(bytes, alignment);
+                }
+
+            void do_deallocate(void* ptr, size_t bytes, size_t alignment) final
+                {
+                m_upstream->deallocate(ptr, bytes, alignment);
+                }
+
+            [[nodiscard]]
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept final
+                {
+                return this == &other;
+                }
+
+            std::pmr::memory_resource* m_upstream{ std::pmr::new_delete_resource() };
+            uint64_t m_count{ 0 };
+            size_t m_bytes{ 0 };
+            };
+
+        /// @brief (Re)creates the arena over a new buffer.
+        /// @param bufferSize The size of the buffer.
+        void build_arena(size_t bufferSize);
+
+        std::unique_ptr<std::byte[]> m_buffer;
+        size_t m_buffer_size{ 0 };
+        // overflow from the buffer (i.e., the heap)
+        counting_resource m_heap;
+        std::optional<std::pmr::monotonic_buffer_resource> m_arena;
+        // what the client allocates from (i.e., the arena)
+        counting_resource m_requests;
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__SCRATCH_ARENA_H__
@@ -33,6 +33,8 @@
 #include <regex>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 /// @brief String helper functions and classes.
 namespace string_util
@@ -1145,6 +1147,91 @@ namespace string_util
         return nullptr;
         }
 
+    /** @brief Searches for a character in the range [first, last).
+        @details Unlike @c std::wcschr(), this never reads past @c last (or stops at an
+            embedded null), so searching ahead from each position in a buffer stays linear.
+            The search is done with @c std::char_traits::find() (i.e., @c std::wmemchr()),
+            which the standard library vectorizes.
+        @param first The start of the range to search.
+        @param last The end of the range to search.
+        @param ch The character to search for.
+        @returns A pointer to where the character was found, or @c nullptr if not found.
+        @tparam T The (possibly const) character type.*/
+    template<typename T>
+    [[nodiscard]]
+    T* find_in_range(T* first, const std::remove_const_t<T>* last,
+                     const std::remove_const_t<T> ch) noexcept
+        {
+        if (first == nullptr || first >= last)
+            {
+            return nullptr;
+            }
+        return const_cast<T*>(std::char_traits<std::remove_const_t<T>>::find(
+            first, static_cast<size_t>(last - first), ch));
+        }
+
+    /** @brief Searches for a string in the range [first, last).
+        @param first The start of the range to search.
+        @param last The end of the range to search.
+        @param searchFor The string to search for. It must be entirely
+            within the range to match.
+        @returns A pointer to where the string starts, or @c nullptr if not found.
+        @tparam T The (possibly const) character type.*/
+    template<typename T>
+    [[nodiscard]]
+    T* find_in_range(T* first, const std::remove_const_t<T>* last,
+                     const std::basic_string_view<std::remove_const_t<T>> searchFor) noexcept
+        {
+        if (searchFor.empty())
+            {
+            return nullptr;
+            }
+        // look for the first character, and then see if the rest follows it
+        for (T* found = find_in_range(first, last, searchFor.front()); found != nullptr;
+             found = find_in_range(std::next(found), last, searchFor.front()))
+            {
+            if (static_cast<size_t>(last - found) < searchFor.length())
+                {
+                return nullptr;
+                }
+            if (std::char_traits<std::remove_const_t<T>>::compare(found, searchFor.data(),
+                                                                  searchFor.length()) == 0)
+                {
+                return found;
+                }
+            }
+        return nullptr;
+        }
+
+    /** @brief Searches for any of a set of characters in the range [first, last).
+        @details Each character is searched for with find_in_range(), narrowing the range
+            to what is in front of the closest match found so far. This keeps the search
+            vectorized and only reads the text once per character in the set,
+            so it is meant for small sets (e.g., @c L"\n\r").
+        @param first The start of the range to search.
+        @param last The end of the range to search.
+        @param searchFor The characters to search for.
+        @returns A pointer to where the first of the characters was found,
+            or @c nullptr if none of them were found.
+        @tparam T The (possibly const) character type.*/
+    template<typename T>
+    [[nodiscard]]
+    T* find_first_of_in_range(
+        T* first, const std::remove_const_t<T>* last,
+        const std::basic_string_view<std::remove_const_t<T>> searchFor) noexcept
+        {
+        T* closest{ nullptr };
+        for (const auto ch : searchFor)
+            {
+            if (T* found = find_in_range(first, (closest != nullptr ? closest : last), ch);
+                found != nullptr)
+                {
+                closest = found;
+                }
+            }
+        return closest;
+        }
+
     /// @brief Searches for a string in a larger string as a whole word.
     /// @param haystack The string to search inside of.
     /// @param needle The string to search for.
@@ -0,0 +1,152 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "structural_index.h"
+#include <numeric>
+#include <stdexcept>
+
+// SSE2 is always available on x86-64
+#if defined(__x86_64__) || defined(_M_X64)
+    #define I18N_CHECK_X86_64_SIMD
+    #include <immintrin.h>
+#endif
+
+namespace i18n_check
+    {
+    //------------------------------------------------------
+    /// @returns A bitmask of which of the (up to 64) characters are in @c characters.
+    static uint64_t index_block_scalar(const wchar_t* text, const size_t length,
+                                       const std::wstring_view characters) noexcept
+        {
+        uint64_t bits{ 0 };
+        for (size_t i = 0; i < length; ++i)
+            {
+            if (characters.find(text[i]) != std::wstring_view::npos)
+                {
+                bits |= (uint64_t{ 1 } << i);
+                }
+            }
+        return bits;
+        }
+
+#ifdef I18N_CHECK_X86_64_SIMD
+    //------------------------------------------------------
+    /// @returns A bitmask of which of the 64 characters are in @c characters.
+    static uint64_t index_block_sse2(const wchar_t* text, const std::wstring_view characters,
+                                     const __m128i* characterVectors) noexcept
+        {
+        uint64_t bits{ 0 };
+        // review 16 characters at a time, packing their comparison results down
+        // to a byte each so that one movemask returns a bit for each of them
+        for (size_t chunk = 0; chunk < 64; chunk += 16)
+            {
+            if constexpr (sizeof(wchar_t) == 2)
+                {
+                const __m128i first =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + chunk));
+                const __m128i second =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + chunk + 8));
+                __m128i firstMatches = _mm_setzero_si128();
+                __m128i secondMatches = _mm_setzero_si128();
+                for (size_t i = 0; i < characters.length(); ++i)
+                    {
+                    firstMatches =
+                        _mm_or_si128(firstMatches, _mm_cmpeq_epi16(first, characterVectors[i]));
+                    secondMatches =
+                        _mm_or_si128(secondMatches, _mm_cmpeq_epi16(second, characterVectors[i]));
+                    }
+                bits |= static_cast<uint64_t>(static_cast<uint32_t>(
+                            _mm_movemask_epi8(_mm_packs_epi16(firstMatches, secondMatches))))
+                        << chunk;
+                }
+            else
+                {
+                __m128i matches[4]{ _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(),
+                                    _mm_setzero_si128() };
+                for (size_t part = 0; part < 4; ++part)
+                    {
+                    const __m128i block =
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + chunk + part * 4));
+                    for (size_t i = 0; i < characters.length(); ++i)
+                        {
+                        matches[part] = _mm_or_si128(matches[part],
+                                                     _mm_cmpeq_epi32(block, characterVectors[i]));
+                        }
+                    }
+                // the comparison results are 0 or -1, so the saturation of the packing
+                // keeps them that way
+                bits |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(
+                            _mm_packs_epi16(_mm_packs_epi32(matches[0], matches[1]),
+                                            _mm_packs_epi32(matches[2], matches[3])))))
+                        << chunk;
+                }
+            }
+        return bits;
+        }
+#endif
+
+    //------------------------------------------------------
+    structural_index::structural_index(std::wstring_view text, std::wstring_view characters,
+                                       std::pmr::memory_resource* resource)
+        : m_bits(resource), m_length(text.length())
+        {
+        if (characters.length() > MAX_CHARACTERS)
+            {
+            throw std::invalid_argument("Too many characters to index.");
+            }
+        m_bits.resize((text.length() + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK);
+
+        const size_t fullBlocks{ text.length() / BITS_PER_BLOCK };
+#ifdef I18N_CHECK_X86_64_SIMD
+        // (a C array, since std::array drops the vector type's alignment attributes)
+        __m128i characterVectors[MAX_CHARACTERS]{};
+        for (size_t i = 0; i < characters.length(); ++i)
+            {
+            if constexpr (sizeof(wchar_t) == 2)
+                {
+                characterVectors[i] = _mm_set1_epi16(static_cast<short>(characters[i]));
+                }
+            else
+                {
+                characterVectors[i] = _mm_set1_epi32(static_cast<int>(characters[i]));
+                }
+            }
+        for (size_t block = 0; block < fullBlocks; ++block)
+            {
+            m_bits[block] = index_block_sse2(text.data() + (block * BITS_PER_BLOCK),
+                                             characters, characterVectors);
+            }
+#else
+        for (size_t block = 0; block < fullBlocks; ++block)
+            {
+            m_bits[block] = index_block_scalar(text.data() + (block * BITS_PER_BLOCK),
+                                               BITS_PER_BLOCK, characters);
+            }
+#endif
+        // the partial block at the end
+        if (fullBlocks < m_bits.size())
+            {
+            m_bits[fullBlocks] =
+                index_block_scalar(text.data() + (fullBlocks * BITS_PER_BLOCK),
+                                   text.length() - (fullBlocks * BITS_PER_BLOCK), characters);
+            }
+        }
+
+    //------------------------------------------------------
+    size_t structural_index::get_count() const noexcept
+        {
+        return std::accumulate(m_bits.cbegin(), m_bits.cend(), size_t{ 0 },
+                               [](const size_t total, const uint64_t bits)
+                               { return total + static_cast<size_t>(std::popcount(bits)); });
+        }
+    } // namespace i18n_check
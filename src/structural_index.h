@@ -0,0 +1,97 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __STRUCTURAL_INDEX_H__
+#define __STRUCTURAL_INDEX_H__
+
+#include <bit>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+namespace i18n_check
+    {
+    /** @brief A bitmap of where a set of characters (e.g., quotes and comment starts)
+            are in a text, so that a parser can jump between them instead of reviewing
+            every character.
+        @details The bitmap is built in one pass (using SSE2 on x86-64), with a bit for
+            each character in the text.
+        @note The index is not updated if the text changes. If a parser only ever blanks out
+            sections of the text (e.g., comments) with characters not in the set, then the
+            index will still find every character in the set; it may just also return
+            positions that have since been blanked out.
+        @par Example:
+        @code
+         // jump to the next quote or newline after the current position
+         const structural_index index{ text, L"\"\n" };
+         pos = index.find_next(pos + 1);
+        @endcode*/
+    class structural_index
+        {
+      public:
+        /** @brief Indexes a text.
+            @param text The text to index.
+            @param characters The characters to index (up to 16).
+            @param resource Where to allocate the bitmap (e.g., an analyzer's scratch arena).
+            @throws std::invalid_argument If more than @c MAX_CHARACTERS characters are
+                requested.*/
+        structural_index(std::wstring_view text, std::wstring_view characters,
+                         std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+        /// @returns The position of the first indexed character at or after @c position,
+        ///     or the length of the text if there aren't any.
+        /// @param position The position in the text to start from.
+        [[nodiscard]]
+        size_t find_next(const size_t position) const noexcept
+            {
+            if (position >= m_length)
+                {
+                return m_length;
+                }
+            size_t block{ position / BITS_PER_BLOCK };
+            // ignore the characters in the first block that are before the position
+            uint64_t bits{ m_bits[block] & (~uint64_t{ 0 } << (position % BITS_PER_BLOCK)) };
+            while (bits == 0)
+                {
+                if (++block >= m_bits.size())
+                    {
+                    return m_length;
+                    }
+                bits = m_bits[block];
+                }
+            return (block * BITS_PER_BLOCK) + static_cast<size_t>(std::countr_zero(bits));
+            }
+
+        /// @returns The number of indexed characters in the text.
+        [[nodiscard]]
+        size_t get_count() const noexcept;
+
+        /// @brief The maximum number of characters that can be indexed.
+        constexpr static size_t MAX_CHARACTERS{ 16 };
+
+      private:
+        constexpr static size_t BITS_PER_BLOCK{ 64 };
+
+        std::pmr::vector<uint64_t> m_bits;
+        size_t m_length{ 0 };
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__STRUCTURAL_INDEX_H__
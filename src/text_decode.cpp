@@ -0,0 +1,751 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "text_decode.h"
+#include <array>
+#include <bit>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+
+// SSE2 is always available on x86-64; AVX2 is used if the CPU supports it
+#if defined(__x86_64__) || defined(_M_X64)
+    #define I18N_CHECK_X86_64_SIMD
+    #include <immintrin.h>
+    #ifdef _MSC_VER
+        #include <intrin.h>
+        #define I18N_CHECK_TARGET_AVX2
+    #else
+        #define I18N_CHECK_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+namespace i18n_check
+    {
+    //------------------------------------------------------
+    /// @returns The length of the run of 7-bit ASCII characters at the start of a buffer.
+    static size_t ascii_run_length_scalar(const unsigned char* text, const size_t length) noexcept
+        {
+        size_t i{ 0 };
+        // review eight characters at a time, looking for any high bits
+        for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t))
+            {
+            uint64_t block{ 0 };
+            std::memcpy(&block, text + i, sizeof(uint64_t));
+            if ((block & 0x8080808080808080ULL) != 0)
+                {
+                break;
+                }
+            }
+        while (i < length && text[i] < 0x80)
+            {
+            ++i;
+            }
+        return i;
+        }
+
+    //------------------------------------------------------
+    /// @brief Copies the run of 7-bit ASCII characters at the start of a buffer
+    ///     into a wide buffer.
+    /// @returns The number of characters copied.
+    static size_t widen_ascii_scalar(const unsigned char* text, const size_t length,
+                                     wchar_t* output) noexcept
+        {
+        const size_t runLength = ascii_run_length_scalar(text, length);
+        for (size_t i = 0; i < runLength; ++i)
+            {
+            output[i] = static_cast<wchar_t>(text[i]);
+            }
+        return runLength;
+        }
+
+    //------------------------------------------------------
+    /// @brief Copies the run of 7-bit ASCII characters at the start of a wide buffer
+    ///     into a narrow buffer.
+    /// @returns The number of characters copied.
+    static size_t narrow_ascii_scalar(const wchar_t* text, const size_t length,
+                                      char* output) noexcept
+        {
+        size_t i{ 0 };
+        while (i < length && static_cast<uint32_t>(text[i]) < 0x80)
+            {
+            output[i] = static_cast<char>(text[i]);
+            ++i;
+            }
+        return i;
+        }
+
+#ifdef I18N_CHECK_X86_64_SIMD
+    //------------------------------------------------------
+    static size_t ascii_run_length_sse2(const unsigned char* text, const size_t length) noexcept
+        {
+        size_t i{ 0 };
+        for (; i + sizeof(__m128i) <= length; i += sizeof(__m128i))
+            {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+            // the high bit of each byte
+            const auto nonAsciiMask = static_cast<uint32_t>(_mm_movemask_epi8(chunk));
+            if (nonAsciiMask != 0)
+                {
+                return i + static_cast<size_t>(std::countr_zero(nonAsciiMask));
+                }
+            }
+        return i + ascii_run_length_scalar(text + i, length - i);
+        }
+
+    //------------------------------------------------------
+    I18N_CHECK_TARGET_AVX2
+    static size_t ascii_run_length_avx2(const unsigned char* text, const size_t length) noexcept
+        {
+        size_t i{ 0 };
+        for (; i + sizeof(__m256i) <= length; i += sizeof(__m256i))
+            {
+            const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+            const auto nonAsciiMask = static_cast<uint32_t>(_mm256_movemask_epi8(chunk));
+            if (nonAsciiMask != 0)
+                {
+                return i + static_cast<size_t>(std::countr_zero(nonAsciiMask));
+                }
+            }
+        return i + ascii_run_length_sse2(text + i, length - i);
+        }
+
+    //------------------------------------------------------
+    static size_t widen_ascii_sse2(const unsigned char* text, const size_t length,
+                                   wchar_t* output) noexcept
+        {
+        const __m128i zero = _mm_setzero_si128();
+        size_t i{ 0 };
+        for (; i + sizeof(__m128i) <= length; i += sizeof(__m128i))
+            {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+            if (_mm_movemask_epi8(chunk) != 0)
+                {
+                break;
+                }
+            // zero extend the bytes to 16-bit...
+            const __m128i low = _mm_unpacklo_epi8(chunk, zero);
+            const __m128i high = _mm_unpackhi_epi8(chunk, zero);
+            if constexpr (sizeof(wchar_t) == 2)
+                {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), low);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 8), high);
+                }
+            // ...and then to 32-bit
+            else
+                {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                                 _mm_unpacklo_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 4),
+                                 _mm_unpackhi_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 8),
+                                 _mm_unpacklo_epi16(high, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 12),
+                                 _mm_unpackhi_epi16(high, zero));
+                }
+            }
+        return i + widen_ascii_scalar(text + i, length - i, output + i);
+        }
+
+    //------------------------------------------------------
+    I18N_CHECK_TARGET_AVX2
+    static size_t widen_ascii_avx2(const unsigned char* text, const size_t length,
+                                   wchar_t* output) noexcept
+        {
+        size_t i{ 0 };
+        for (; i + sizeof(__m256i) <= length; i += sizeof(__m256i))
+            {
+            const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+            if (_mm256_movemask_epi8(chunk) != 0)
+                {
+                break;
+                }
+            const __m128i low = _mm256_castsi256_si128(chunk);
+            const __m128i high = _mm256_extracti128_si256(chunk, 1);
+            if constexpr (sizeof(wchar_t) == 2)
+                {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                                    _mm256_cvtepu8_epi16(low));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i + 16),
+                                    _mm256_cvtepu8_epi16(high));
+                }
+            else
+                {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                                    _mm256_cvtepu8_epi32(low));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i + 8),
+                                    _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i + 16),
+                                    _mm256_cvtepu8_epi32(high));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i + 24),
+                                    _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+                }
+            }
+        return i + widen_ascii_sse2(text + i, length - i, output + i);
+        }
+
+    //------------------------------------------------------
+    static size_t narrow_ascii_sse2(const wchar_t* text, const size_t length,
+                                    char* output) noexcept
+        {
+        const __m128i zero = _mm_setzero_si128();
+        size_t i{ 0 };
+        if constexpr (sizeof(wchar_t) == 2)
+            {
+            const __m128i highBits = _mm_set1_epi16(static_cast<short>(0xFF80));
+            for (; i + 16 <= length; i += 16)
+                {
+                const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+                const __m128i second =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i + 8));
+                const __m128i anyHighBits =
+                    _mm_and_si128(_mm_or_si128(first, second), highBits);
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(anyHighBits, zero)) != 0xFFFF)
+                    {
+                    break;
+                    }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                                 _mm_packus_epi16(first, second));
+                }
+            }
+        else
+            {
+            const __m128i highBits = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+            for (; i + 16 <= length; i += 16)
+                {
+                const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+                const __m128i second =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i + 4));
+                const __m128i third =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i + 8));
+                const __m128i fourth =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i + 12));
+                const __m128i anyHighBits = _mm_and_si128(
+                    _mm_or_si128(_mm_or_si128(first, second), _mm_or_si128(third, fourth)),
+                    highBits);
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(anyHighBits, zero)) != 0xFFFF)
+                    {
+                    break;
+                    }
+                // the values are all below 0x80, so the saturation of the packing is harmless
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                                 _mm_packus_epi16(_mm_packs_epi32(first, second),
+                                                  _mm_packs_epi32(third, fourth)));
+                }
+            }
+        return i + narrow_ascii_scalar(text + i, length - i, output + i);
+        }
+
+    //------------------------------------------------------
+    /// @returns @c true if the CPU (and OS) support AVX2.
+    static bool cpu_supports_avx2() noexcept
+        {
+#ifdef _MSC_VER
+        int cpuInfo[4]{ 0 };
+        __cpuid(cpuInfo, 0);
+        if (cpuInfo[0] < 7)
+            {
+            return false;
+            }
+        __cpuid(cpuInfo, 1);
+        // the OS must also be saving the AVX registers between context switches
+        constexpr int OSXSAVE{ 1 << 27 };
+        if ((cpuInfo[2] & OSXSAVE) == 0 || (_xgetbv(0) & 0x6) != 0x6)
+            {
+            return false;
+            }
+        __cpuidex(cpuInfo, 7, 0);
+        constexpr int AVX2{ 1 << 5 };
+        return (cpuInfo[1] & AVX2) != 0;
+#else
+        return __builtin_cpu_supports("avx2");
+#endif
+        }
+#endif
+
+    /// @private
+    using ascii_run_length_function = size_t (*)(const unsigned char*, const size_t) noexcept;
+    /// @private
+    using widen_ascii_function = size_t (*)(const unsigned char*, const size_t, wchar_t*) noexcept;
+
+    //------------------------------------------------------
+    /// @returns The fastest ASCII run reader that the CPU supports.
+    static ascii_run_length_function get_ascii_run_length() noexcept
+        {
+#ifdef I18N_CHECK_X86_64_SIMD
+        static const ascii_run_length_function asciiRunLength =
+            cpu_supports_avx2() ? ascii_run_length_avx2 : ascii_run_length_sse2;
+        return asciiRunLength;
+#else
+        return ascii_run_length_scalar;
+#endif
+        }
+
+    //------------------------------------------------------
+    /// @returns The fastest ASCII widener that the CPU supports.
+    static widen_ascii_function get_widen_ascii() noexcept
+        {
+#ifdef I18N_CHECK_X86_64_SIMD
+        static const widen_ascii_function widenAscii =
+            cpu_supports_avx2() ? widen_ascii_avx2 : widen_ascii_sse2;
+        return widenAscii;
+#else
+        return widen_ascii_scalar;
+#endif
+        }
+
+    //------------------------------------------------------
+    /** @brief Reads a multibyte UTF-8 sequence.
+        @param text The start of the sequence.
+        @param length The number of bytes available (must be at least 1).
+        @param[out] codePoint The decoded value.
+        @returns The length of the sequence, or @c 0 if invalid.*/
+    static size_t read_utf8_sequence(const unsigned char* text, const size_t length,
+                                     char32_t& codePoint) noexcept
+        {
+        const unsigned char lead{ text[0] };
+        const auto isContinuation = [](const unsigned char chr) noexcept
+        { return (chr & 0xC0) == 0x80; };
+
+        if (lead >= 0xC2 && lead <= 0xDF)
+            {
+            if (length < 2 || !isContinuation(text[1]))
+                {
+                return 0;
+                }
+            codePoint = (static_cast<char32_t>(lead & 0x1F) << 6) | (text[1] & 0x3F);
+            return 2;
+            }
+        else if (lead >= 0xE0 && lead <= 0xEF)
+            {
+            if (length < 3 || !isContinuation(text[1]) || !isContinuation(text[2]) ||
+                // overlong
+                (lead == 0xE0 && text[1] < 0xA0) ||
+                // surrogates
+                (lead == 0xED && text[1] > 0x9F))
+                {
+                return 0;
+                }
+            codePoint = (static_cast<char32_t>(lead & 0x0F) << 12) |
+                        (static_cast<char32_t>(text[1] & 0x3F) << 6) | (text[2] & 0x3F);
+            return 3;
+            }
+        else if (lead >= 0xF0 && lead <= 0xF4)
+            {
+            if (length < 4 || !isContinuation(text[1]) || !isContinuation(text[2]) ||
+                !isContinuation(text[3]) ||
+                // overlong
+                (lead == 0xF0 && text[1] < 0x90) ||
+                // beyond U+10FFFF
+                (lead == 0xF4 && text[1] > 0x8F))
+                {
+                return 0;
+                }
+            codePoint = (static_cast<char32_t>(lead & 0x07) << 18) |
+                        (static_cast<char32_t>(text[1] & 0x3F) << 12) |
+                        (static_cast<char32_t>(text[2] & 0x3F) << 6) | (text[3] & 0x3F);
+            return 4;
+            }
+        // stray continuation byte, overlong two-byte lead (C0, C1), or F5-FF
+        return 0;
+        }
+
+    /// @private
+    using code_page_table = std::array<char16_t, 128>;
+
+    //------------------------------------------------------
+    /// @returns The Unicode values of ISO-8859-1's upper half (0x80-0xFF),
+    ///     which are the same as their byte values.
+    static constexpr code_page_table make_iso_8859_1_table() noexcept
+        {
+        code_page_table table{};
+        for (size_t i = 0; i < table.size(); ++i)
+            {
+            table[i] = static_cast<char16_t>(0x80 + i);
+            }
+        return table;
+        }
+
+    //------------------------------------------------------
+    /// @returns The Unicode values of ISO-8859-15's upper half (0x80-0xFF),
+    ///     which is ISO-8859-1 with eight of its symbols replaced.
+    static constexpr code_page_table make_iso_8859_15_table() noexcept
+        {
+        code_page_table table{ make_iso_8859_1_table() };
+        table[0xA4 - 0x80] = 0x20AC; // euro sign
+        table[0xA6 - 0x80] = 0x0160; // S with caron
+        table[0xA8 - 0x80] = 0x0161; // s with caron
+        table[0xB4 - 0x80] = 0x017D; // Z with caron
+        table[0xB8 - 0x80] = 0x017E; // z with caron
+        table[0xBC - 0x80] = 0x0152; // OE ligature
+        table[0xBD - 0x80] = 0x0153; // oe ligature
+        table[0xBE - 0x80] = 0x0178; // Y with diaeresis
+        return table;
+        }
+
+    //------------------------------------------------------
+    /// @returns The Unicode values of Windows-1252's upper half (0x80-0xFF),
+    ///     which is ISO-8859-1 with printable characters in place of most of
+    ///     the C1 control codes (0x80-0x9F).
+    static constexpr code_page_table make_windows_1252_table() noexcept
+        {
+        code_page_table table{ make_iso_8859_1_table() };
+        // the unassigned values (0x81, 0x8D, 0x8F, 0x90, and 0x9D)
+        // are left as control codes, like Windows does
+        constexpr std::array<char16_t, 32> c1Replacements{
+            0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+            0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+            0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+            0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178
+        };
+        for (size_t i = 0; i < c1Replacements.size(); ++i)
+            {
+            table[i] = c1Replacements[i];
+            }
+        return table;
+        }
+
+    //------------------------------------------------------
+    /// @returns The table of Unicode values for a legacy encoding's upper half.
+    /// @note Windows-1252 is used for non-legacy encodings.
+    static const code_page_table& get_code_page_table(const text_encoding encoding) noexcept
+        {
+        static constexpr code_page_table ISO_8859_1_TABLE{ make_iso_8859_1_table() };
+        static constexpr code_page_table ISO_8859_15_TABLE{ make_iso_8859_15_table() };
+        static constexpr code_page_table WINDOWS_1252_TABLE{ make_windows_1252_table() };
+
+        if (encoding == text_encoding::iso_8859_1)
+            {
+            return ISO_8859_1_TABLE;
+            }
+        else if (encoding == text_encoding::iso_8859_15)
+            {
+            return ISO_8859_15_TABLE;
+            }
+        else
+            {
+            return WINDOWS_1252_TABLE;
+            }
+        }
+
+    //------------------------------------------------------
+    bool decode_utf8(std::string_view text, std::wstring& output)
+        {
+        // the wide text will never have more characters than the UTF-8 has bytes
+        output.resize(text.length());
+
+        const widen_ascii_function widenAscii = get_widen_ascii();
+        const auto* const data = reinterpret_cast<const unsigned char*>(text.data());
+        wchar_t* outputPos = output.data();
+        size_t i{ 0 };
+        while (i < text.length())
+            {
+            // copy over runs of ASCII in bulk (skipped for text that is mostly multibyte)
+            if (data[i] < 0x80)
+                {
+                const size_t asciiLength = widenAscii(data + i, text.length() - i, outputPos);
+                outputPos += asciiLength;
+                i += asciiLength;
+                if (i == text.length())
+                    {
+                    break;
+                    }
+                }
+
+            char32_t codePoint{ 0 };
+            const size_t sequenceLength =
+                read_utf8_sequence(data + i, text.length() - i, codePoint);
+            if (sequenceLength == 0)
+                {
+                output.clear();
+                return false;
+                }
+            i += sequenceLength;
+            if constexpr (sizeof(wchar_t) == 2)
+                {
+                if (codePoint > 0xFFFF)
+                    {
+                    codePoint -= 0x10000;
+                    *outputPos++ = static_cast<wchar_t>(0xD800 + (codePoint >> 10));
+                    *outputPos++ = static_cast<wchar_t>(0xDC00 + (codePoint & 0x3FF));
+                    continue;
+                    }
+                }
+            *outputPos++ = static_cast<wchar_t>(codePoint);
+            }
+
+        output.resize(static_cast<size_t>(outputPos - output.data()));
+        return true;
+        }
+
+    //------------------------------------------------------
+    bool is_valid_utf8(std::string_view text) noexcept
+        {
+        const ascii_run_length_function asciiRunLength = get_ascii_run_length();
+        const auto* const data = reinterpret_cast<const unsigned char*>(text.data());
+        size_t i{ 0 };
+        while (i < text.length())
+            {
+            if (data[i] < 0x80)
+                {
+                i += asciiRunLength(data + i, text.length() - i);
+                if (i == text.length())
+                    {
+                    break;
+                    }
+                }
+            char32_t codePoint{ 0 };
+            const size_t sequenceLength =
+                read_utf8_sequence(data + i, text.length() - i, codePoint);
+            if (sequenceLength == 0)
+                {
+                return false;
+                }
+            i += sequenceLength;
+            }
+        return true;
+        }
+
+    //------------------------------------------------------
+    std::wstring_view get_encoding_name(const text_encoding encoding) noexcept
+        {
+        if (encoding == text_encoding::utf8)
+            {
+            return L"UTF-8";
+            }
+        else if (encoding == text_encoding::utf16_little_endian)
+            {
+            return L"UTF-16LE";
+            }
+        else if (encoding == text_encoding::utf16_big_endian)
+            {
+            return L"UTF-16BE";
+            }
+        else if (encoding == text_encoding::windows_1252)
+            {
+            return L"Windows-1252";
+            }
+        else if (encoding == text_encoding::iso_8859_1)
+            {
+            return L"ISO-8859-1";
+            }
+        else if (encoding == text_encoding::iso_8859_15)
+            {
+            return L"ISO-8859-15";
+            }
+        else
+            {
+            return {};
+            }
+        }
+
+    //------------------------------------------------------
+    std::optional<text_encoding> get_legacy_encoding_from_name(std::string_view name)
+        {
+        std::string lowerName{ name };
+        for (auto& chr : lowerName)
+            {
+            chr = static_cast<char>(std::tolower(static_cast<unsigned char>(chr)));
+            }
+
+        if (lowerName == "windows-1252" || lowerName == "cp1252")
+            {
+            return text_encoding::windows_1252;
+            }
+        else if (lowerName == "iso-8859-1" || lowerName == "latin1")
+            {
+            return text_encoding::iso_8859_1;
+            }
+        else if (lowerName == "iso-8859-15" || lowerName == "latin9")
+            {
+            return text_encoding::iso_8859_15;
+            }
+        return std::nullopt;
+        }
+
+    //------------------------------------------------------
+    decoded_text decode_text(std::string_view text,
+                             const text_encoding legacyEncoding /*= text_encoding::windows_1252*/)
+        {
+        decoded_text decoded;
+
+        if (text.starts_with("\xFF\xFE"))
+            {
+            decoded.m_encoding = text_encoding::utf16_little_endian;
+            decoded.m_text = decode_utf16(text.substr(2), true);
+            return decoded;
+            }
+        if (text.starts_with("\xFE\xFF"))
+            {
+            decoded.m_encoding = text_encoding::utf16_big_endian;
+            decoded.m_text = decode_utf16(text.substr(2), false);
+            return decoded;
+            }
+
+        const bool hasUtf8Bom{ has_utf8_bom(text) };
+        if (hasUtf8Bom)
+            {
+            text.remove_prefix(3);
+            }
+        // validating the text is also what tells us whether it is UTF-8
+        if (decode_utf8(text, decoded.m_text))
+            {
+            decoded.m_has_utf8_bom = hasUtf8Bom;
+            return decoded;
+            }
+
+        decoded.m_encoding = legacyEncoding;
+        decoded.m_text = decode_legacy_text(text, legacyEncoding);
+        return decoded;
+        }
+
+    //------------------------------------------------------
+    std::wstring decode_utf16(std::string_view text, const bool littleEndian)
+        {
+        const size_t unitCount{ text.length() / 2 };
+        std::wstring output(unitCount, 0);
+
+        const auto* const data = reinterpret_cast<const unsigned char*>(text.data());
+        const auto readUnit = [data, littleEndian](const size_t index) noexcept
+        {
+            const unsigned char first{ data[index * 2] };
+            const unsigned char second{ data[(index * 2) + 1] };
+            return littleEndian ? static_cast<char16_t>((second << 8) | first) :
+                                  static_cast<char16_t>((first << 8) | second);
+        };
+
+        wchar_t* outputPos = output.data();
+        for (size_t i = 0; i < unitCount; ++i)
+            {
+            const char16_t unit{ readUnit(i) };
+            if (unit < 0xD800 || unit > 0xDFFF)
+                {
+                *outputPos++ = static_cast<wchar_t>(unit);
+                }
+            else if (unit <= 0xDBFF && i + 1 < unitCount && readUnit(i + 1) >= 0xDC00 &&
+                     readUnit(i + 1) <= 0xDFFF)
+                {
+                const char16_t lowSurrogate{ readUnit(++i) };
+                if constexpr (sizeof(wchar_t) == 2)
+                    {
+                    *outputPos++ = static_cast<wchar_t>(unit);
+                    *outputPos++ = static_cast<wchar_t>(lowSurrogate);
+                    }
+                else
+                    {
+                    *outputPos++ = static_cast<wchar_t>(
+                        0x10000 + ((static_cast<char32_t>(unit) - 0xD800) << 10) +
+                        (static_cast<char32_t>(lowSurrogate) - 0xDC00));
+                    }
+                }
+            else
+                {
+                *outputPos++ = static_cast<wchar_t>(0xFFFD);
+                }
+            }
+
+        output.resize(static_cast<size_t>(outputPos - output.data()));
+        return output;
+        }
+
+    //------------------------------------------------------
+    std::wstring decode_legacy_text(std::string_view text, const text_encoding encoding)
+        {
+        const code_page_table& codePage = get_code_page_table(encoding);
+        const widen_ascii_function widenAscii = get_widen_ascii();
+
+        std::wstring output(text.length(), 0);
+        const auto* const data = reinterpret_cast<const unsigned char*>(text.data());
+        size_t i{ 0 };
+        while (i < text.length())
+            {
+            if (data[i] < 0x80)
+                {
+                i += widenAscii(data + i, text.length() - i, output.data() + i);
+                }
+            else
+                {
+                output[i] = static_cast<wchar_t>(codePage[data[i] - 0x80]);
+                ++i;
+                }
+            }
+        return output;
+        }
+
+    //------------------------------------------------------
+    std::string encode_utf8(std::wstring_view text)
+        {
+        // enough room for the worst case (e.g., all CJK characters)
+        std::string output(text.length() * 4, 0);
+
+        char* outputPos = output.data();
+        size_t i{ 0 };
+        while (i < text.length())
+            {
+            if (static_cast<uint32_t>(text[i]) < 0x80)
+                {
+#ifdef I18N_CHECK_X86_64_SIMD
+                const size_t asciiLength =
+                    narrow_ascii_sse2(text.data() + i, text.length() - i, outputPos);
+#else
+                const size_t asciiLength =
+                    narrow_ascii_scalar(text.data() + i, text.length() - i, outputPos);
+#endif
+                outputPos += asciiLength;
+                i += asciiLength;
+                if (i == text.length())
+                    {
+                    break;
+                    }
+                }
+
+            auto codePoint = static_cast<char32_t>(text[i++]);
+            // combine surrogate pairs (which can also appear in 32-bit wchar_t strings
+            // if they came from UTF-16 text)
+            if (codePoint >= 0xD800 && codePoint <= 0xDBFF && i < text.length() &&
+                static_cast<char32_t>(text[i]) >= 0xDC00 &&
+                static_cast<char32_t>(text[i]) <= 0xDFFF)
+                {
+                codePoint = 0x10000 + ((codePoint - 0xD800) << 10) +
+                            (static_cast<char32_t>(text[i]) - 0xDC00);
+                ++i;
+                }
+            else if ((codePoint >= 0xD800 && codePoint <= 0xDFFF) || codePoint > 0x10FFFF)
+                {
+                codePoint = 0xFFFD;
+                }
+
+            if (codePoint < 0x800)
+                {
+                *outputPos++ = static_cast<char>(0xC0 | (codePoint >> 6));
+                *outputPos++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+                }
+            else if (codePoint < 0x10000)
+                {
+                *outputPos++ = static_cast<char>(0xE0 | (codePoint >> 12));
+                *outputPos++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                *outputPos++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+                }
+            else
+                {
+                *outputPos++ = static_cast<char>(0xF0 | (codePoint >> 18));
+                *outputPos++ = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                *outputPos++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                *outputPos++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+                }
+            }
+
+        output.resize(static_cast<size_t>(outputPos - output.data()));
+        return output;
+        }
+    } // namespace i18n_check
@@ -0,0 +1,134 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __TEXT_DECODE_H__
+#define __TEXT_DECODE_H__
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace i18n_check
+    {
+    /// @brief Encodings that text can be read as.
+    enum class text_encoding
+        {
+        /// @brief UTF-8 (or 7-bit ASCII).
+        utf8,
+        /// @brief UTF-16, little endian.
+        utf16_little_endian,
+        /// @brief UTF-16, big endian.
+        utf16_big_endian,
+        /// @brief Windows-1252 (Western European).
+        windows_1252,
+        /// @brief ISO-8859-1 (Latin-1).
+        iso_8859_1,
+        /// @brief ISO-8859-15 (Latin-9).
+        iso_8859_15
+        };
+
+    /// @returns The display name of an encoding.
+    /// @param encoding The encoding.
+    [[nodiscard]]
+    std::wstring_view get_encoding_name(const text_encoding encoding) noexcept;
+
+    /** @returns The legacy (i.e., 8-bit) encoding matching a name
+            (e.g., "windows-1252" or "iso-8859-15"), or @c std::nullopt if not supported.
+        @param name The name of the encoding (case insensitive).*/
+    [[nodiscard]]
+    std::optional<text_encoding> get_legacy_encoding_from_name(std::string_view name);
+
+    /// @brief Text converted from a file, along with the encoding that it was read as.
+    struct decoded_text
+        {
+        /// @brief The converted text.
+        std::wstring m_text;
+        /// @brief The encoding that the text was read as.
+        text_encoding m_encoding{ text_encoding::utf8 };
+        /// @brief Whether the text started with a UTF-8 signature (BOM).
+        bool m_has_utf8_bom{ false };
+        };
+
+    /** @brief Detects the encoding of a file's content and converts it into a wide string.
+        @details The encoding is determined as follows:
+            - UTF-16 (little or big endian) if it starts with the matching BOM.
+            - UTF-8 if it is valid UTF-8 (with or without a BOM).
+            - Otherwise, the provided legacy encoding.\n
+            The text is only read through once (twice if it turns out to not be UTF-8).
+        @param text The raw content of the file.
+        @param legacyEncoding The encoding to use if the text is not Unicode.
+        @returns The converted text and the encoding that it was read as.*/
+    [[nodiscard]]
+    decoded_text decode_text(std::string_view text,
+                             const text_encoding legacyEncoding = text_encoding::windows_1252);
+
+    /** @returns @c true if a block of text starts with a UTF-8 signature (BOM).
+        @param text The raw text to review.*/
+    [[nodiscard]]
+    inline bool has_utf8_bom(std::string_view text) noexcept
+        {
+        return text.starts_with("\xEF\xBB\xBF");
+        }
+
+    /** @brief Converts UTF-8 text into a wide string, validating it along the way.
+        @details Runs of 7-bit ASCII are converted in bulk, using SSE2 or AVX2
+            (if the CPU supports it) on x86-64.\n
+            Invalid sequences include truncated or overlong sequences, surrogates,
+            and values beyond U+10FFFF.\n
+            Characters outside of the BMP are written as surrogate pairs if @c wchar_t
+            is 16-bit.
+        @param text The UTF-8 text to convert (a leading BOM is not skipped).
+        @param[out] output The wide string to write the converted text to.\n
+            This is only valid if the text was valid UTF-8.
+        @returns @c true if the text was valid UTF-8 (and converted).*/
+    [[nodiscard]]
+    bool decode_utf8(std::string_view text, std::wstring& output);
+
+    /** @returns @c true if a block of text is valid UTF-8.
+        @param text The UTF-8 text to review.*/
+    [[nodiscard]]
+    bool is_valid_utf8(std::string_view text) noexcept;
+
+    /** @brief Converts UTF-16 text into a wide string.
+        @details Surrogate pairs are combined if @c wchar_t is 32-bit, and unpaired
+            surrogates are written as U+FFFD. A trailing odd byte is ignored.
+        @param text The UTF-16 text to convert (a leading BOM is not skipped).
+        @param littleEndian @c true if the text is little endian.
+        @returns The converted text.*/
+    [[nodiscard]]
+    std::wstring decode_utf16(std::string_view text, const bool littleEndian);
+
+    /** @brief Converts text from a legacy (8-bit) encoding into a wide string.
+        @param text The text to convert.
+        @param encoding The encoding of the text
+            (@c windows_1252, @c iso_8859_1, or @c iso_8859_15).
+        @returns The converted text.*/
+    [[nodiscard]]
+    std::wstring decode_legacy_text(std::string_view text, const text_encoding encoding);
+
+    /** @brief Converts a wide string to UTF-8.
+        @details Surrogate pairs are combined (even if @c wchar_t is 32-bit),
+            and unpaired surrogates or invalid values are written as U+FFFD.
+        @param text The text to convert.
+        @returns The UTF-8 text.*/
+    [[nodiscard]]
+    std::string encode_utf8(std::wstring_view text);
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__TEXT_DECODE_H__
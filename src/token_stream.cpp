@@ -0,0 +1,223 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "token_stream.h"
+
+namespace i18n_check
+    {
+    //--------------------------------------------------
+    static bool is_name_start_char(const wchar_t ch) noexcept
+        {
+        return (ch >= L'a' && ch <= L'z') || (ch >= L'A' && ch <= L'Z') || ch == L'_';
+        }
+
+    //--------------------------------------------------
+    static bool is_digit_char(const wchar_t ch) noexcept { return (ch >= L'0' && ch <= L'9'); }
+
+    //--------------------------------------------------
+    static bool is_name_char(const wchar_t ch) noexcept
+        {
+        return is_name_start_char(ch) || is_digit_char(ch);
+        }
+
+    //--------------------------------------------------
+    /// @returns @c true if @c prefix can be in front of a string or character literal.
+    static bool is_literal_prefix(const std::wstring_view prefix, const wchar_t quote) noexcept
+        {
+        if (prefix == L"L" || prefix == L"u" || prefix == L"U" || prefix == L"u8")
+            {
+            return true;
+            }
+        return quote == L'"' && (prefix == L"R" || prefix == L"LR" || prefix == L"uR" ||
+                                 prefix == L"UR" || prefix == L"u8R");
+        }
+
+    //--------------------------------------------------
+    token_stream::token_stream(std::wstring_view text, std::pmr::memory_resource* resource)
+        : m_text(text), m_tokens(resource)
+        {
+        tokenize();
+        }
+
+    //--------------------------------------------------
+    void token_stream::tokenize()
+        {
+        // source code averages a token every few characters, so this rarely needs to grow
+        m_tokens.reserve(m_text.length() / 4);
+
+        bool isLineStart{ true };
+        size_t pos{ 0 };
+        while (pos < m_text.length())
+            {
+            const wchar_t ch{ m_text[pos] };
+            if (ch == L'\n')
+                {
+                isLineStart = true;
+                ++pos;
+                continue;
+                }
+            if (ch == L' ' || ch == L'\t' || ch == L'\r' || ch == L'\v' || ch == L'\f')
+                {
+                ++pos;
+                continue;
+                }
+
+            const size_t start{ pos };
+            const wchar_t nextCh{ (pos + 1 < m_text.length()) ? m_text[pos + 1] : L'\0' };
+            token_type type{ token_type::punctuation };
+            if (ch == L'#' && isLineStart)
+                {
+                ++pos;
+                while (pos < m_text.length() && (m_text[pos] == L' ' || m_text[pos] == L'\t'))
+                    {
+                    ++pos;
+                    }
+                while (pos < m_text.length() && is_name_char(m_text[pos]))
+                    {
+                    ++pos;
+                    }
+                type = token_type::preprocessor;
+                }
+            else if (ch == L'/' && nextCh == L'/')
+                {
+                pos = m_text.find(L'\n', pos);
+                if (pos == std::wstring_view::npos)
+                    {
+                    pos = m_text.length();
+                    }
+                type = token_type::comment;
+                }
+            else if (ch == L'/' && nextCh == L'*')
+                {
+                pos = m_text.find(L"*/", pos + 2);
+                pos = (pos == std::wstring_view::npos) ? m_text.length() : pos + 2;
+                type = token_type::comment;
+                }
+            else if (is_name_start_char(ch))
+                {
+                while (pos < m_text.length() && is_name_char(m_text[pos]))
+                    {
+                    ++pos;
+                    }
+                type = token_type::identifier;
+                // an identifier like L or u8R in front of a quote is the literal's prefix
+                if (pos < m_text.length() && (m_text[pos] == L'"' || m_text[pos] == L'\'') &&
+                    is_literal_prefix(m_text.substr(start, pos - start), m_text[pos]))
+                    {
+                    if (m_text[pos] == L'\'')
+                        {
+                        pos = find_quote_end(pos);
+                        type = token_type::char_literal;
+                        }
+                    else
+                        {
+                        pos = (m_text[pos - 1] == L'R') ? find_raw_string_end(pos) :
+                                                          find_quote_end(pos);
+                        type = token_type::string_literal;
+                        }
+                    }
+                }
+            else if (is_digit_char(ch) || (ch == L'.' && is_digit_char(nextCh)))
+                {
+                ++pos;
+                while (pos < m_text.length())
+                    {
+                    const wchar_t numCh{ m_text[pos] };
+                    if (is_name_char(numCh) || numCh == L'.' ||
+                        // digit separator (e.g., 1'000)
+                        (numCh == L'\'' && pos + 1 < m_text.length() &&
+                         is_name_char(m_text[pos + 1])) ||
+                        // exponent sign (e.g., 1e-5 or 0x1p+3)
+                        ((numCh == L'+' || numCh == L'-') &&
+                         (m_text[pos - 1] == L'e' || m_text[pos - 1] == L'E' ||
+                          m_text[pos - 1] == L'p' || m_text[pos - 1] == L'P')))
+                        {
+                        ++pos;
+                        }
+                    else
+                        {
+                        break;
+                        }
+                    }
+                type = token_type::number;
+                }
+            else if (ch == L'"')
+                {
+                pos = find_quote_end(pos);
+                type = token_type::string_literal;
+                }
+            else if (ch == L'\'')
+                {
+                pos = find_quote_end(pos);
+                type = token_type::char_literal;
+                }
+            else
+                {
+                ++pos;
+                }
+
+            m_tokens.push_back(token{ type, start, pos - start });
+            isLineStart = false;
+            }
+        }
+
+    //--------------------------------------------------
+    size_t token_stream::find_quote_end(size_t pos) const noexcept
+        {
+        const wchar_t quote{ m_text[pos] };
+        ++pos;
+        while (pos < m_text.length())
+            {
+            if (m_text[pos] == L'\\')
+                {
+                pos += 2;
+                continue;
+                }
+            if (m_text[pos] == quote)
+                {
+                return pos + 1;
+                }
+            // an unterminated literal ends at the end of its line
+            if (m_text[pos] == L'\n')
+                {
+                return pos;
+                }
+            ++pos;
+            }
+        return m_text.length();
+        }
+
+    //--------------------------------------------------
+    size_t token_stream::find_raw_string_end(const size_t pos) const noexcept
+        {
+        // R"delimiter( ... )delimiter"
+        const size_t openParen{ m_text.find_first_of(L"( \t\r\n\\)\"", pos + 1) };
+        if (openParen == std::wstring_view::npos || m_text[openParen] != L'(')
+            {
+            return find_quote_end(pos);
+            }
+        const std::wstring_view delimiter{ m_text.substr(pos + 1, openParen - (pos + 1)) };
+        size_t closeParen{ m_text.find(L')', openParen + 1) };
+        while (closeParen != std::wstring_view::npos)
+            {
+            const size_t quotePos{ closeParen + 1 + delimiter.length() };
+            if (quotePos < m_text.length() && m_text[quotePos] == L'"' &&
+                m_text.substr(closeParen + 1, delimiter.length()) == delimiter)
+                {
+                return quotePos + 1;
+                }
+            closeParen = m_text.find(L')', closeParen + 1);
+            }
+        return m_text.length();
+        }
+    } // namespace i18n_check
@@ -0,0 +1,144 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __TOKEN_STREAM_H__
+#define __TOKEN_STREAM_H__
+
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+namespace i18n_check
+    {
+    /** @brief Splits C-style source code into tokens (identifiers, literals, punctuation,
+            comments, and preprocessor directives), recording where each one is.
+        @details This is a lightweight lexer, meant for checks that look for code constructs
+            (e.g., a function call or an ID assignment) across a whole file. Rather than
+            each check searching the file's text with its own regex, the text is tokenized
+            once and the checks only look at (or run their regex from) the tokens
+            that they are interested in.\n
+            It does not validate the code; anything that it doesn't recognize is returned
+            as a single-character punctuation token.
+        @note The tokens only refer to the text by position, so the text must outlive
+            the token stream.
+        @par Example:
+        @code
+         const token_stream tokens{ fileText };
+         for (const auto& token : tokens)
+            {
+            if (token.m_type == token_stream::token_type::identifier &&
+                tokens.get_text(token) == L"LoadString")
+                { ... }
+            }
+        @endcode*/
+    class token_stream
+        {
+      public:
+        /// @brief The types of tokens.
+        enum class token_type : uint8_t
+            {
+            /// @brief A name, made up of 7-bit letters, numbers, and underscores
+            ///     (see i18n_review::is_valid_name_char()).
+            identifier,
+            /// @brief A number (including suffixes and digit separators, like @c 1'000UL).
+            number,
+            /// @brief A string literal (including its prefix, like @c L or @c u8R).
+            string_literal,
+            /// @brief A character literal.
+            char_literal,
+            /// @brief A single punctuation character (or any other character).
+            punctuation,
+            /// @brief A line or block comment.
+            comment,
+            /// @brief A @c # at the start of a line and its directive name (e.g., "#define").
+            ///     The rest of the line is tokenized normally.
+            preprocessor
+            };
+
+        /// @brief A token's type and where it is in the text.
+        struct token
+            {
+            /// @brief The type of token.
+            token_type m_type{ token_type::punctuation };
+            /// @brief The position of the token in the text.
+            size_t m_position{ 0 };
+            /// @brief The length of the token.
+            size_t m_length{ 0 };
+            };
+
+        /// @brief Tokenizes text.
+        /// @param text The text to tokenize.
+        /// @param resource Where to allocate the tokens (e.g., an analyzer's scratch arena).
+        explicit token_stream(
+            std::wstring_view text,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+        /// @returns The text that was tokenized.
+        [[nodiscard]]
+        std::wstring_view get_text() const noexcept
+            {
+            return m_text;
+            }
+
+        /// @returns The text of a token.
+        /// @param tok The token.
+        [[nodiscard]]
+        std::wstring_view get_text(const token& tok) const noexcept
+            {
+            return m_text.substr(tok.m_position, tok.m_length);
+            }
+
+        /// @returns The tokens, in the order they appear in the text.
+        [[nodiscard]]
+        const std::pmr::vector<token>& get_tokens() const noexcept
+            {
+            return m_tokens;
+            }
+
+        /// @returns An iterator to the first token.
+        [[nodiscard]]
+        std::pmr::vector<token>::const_iterator begin() const noexcept
+            {
+            return m_tokens.cbegin();
+            }
+
+        /// @returns An iterator past the last token.
+        [[nodiscard]]
+        std::pmr::vector<token>::const_iterator end() const noexcept
+            {
+            return m_tokens.cend();
+            }
+
+      private:
+        void tokenize();
+
+        /// @returns The end of a quoted literal that starts at @c pos (the opening quote).
+        [[nodiscard]]
+        size_t find_quote_end(size_t pos) const noexcept;
+        /// @returns The end of a raw string that starts at @c pos (the opening quote).
+        [[nodiscard]]
+        size_t find_raw_string_end(size_t pos) const noexcept;
+
+        std::wstring_view m_text;
+        std::pmr::vector<token> m_tokens;
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__TOKEN_STREAM_H__
@@ -12,6 +12,8 @@
  ********************************************************************************/
 
 #include "translation_catalog_review.h"
+#include "results_cache.h"
+#include <limits>
 
 namespace i18n_check
     {
@@ -48,15 +50,33 @@ namespace i18n_check
                 {
                 return;
                 }
+            // shared by the l10n strings and excessive content checks
+            std::pair<bool, size_t> sourceClassification{ false, 0 };
+            std::pair<bool, size_t> sourcePluralClassification{ false, 0 };
+            if (static_cast<bool>(m_review_styles & (check_l10n_strings |
+                                                     check_l10n_contains_excessive_nonl10n_content)))
+                {
+                I18N_PROFILE_SCOPE(get_profile(),
+                                   static_cast<bool>(m_review_styles & check_l10n_strings) ?
+                                       check_l10n_strings :
+                                       check_l10n_contains_excessive_nonl10n_content,
+                                   1);
+                sourceClassification =
+                    classify_untranslatable_string(catEntry.second.m_source, false);
+                if (!catEntry.second.m_source_plural.empty())
+                    {
+                    sourcePluralClassification =
+                        classify_untranslatable_string(catEntry.second.m_source_plural, false);
+                    }
+                }
             if (static_cast<bool>(m_review_styles & check_l10n_strings))
                 {
-                if (is_untranslatable_string(catEntry.second.m_source, false).first)
+                if (sourceClassification.first)
                     {
                     catEntry.second.m_issues.emplace_back(translation_issue::suspect_source_issue,
                                                           catEntry.second.m_source);
                     }
-                if (!catEntry.second.m_source_plural.empty() &&
-                    is_untranslatable_string(catEntry.second.m_source_plural, false).first)
+                if (sourcePluralClassification.first)
                     {
                     catEntry.second.m_issues.emplace_back(translation_issue::suspect_source_issue,
                                                           catEntry.second.m_source_plural);
@@ -64,15 +84,14 @@ namespace i18n_check
                 }
             if (static_cast<bool>(m_review_styles & check_l10n_contains_url))
                 {
-                std::wsmatch results;
-
-                if (std::regex_search(catEntry.second.m_source, results, m_url_email_regex))
+                I18N_PROFILE_SCOPE(get_profile(), check_l10n_contains_url, 1);
+                if (m_url_email_regex.search(catEntry.second.m_source))
                     {
                     catEntry.second.m_issues.emplace_back(translation_issue::suspect_source_issue,
                                                           catEntry.second.m_source);
                     }
                 if (!catEntry.second.m_source_plural.empty() &&
-                    std::regex_search(catEntry.second.m_source_plural, results, m_url_email_regex))
+                    m_url_email_regex.search(catEntry.second.m_source_plural))
                     {
                     catEntry.second.m_issues.emplace_back(translation_issue::suspect_source_issue,
                                                           catEntry.second.m_source_plural);
@@ -81,8 +100,7 @@ namespace i18n_check
             if (static_cast<bool>(m_review_styles & check_l10n_contains_excessive_nonl10n_content))
                 {
                 if (const auto [isunTranslatable, translatableContentLength] =
-                        is_untranslatable_string(catEntry.second.m_source, false);
-                    (m_review_styles & check_l10n_contains_excessive_nonl10n_content) &&
+                        sourceClassification;
                     !isunTranslatable &&
                     catEntry.second.m_source.length() > (translatableContentLength * 3) &&
                     catEntry.second.m_comment.empty())
@@ -92,8 +110,7 @@ namespace i18n_check
                     }
 
                 if (const auto [isunTranslatable, translatableContentLength] =
-                        is_untranslatable_string(catEntry.second.m_source_plural, false);
-                    (m_review_styles & check_l10n_contains_excessive_nonl10n_content) &&
+                        sourcePluralClassification;
                     !isunTranslatable &&
                     catEntry.second.m_source_plural.length() > (translatableContentLength * 3) &&
                     catEntry.second.m_comment.empty())
@@ -105,6 +122,7 @@ namespace i18n_check
                 }
             if (static_cast<bool>(m_review_styles & check_l10n_concatenated_strings))
                 {
+                I18N_PROFILE_SCOPE(get_profile(), check_l10n_concatenated_strings, 1);
                 if (has_surrounding_spaces(catEntry.second.m_source))
                     {
                     catEntry.second.m_issues.emplace_back(translation_issue::concatenation_issue,
@@ -119,8 +137,11 @@ namespace i18n_check
                 }
             if (static_cast<bool>(m_review_styles & check_needing_context))
                 {
+                I18N_PROFILE_SCOPE(get_profile(), check_needing_context, 1);
                 if (catEntry.second.m_comment.empty() &&
-                    is_string_ambiguous(catEntry.second.m_source))
+                    classify_string(catEntry.second.m_source, string_verdict::ambiguous,
+                                    [&catEntry]()
+                                    { return is_string_ambiguous(catEntry.second.m_source); }))
                     {
                     catEntry.second.m_issues.emplace_back(
                         translation_issue::source_needing_context_issue, catEntry.second.m_source);
@@ -128,7 +149,10 @@ namespace i18n_check
                 }
             if (static_cast<bool>(m_review_styles & check_multipart_strings))
                 {
-                if (is_string_multipart(catEntry.second.m_source))
+                I18N_PROFILE_SCOPE(get_profile(), check_multipart_strings, 1);
+                if (classify_string(catEntry.second.m_source, string_verdict::multipart,
+                                    [&catEntry]()
+                                    { return is_string_multipart(catEntry.second.m_source); }))
                     {
                     catEntry.second.m_issues.emplace_back(translation_issue::multipart_string,
                                                           catEntry.second.m_source);
@@ -136,7 +160,10 @@ namespace i18n_check
                 }
             if (static_cast<bool>(m_review_styles & check_pluaralization))
                 {
-                if (is_string_faux_plural(catEntry.second.m_source))
+                I18N_PROFILE_SCOPE(get_profile(), check_pluaralization, 1);
+                if (classify_string(catEntry.second.m_source, string_verdict::faux_plural,
+                                    [&catEntry]()
+                                    { return is_string_faux_plural(catEntry.second.m_source); }))
                     {
                     catEntry.second.m_issues.emplace_back(translation_issue::pluralization,
                                                           catEntry.second.m_source);
@@ -144,6 +171,7 @@ namespace i18n_check
                 }
             if (static_cast<bool>(m_review_styles & check_articles_proceeding_placeholder))
                 {
+                I18N_PROFILE_SCOPE(get_profile(), check_articles_proceeding_placeholder, 1);
                 if (is_string_article_issue(catEntry.second.m_source) ||
                     is_string_pronoun(catEntry.second.m_source))
                     {
@@ -153,6 +181,7 @@ namespace i18n_check
                 }
             if (static_cast<bool>(m_review_styles & check_mismatching_printf_commands))
                 {
+                I18N_PROFILE_SCOPE(get_profile(), check_mismatching_printf_commands, 1);
                 if (catEntry.second.m_po_format == po_format_string::cpp_format)
                     {
                     // only look at strings that have a translation
@@ -231,6 +260,9 @@ namespace i18n_check
             if (static_cast<bool>(m_review_styles & check_accelerators) ||
                 static_cast<bool>(m_review_styles & check_malformed_strings))
                 {
+                I18N_PROFILE_SCOPE(get_profile(),
+                                   m_review_styles & (check_accelerators | check_malformed_strings),
+                                   1);
                 const auto reviewAccelerators =
                     [&catEntry, &srcResults, &transResults, &reMatches, this](auto src, auto trans)
                 {
@@ -283,6 +315,7 @@ namespace i18n_check
 
             if (static_cast<bool>(m_review_styles & check_length))
                 {
+                I18N_PROFILE_SCOPE(get_profile(), check_length, 1);
                 // the length that a translation can be longer than the source
                 const double lengthFactor{ (get_translation_length_threshold() + 100) /
                                            static_cast<double>(100) };
@@ -309,6 +342,7 @@ namespace i18n_check
 
             if (static_cast<bool>(m_review_styles & check_halfwidth))
                 {
+                I18N_PROFILE_SCOPE(get_profile(), check_halfwidth, 1);
                 const auto reviewHW =
                     [&catEntry, &srcResults, &transResults, &unrollStrings](auto src, auto trans)
                 {
@@ -341,6 +375,7 @@ namespace i18n_check
 
             if (static_cast<bool>(m_review_styles & check_numbers))
                 {
+                I18N_PROFILE_SCOPE(get_profile(), check_numbers, 1);
                 const auto reviewNumbers = [&catEntry, &printfStrings1, &printfStrings2,
                                             &unrollStrings](auto src, auto trans)
                 {
@@ -517,6 +552,7 @@ namespace i18n_check
 
             if (static_cast<bool>(m_review_styles & check_consistency))
                 {
+                I18N_PROFILE_SCOPE(get_profile(), check_consistency, 1);
                 const auto reviewConsistency =
                     [&catEntry, &srcResults, &transResults](auto src, auto trans)
                 {
@@ -582,4 +618,120 @@ namespace i18n_check
                 }
             }
         }
+
+    //------------------------------------------------
+    void translation_catalog_review::write_results(std::ostream& stream,
+                                                   const std::filesystem::path& filePath) const
+        {
+        i18n_review::write_results(stream, filePath);
+
+        write_cache_value(stream, m_catalog_entries.size());
+        for (const auto& [entryFile, entry] : m_catalog_entries)
+            {
+            write_cache_string(stream,
+                               (entryFile == filePath) ? std::wstring{} : entryFile.wstring());
+            write_cache_string(stream, entry.m_source);
+            write_cache_string(stream, entry.m_source_plural);
+            write_cache_string(stream, entry.m_translation);
+            write_cache_string(stream, entry.m_translation_plural);
+            write_cache_value(stream, static_cast<uint64_t>(entry.m_po_format));
+            write_cache_value(stream, entry.m_issues.size());
+            for (const auto& [issue, issueInfo] : entry.m_issues)
+                {
+                write_cache_value(stream, static_cast<uint64_t>(issue));
+                write_cache_string(stream, issueInfo);
+                }
+            write_cache_value(stream, entry.m_line);
+            write_cache_string(stream, entry.m_comment);
+            }
+        }
+
+    //------------------------------------------------
+    void translation_catalog_review::read_results(std::istream& stream,
+                                                  const std::filesystem::path& filePath)
+        {
+        i18n_review::read_results(stream, filePath);
+
+        const uint64_t entryCount{ read_cache_value(stream) };
+        for (uint64_t i = 0; i < entryCount; ++i)
+            {
+            const std::wstring entryFile{ read_cache_string(stream) };
+            translation_catalog_entry entry;
+            entry.m_source = read_cache_string(stream);
+            entry.m_source_plural = read_cache_string(stream);
+            entry.m_translation = read_cache_string(stream);
+            entry.m_translation_plural = read_cache_string(stream);
+            const uint64_t poFormat{ read_cache_value(stream) };
+            if (poFormat > static_cast<uint64_t>(po_format_string::qt_format))
+                {
+                throw std::runtime_error("Cached results contain an unknown printf format.");
+                }
+            entry.m_po_format = static_cast<po_format_string>(poFormat);
+            const uint64_t issueCount{ read_cache_value(stream) };
+            for (uint64_t j = 0; j < issueCount; ++j)
+                {
+                const uint64_t issue{ read_cache_value(stream) };
+                if (issue > static_cast<uint64_t>(translation_issue::article_issue))
+                    {
+                    throw std::runtime_error("Cached results contain an unknown issue type.");
+                    }
+                entry.m_issues.emplace_back(static_cast<translation_issue>(issue),
+                                            read_cache_string(stream));
+                }
+            entry.m_line = static_cast<size_t>(read_cache_value(stream));
+            entry.m_comment = read_cache_string(stream);
+            m_catalog_entries.emplace_back(
+                entryFile.empty() ? filePath : std::filesystem::path{ entryFile },
+                std::move(entry));
+            }
+        }
+
+    //------------------------------------------------
+    void translation_catalog_review::remove_results_outside_changed_lines()
+        {
+        i18n_review::remove_results_outside_changed_lines();
+        if (get_changed_lines() == nullptr)
+            {
+            return;
+            }
+
+        // an entry's line is where it ends, so it spans from the end of the
+        // previous entry (in the same file) to there
+        std::vector<std::pair<std::filesystem::path, translation_catalog_entry>> changedEntries;
+        std::filesystem::path previousFile;
+        size_t previousLine{ 0 };
+        for (auto& entry : m_catalog_entries)
+            {
+            if (previousFile != entry.first)
+                {
+                previousFile = entry.first;
+                previousLine = 0;
+                }
+            const size_t firstLine{ previousLine + 1 };
+            const size_t lastLine{ (entry.second.m_line == std::wstring::npos) ?
+                                       std::numeric_limits<size_t>::max() :
+                                       std::max(entry.second.m_line, firstLine) };
+            if (entry.second.m_line != std::wstring::npos)
+                {
+                previousLine = entry.second.m_line;
+                }
+
+            const auto changedFile = get_changed_lines()->find(entry.first);
+            if (changedFile == get_changed_lines()->cend())
+                {
+                continue;
+                }
+            // find the first changed range ending at (or after) the entry's start,
+            // and see if it begins before the entry's end
+            const auto changedRange = std::lower_bound(
+                changedFile->second.cbegin(), changedFile->second.cend(), firstLine,
+                [](const std::pair<size_t, size_t>& range, const size_t value)
+                { return range.second < value; });
+            if (changedRange != changedFile->second.cend() && changedRange->first <= lastLine)
+                {
+                changedEntries.push_back(std::move(entry));
+                }
+            }
+        m_catalog_entries = std::move(changedEntries);
+        }
     } // namespace i18n_check
@@ -62,6 +62,42 @@ namespace i18n_check
         void review_strings(analyze_callback_reset resetCallback,
                             analyze_callback callback) override;
 
+        /// @brief Clears the results.
+        void clear_results() override
+            {
+            i18n_review::clear_results();
+            m_catalog_entries.clear();
+            }
+
+        /// @brief Moves the catalog entries from other catalog analyzers into this one.
+        /// @param analyzers The analyzers to move results from.
+        /// @param fileIndex Function returning a file's position in the original list of files.
+        void merge_results(const std::vector<i18n_review*>& analyzers,
+                           const file_index_callback& fileIndex) override
+            {
+            i18n_review::merge_results(analyzers, fileIndex);
+            merge_results_by_file(
+                &translation_catalog_review::m_catalog_entries, analyzers, fileIndex,
+                [](const std::pair<std::filesystem::path, translation_catalog_entry>& entry)
+                    -> const std::filesystem::path& { return entry.first; });
+            }
+
+        /// @brief Removes the results (and catalog entries) that are not on the
+        ///     lines set by set_changed_lines().
+        /// @details Catalog entries are kept if any of their lines were changed.
+        void remove_results_outside_changed_lines() override;
+
+        /// @brief Writes the results (from `operator()`) to a stream, so that they can be cached.
+        /// @param stream The stream to write to.
+        /// @param filePath The file that was reviewed.
+        void write_results(std::ostream& stream,
+                           const std::filesystem::path& filePath) const override;
+
+        /// @brief Reads results written by write_results() and adds them to this analyzer.
+        /// @param stream The stream to read from.
+        /// @param filePath The file that the results are for.
+        void read_results(std::istream& stream, const std::filesystem::path& filePath) override;
+
       private:
         void operator()([[maybe_unused]] std::wstring_view,
                         [[maybe_unused]] const std::filesystem::path&) override
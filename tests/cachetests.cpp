@@ -0,0 +1,103 @@
+#include "../src/cpp_i18n_review.h"
+#include "../src/results_cache.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+
+// NOLINTBEGIN
+using namespace i18n_check;
+using namespace Catch::Matchers;
+
+// clang-format off
+TEST_CASE("Cached Results", "[cache]")
+    {
+    SECTION("Round Trip")
+        {
+        const wchar_t* code = LR"(auto var = _("Hello, world"); MessageBox(_("Printer not ready"));
+    wxString str = wxT("Hello there, world!");
+    auto label = _("Here\t is a tab");)";
+
+        cpp_i18n_review cpp(false);
+        cpp.set_style(all_l10n_checks);
+        cpp(code, L"file1.cpp");
+
+        std::stringstream results;
+        cpp.write_results(results, L"file1.cpp");
+
+        // results are read back for another file with the same content
+        auto cachedCpp = cpp.clone();
+        cachedCpp->read_results(results, L"file2.cpp");
+
+        REQUIRE(cpp.get_localizable_strings().size() == 3);
+        REQUIRE(cachedCpp->get_localizable_strings().size() == 3);
+        for (size_t i = 0; i < cpp.get_localizable_strings().size(); ++i)
+            {
+            const auto& str = cpp.get_localizable_strings()[i];
+            const auto& cachedStr = cachedCpp->get_localizable_strings()[i];
+            CHECK(str.m_string == cachedStr.m_string);
+            CHECK(str.m_usage.m_value == cachedStr.m_usage.m_value);
+            CHECK(str.m_usage.m_type == cachedStr.m_usage.m_type);
+            CHECK(str.m_line == cachedStr.m_line);
+            CHECK(str.m_column == cachedStr.m_column);
+            CHECK(cachedStr.m_file_name == std::filesystem::path{ L"file2.cpp" });
+            }
+        CHECK(cpp.get_not_available_for_localization_strings().size() ==
+              cachedCpp->get_not_available_for_localization_strings().size());
+        }
+
+    SECTION("Truncated")
+        {
+        cpp_i18n_review cpp(false);
+        cpp(LR"(auto var = _("Hello, world");)", L"file1.cpp");
+
+        std::stringstream results;
+        cpp.write_results(results, L"file1.cpp");
+        std::stringstream truncatedResults(results.str().substr(0, results.str().length() / 2));
+        auto cachedCpp = cpp.clone();
+        CHECK_THROWS_AS(cachedCpp->read_results(truncatedResults, L"file1.cpp"),
+                        std::runtime_error);
+        }
+
+    SECTION("Cache Folder")
+        {
+        const auto cacheFolder =
+            std::filesystem::temp_directory_path() / L"quneiform-cache-test";
+        std::filesystem::remove_all(cacheFolder);
+
+        const results_cache cache(cacheFolder, 1);
+        const auto contentHash = results_cache::hash_content("auto var = 1;");
+        CHECK_FALSE(cache.load(file_review_type::cpp, contentHash).has_value());
+        cache.store(file_review_type::cpp, contentHash, "results");
+        REQUIRE(cache.load(file_review_type::cpp, contentHash).has_value());
+        CHECK(cache.load(file_review_type::cpp, contentHash).value() == "results");
+        // different file types and settings are different entries
+        CHECK_FALSE(cache.load(file_review_type::cs, contentHash).has_value());
+        CHECK_FALSE(results_cache(cacheFolder, 2).load(file_review_type::cpp, contentHash));
+
+        std::filesystem::remove_all(cacheFolder);
+        }
+
+    SECTION("Settings Hash")
+        {
+        cpp_i18n_review cpp(false);
+        cpp_i18n_review cpp2(false);
+        CHECK(cpp.get_settings_hash() == cpp2.get_settings_hash());
+        cpp2.set_min_words_for_classifying_unavailable_string(3);
+        CHECK(cpp.get_settings_hash() != cpp2.get_settings_hash());
+        cpp2.set_min_words_for_classifying_unavailable_string(
+            cpp.get_min_words_for_classifying_unavailable_string());
+        cpp2.set_style(check_tabs);
+        CHECK(cpp.get_settings_hash() != cpp2.get_settings_hash());
+        cpp2.set_style(cpp.get_style());
+        CHECK(cpp.get_settings_hash() == cpp2.get_settings_hash());
+        // the client's variable name patterns
+        cpp.add_variable_name_pattern_to_ignore(L"^msg.*");
+        cpp2.add_variable_name_pattern_to_ignore(L"^text.*");
+        CHECK(cpp.get_settings_hash() != cpp2.get_settings_hash());
+        }
+    }
+
+// NOLINTEND
+// clang-format on
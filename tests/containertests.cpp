@@ -0,0 +1,202 @@
+#include "../src/cpp_i18n_review.h"
+#include "../src/flat_string_set.h"
+#include "../src/interned_string.h"
+#include "../src/issue_store.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace i18n_check;
+using namespace Catch::Matchers;
+
+// clang-format off
+TEST_CASE("Interned Strings", "[containers]")
+    {
+    SECTION("Strings")
+        {
+        const interned_string first{ L"MessageBox" };
+        const interned_string second{ std::wstring{ L"MessageBox" } };
+        CHECK(&first.get() == &second.get());
+        CHECK(first == second);
+        CHECK(first == L"MessageBox");
+        CHECK(first == std::wstring{ L"MessageBox" });
+        CHECK(first != interned_string{ L"wxMessageBox" });
+        CHECK(first < interned_string{ L"wxMessageBox" });
+        CHECK(first.length() == 10);
+        CHECK(interned_string{}.empty());
+        CHECK(interned_string{ L"" } == interned_string{});
+        std::wstringstream stream;
+        stream << first;
+        CHECK(stream.str() == L"MessageBox");
+        }
+
+    SECTION("Paths")
+        {
+        const interned_path first{ std::filesystem::path{ L"src/file.cpp" } };
+        const interned_path second{ L"src/file.cpp" };
+        CHECK(&first.get() == &second.get());
+        CHECK(first == second);
+        CHECK(first == std::filesystem::path{ L"src/file.cpp" });
+        CHECK(first.filename() == std::filesystem::path{ L"file.cpp" });
+        CHECK(interned_path{}.empty());
+        // written the same as a std::filesystem::path
+        std::wstringstream pathStream, internedStream;
+        pathStream << std::filesystem::path{ L"src/file.cpp" };
+        internedStream << first;
+        CHECK(pathStream.str() == internedStream.str());
+        }
+
+    SECTION("Results")
+        {
+        cpp_i18n_review cpp(false);
+        cpp(LR"(auto var = _("Open the file"); auto var2 = _("Close the file");)", L"file.cpp");
+        REQUIRE(cpp.get_localizable_strings().size() == 2);
+        const auto& results = cpp.get_localizable_strings();
+        // results from the same file (and function) share the same path (and name)
+        CHECK(&results[0].m_file_name.get() == &results[1].m_file_name.get());
+        CHECK(&results[0].m_usage.m_value.get() == &results[1].m_usage.m_value.get());
+        CHECK(results[0].m_usage.m_value == L"_");
+        }
+    }
+
+TEST_CASE("Issue Store", "[containers]")
+    {
+    SECTION("Categories")
+        {
+        issue_store<std::wstring, 3> store;
+        const auto first = store.add(0, L"first");
+        const auto second = store.add(0, L"second");
+        store.add(1, L"third");
+        store.add_existing(2, second);
+        store.add_existing(2, first);
+        CHECK(store.size() == 3);
+        CHECK(store.get(0).size() == 2);
+        CHECK(store.get(1).size() == 1);
+        // categories keep the order that strings were added to them
+        REQUIRE(store.get(2).size() == 2);
+        CHECK(store.get(2)[0] == L"second");
+        CHECK(store.get(2)[1] == L"first");
+        // a string in multiple categories is only stored once
+        CHECK(&store.get(2)[0] == &store.get(0)[1]);
+        CHECK(store.get_issues(second).test(0));
+        CHECK_FALSE(store.get_issues(second).test(1));
+        CHECK(store.get_issues(second).test(2));
+        const auto view = store.get(0);
+        CHECK(std::vector<std::wstring>(view.begin(), view.end()) ==
+              std::vector<std::wstring>{ L"first", L"second" });
+        store.clear();
+        CHECK(store.size() == 0);
+        CHECK(store.get(2).empty());
+        }
+
+    SECTION("Remove")
+        {
+        issue_store<std::wstring, 2> store;
+        store.add(0, L"keep");
+        const auto removed = store.add(0, L"remove");
+        const auto kept = store.add(0, L"keep too");
+        store.add_existing(1, kept);
+        store.add_existing(1, removed);
+        store.remove_if([](const std::wstring& str) { return str == L"remove"; });
+        CHECK(store.size() == 2);
+        REQUIRE(store.get(0).size() == 2);
+        CHECK(store.get(0)[1] == L"keep too");
+        REQUIRE(store.get(1).size() == 1);
+        CHECK(store.get(1)[0] == L"keep too");
+        }
+
+    SECTION("Merge")
+        {
+        // the strings' first letter is the file that they are from
+        issue_store<std::wstring, 2> merged, worker1, worker2;
+        merged.add(0, L"0-existing");
+        worker1.add(0, L"2-first");
+        worker1.add_existing(1, worker1.add(0, L"1-first"));
+        worker2.add_existing(1, worker2.add(0, L"1-second"));
+        worker2.add(0, L"3-first");
+        merged.merge({ &worker1, &worker2 },
+                     [](const std::wstring& str) { return static_cast<size_t>(str[0] - L'0'); });
+        CHECK(merged.size() == 5);
+        CHECK(worker1.size() == 0);
+        CHECK(worker2.get(0).empty());
+        const auto view = merged.get(0);
+        // new strings are sorted by file (keeping their order within a file), after the
+        // strings already in the store
+        CHECK(std::vector<std::wstring>(view.begin(), view.end()) ==
+              std::vector<std::wstring>{ L"0-existing", L"1-first", L"1-second", L"2-first",
+                                         L"3-first" });
+        REQUIRE(merged.get(1).size() == 2);
+        CHECK(merged.get(1)[0] == L"1-first");
+        CHECK(merged.get(1)[1] == L"1-second");
+        CHECK(&merged.get(1)[1] == &merged.get(0)[2]);
+        }
+
+    SECTION("Analyzer")
+        {
+        cpp_i18n_review cpp(false);
+        cpp.set_style(all_i18n_checks);
+        cpp(LR"(auto var = _("Visit https://www.example.com for details."))", L"file.cpp");
+        cpp.review_strings([](size_t) {}, [](size_t, const std::filesystem::path&)
+                           { return true; });
+        REQUIRE(cpp.get_localizable_strings().size() == 1);
+        REQUIRE(cpp.get_localizable_strings_with_urls().size() == 1);
+        // flagged strings refer to the extracted string rather than being copies of it
+        CHECK(&cpp.get_localizable_strings_with_urls()[0] == &cpp.get_localizable_strings()[0]);
+        }
+    }
+
+TEST_CASE("Flat String Set", "[containers]")
+    {
+    SECTION("Exact")
+        {
+        flat_string_set<> strs{ L"_", L"wxTRANSLATE", L"tr", L"_" };
+        CHECK(strs.size() == 3);
+        CHECK(strs.contains(L"_"));
+        CHECK(strs.contains(L"wxTRANSLATE"));
+        CHECK(strs.contains(L"wxtranslate") == false);
+        CHECK(strs.contains(L"t") == false);
+        CHECK(strs.contains(L"") == false);
+        CHECK(strs.insert(L"tr") == false);
+        CHECK(strs.insert(L"") == true);
+        CHECK(strs.contains(L""));
+        // keys are kept in the order that they were added
+        CHECK(std::vector<std::wstring>(strs.cbegin(), strs.cend()) ==
+              std::vector<std::wstring>{ L"_", L"wxTRANSLATE", L"tr", L"" });
+        }
+
+    SECTION("Growth")
+        {
+        flat_string_set<> strs;
+        CHECK(strs.empty());
+        CHECK(strs.contains(L"func0") == false);
+        for (size_t i = 0; i < 1'000; ++i)
+            {
+            CHECK(strs.insert(L"func" + std::to_wstring(i)));
+            }
+        CHECK(strs.size() == 1'000);
+        for (size_t i = 0; i < 1'000; ++i)
+            {
+            CHECK(strs.contains(L"func" + std::to_wstring(i)));
+            }
+        CHECK(strs.contains(L"func1000") == false);
+        }
+
+    SECTION("Case Insensitive")
+        {
+        case_insensitive_flat_string_set strs{ L"Arial", L"Times New Roman" };
+        CHECK(strs.contains(L"arial"));
+        CHECK(strs.contains(L"ARIAL"));
+        CHECK(strs.contains(L"times new ROMAN"));
+        CHECK(strs.contains(L"Arial Black") == false);
+        CHECK(strs.insert(L"ARIAL") == false);
+        CHECK(*strs.cbegin() == L"arial");
+        }
+    }
+
+// NOLINTEND
+// clang-format on
@@ -1,11 +1,17 @@
 #include "../src/cpp_i18n_review.h"
+#include "../src/input.h"
+#include "../src/results_cache.h"
 #include <algorithm>
+#include <atomic>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <chrono>
 #include <iomanip>
+#include <memory>
 #include <set>
 #include <sstream>
+#include <thread>
 
 // NOLINTBEGIN
 using namespace i18n_check;
@@ -890,6 +896,103 @@ wxStrlen)";
         CHECK(cpp.get_deprecated_macros()[0].m_line == 2);
         CHECK(cpp.get_deprecated_macros()[0].m_usage.m_value == L"Use std::wcslen() or (wrap in a std::wstring_view) instead of wxStrlen().");
         }
+
+    SECTION("Multiple Functions")
+        {
+        cpp_i18n_review cpp(false);
+        cpp.set_style(review_style::check_deprecated_macros);
+        // __tcserror is a prefix of __tcserror_s, and _tcscat of _tcscat_s
+        const wchar_t* code = LR"(_tcscat_s(a, b);_tcscat(a, b);
+__tcserror_s(buf); x__tcserror(); __tcserror(nullptr);
+_tfopen)";
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        REQUIRE(cpp.get_deprecated_macros().size() == 4);
+        CHECK(cpp.get_deprecated_macros()[0].m_string == L"_tcscat_s");
+        CHECK(cpp.get_deprecated_macros()[0].m_line == 1);
+        CHECK(cpp.get_deprecated_macros()[0].m_column == 1);
+        CHECK(cpp.get_deprecated_macros()[1].m_string == L"_tcscat");
+        CHECK(cpp.get_deprecated_macros()[1].m_line == 1);
+        CHECK(cpp.get_deprecated_macros()[1].m_column == 17);
+        CHECK(cpp.get_deprecated_macros()[1].m_usage.m_value == L"Use std::wcscat() instead of _tcscat().");
+        CHECK(cpp.get_deprecated_macros()[2].m_string == L"__tcserror_s");
+        CHECK(cpp.get_deprecated_macros()[2].m_line == 2);
+        CHECK(cpp.get_deprecated_macros()[2].m_column == 1);
+        CHECK(cpp.get_deprecated_macros()[3].m_string == L"__tcserror");
+        CHECK(cpp.get_deprecated_macros()[3].m_line == 2);
+        CHECK(cpp.get_deprecated_macros()[3].m_column == 35);
+        }
+
+    SECTION("Punctuation And Literals")
+        {
+        cpp_i18n_review cpp(false);
+        cpp.set_style(review_style::check_deprecated_macros);
+        // only the dereferenced wxConvCurrent is listed, and names in strings aren't calls
+        const wchar_t* code = LR"(auto conv = wxConvCurrent;
+auto str = wxString(buffer, *wxConvCurrent);
+auto msg = "wxStrlen() is deprecated";
+auto len = wxStrlen(msg);)";
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        REQUIRE(cpp.get_deprecated_macros().size() == 2);
+        CHECK(cpp.get_deprecated_macros()[0].m_string == L"*wxConvCurrent");
+        CHECK(cpp.get_deprecated_macros()[0].m_line == 2);
+        CHECK(cpp.get_deprecated_macros()[0].m_column == 29);
+        CHECK(cpp.get_deprecated_macros()[1].m_string == L"wxStrlen");
+        CHECK(cpp.get_deprecated_macros()[1].m_line == 4);
+        CHECK(cpp.get_deprecated_macros()[1].m_column == 12);
+        }
+    }
+
+// A wall-clock ratio, so hidden from the default run; run the test runner with "[benchmark]"
+// to include it.
+TEST_CASE("Scan Scaling", "[.][benchmark][cpp][i18n]")
+    {
+    // Look-aheads in the scanner (e.g., for the end of a comment or line) must stay within
+    // the text in front of them. If they search through (or measure) the rest of the file,
+    // then reviewing a file gets quadratically slower as it grows.
+    const auto makeCode = [](const size_t lineCount)
+    {
+        std::wstring code;
+        for (size_t i = 0; i < lineCount; ++i)
+            {
+            const std::wstring number{ std::to_wstring(i) };
+            code.append(L"#include \"file").append(number).append(L".h\"\n");
+            code.append(L"auto str").append(number).append(
+                L" = _(\"Hello there, friend\"); // a translatable string\n");
+            code.append(L"/* note */ int value")
+                .append(number)
+                .append(L" = compute_total(first_item, second_item) * factor;\n");
+            }
+        return code;
+    };
+    const auto timeReview = [](const std::wstring& code)
+    {
+        // the best of a few runs, to lessen the noise from whatever else the system is doing
+        auto bestTime{ std::chrono::steady_clock::duration::max() };
+        for (size_t i = 0; i < 3; ++i)
+            {
+            cpp_i18n_review cpp(false);
+            cpp.set_style(static_cast<review_style>(review_style::all_i18n_checks |
+                                                    review_style::all_l10n_checks |
+                                                    review_style::all_code_formatting_checks));
+            const auto start{ std::chrono::steady_clock::now() };
+            cpp(code, L"");
+            bestTime = std::min(bestTime, std::chrono::steady_clock::now() - start);
+            }
+        return bestTime;
+    };
+
+    // double the size of the file three times
+    const auto firstTime{ timeReview(makeCode(1'000)) };
+    auto lastTime{ firstTime };
+    for (size_t lineCount = 2'000; lineCount <= 8'000; lineCount *= 2)
+        {
+        lastTime = timeReview(makeCode(lineCount));
+        }
+    // 8x the text should take about 8x as long (quadratic growth would be 64x),
+    // but leave room for timing noise
+    CHECK(lastTime < firstTime * 24);
     }
 
 TEST_CASE("Code generator strings", "[i18n]")
@@ -1386,7 +1489,7 @@ TEST_CASE("Ignore", "[cpp]")
         {
         cpp_i18n_review cpp(false);
         const wchar_t* code = LR"(#define  DX_MSG   "Direct2D failed")";
-        cpp.add_variable_name_pattern_to_ignore(std::wregex(L"DX_MSG"));
+        cpp.add_variable_name_pattern_to_ignore(L"DX_MSG");
         cpp(code, L"");
         cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
         CHECK(cpp.get_localizable_strings().size() == 0);
@@ -1395,7 +1498,6 @@ TEST_CASE("Ignore", "[cpp]")
         CHECK(cpp.get_internal_strings()[0].m_string == std::wstring(L"Direct2D failed"));
         CHECK(cpp.get_internal_strings()[0].m_usage.m_value == std::wstring(L"DX_MSG"));
         CHECK(cpp.get_internal_strings()[0].m_usage.m_type == cpp_i18n_review::string_info::usage_info::usage_type::variable);
-        i18n_review::get_ignored_variable_patterns().clear();
         }
 
     SECTION("Var types to ignore")
@@ -2168,7 +2270,7 @@ TEST_CASE("Variable Assignment", "[cpp]")
     SECTION("Variable assignment with pattern")
         {
         cpp_i18n_review cpp(false);
-        cpp.add_variable_name_pattern_to_ignore(std::wregex(L"^test.*"));
+        cpp.add_variable_name_pattern_to_ignore(L"^test.*");
         const wchar_t* code = L"std::string testMessage = \"Enter your ID.\")";
         cpp(code, L"");
         cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
@@ -2179,7 +2281,6 @@ TEST_CASE("Variable Assignment", "[cpp]")
         CHECK(cpp.get_internal_strings()[0].m_string == L"Enter your ID.");
         CHECK(cpp.get_internal_strings()[0].m_usage.m_value == L"testMessage");
         CHECK(cpp.get_internal_strings()[0].m_usage.m_variableInfo.m_type == L"std::string");
-        i18n_review::get_ignored_variable_patterns().clear();
         }
 
     SECTION("Variable assignment array")
@@ -3314,5 +3415,613 @@ QString example = tr("UNTITLED");)";
         }
     }
 
+TEST_CASE("Line Index", "[cpp][i18n]")
+    {
+    SECTION("Line Breaks")
+        {
+        line_index lines;
+        lines.index(L"ab\r\ncd\ref\ngh");
+        CHECK(lines.get_line_and_column(0) == std::make_pair<size_t, size_t>(1, 1));
+        CHECK(lines.get_line_and_column(1) == std::make_pair<size_t, size_t>(1, 2));
+        CHECK(lines.get_line_and_column(2) == std::make_pair<size_t, size_t>(1, 3));
+        // LF of a CRLF is at the start of the next line
+        CHECK(lines.get_line_and_column(3) == std::make_pair<size_t, size_t>(2, 1));
+        CHECK(lines.get_line_and_column(4) == std::make_pair<size_t, size_t>(2, 1));
+        CHECK(lines.get_line_and_column(5) == std::make_pair<size_t, size_t>(2, 2));
+        CHECK(lines.get_line_and_column(7) == std::make_pair<size_t, size_t>(3, 1));
+        CHECK(lines.get_line_and_column(10) == std::make_pair<size_t, size_t>(4, 1));
+        CHECK(lines.get_line_and_column(11) == std::make_pair<size_t, size_t>(4, 2));
+        CHECK(lines.get_line_and_column(std::wstring::npos).first == std::wstring::npos);
+        }
+    SECTION("Empty")
+        {
+        line_index lines;
+        CHECK(lines.empty());
+        CHECK(lines.get_line_and_column(0).first == std::wstring::npos);
+        lines.index(L"");
+        CHECK(lines.get_line_and_column(0) == std::make_pair<size_t, size_t>(1, 1));
+        lines.clear();
+        CHECK(lines.empty());
+        }
+    SECTION("String Positions")
+        {
+        cpp_i18n_review cpp(false);
+        const wchar_t* code = L"// comment\r\n\r\nauto var = _(\"Hello, world\");\nauto var2 =\r  _(\"Printer not ready\");";
+        cpp(code, L"");
+        REQUIRE(cpp.get_localizable_strings().size() == 2);
+        CHECK(cpp.get_localizable_strings()[0].m_line == 3);
+        CHECK(cpp.get_localizable_strings()[0].m_column == 15);
+        CHECK(cpp.get_localizable_strings()[1].m_line == 5);
+        CHECK(cpp.get_localizable_strings()[1].m_column == 6);
+        }
+    }
+
+TEST_CASE("Merge Results", "[cpp][i18n]")
+    {
+    SECTION("Same As Sequential")
+        {
+        const wchar_t* code1 = LR"(auto var = _("Hello, world"); MessageBox(_("Printer not ready"));
+    wxString str = wxT("Hello there, world!"); auto wordCount = "Word count";)";
+        const wchar_t* code2 = LR"(auto tooltip = _("Open the file"); SetLabel("Save the file");
+    wxString::Format(_("%d files copied"), count);)";
+
+        cpp_i18n_review cpp(false);
+        cpp.set_style(all_l10n_checks);
+        cpp(code1, L"file1.cpp");
+        cpp(code2, L"file2.cpp");
+
+        // analyze the files (in reverse order) with separate copies of the analyzer
+        cpp_i18n_review mergedCpp(false);
+        mergedCpp.set_style(all_l10n_checks);
+        auto cpp1 = mergedCpp.clone();
+        auto cpp2 = mergedCpp.clone();
+        (*cpp1)(code2, L"file2.cpp");
+        (*cpp2)(code1, L"file1.cpp");
+        mergedCpp.merge_results({ cpp1.get(), cpp2.get() },
+            [](const std::filesystem::path& file) { return (file == L"file1.cpp") ? 0 : 1; });
+
+        const auto sameStrings = [](const i18n_review::results_view& lhs,
+                                    const i18n_review::results_view& rhs)
+            {
+            return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(),
+                [](const auto& first, const auto& second)
+                {
+                return first.m_string == second.m_string &&
+                    first.m_file_name == second.m_file_name &&
+                    first.m_line == second.m_line && first.m_column == second.m_column;
+                });
+            };
+
+        CHECK(cpp.get_localizable_strings().size() == 4);
+        CHECK(sameStrings(cpp.get_localizable_strings(), mergedCpp.get_localizable_strings()));
+        CHECK(sameStrings(cpp.get_not_available_for_localization_strings(),
+                          mergedCpp.get_not_available_for_localization_strings()));
+        CHECK(sameStrings(cpp.get_internal_strings(), mergedCpp.get_internal_strings()));
+        // results are moved out of the copies
+        CHECK(cpp1->get_localizable_strings().empty());
+        CHECK(cpp2->get_localizable_strings().empty());
+
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        mergedCpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(sameStrings(cpp.get_localizable_strings(), mergedCpp.get_localizable_strings()));
+        CHECK(sameStrings(cpp.get_not_available_for_localization_strings(),
+                          mergedCpp.get_not_available_for_localization_strings()));
+        }
+    }
+
+TEST_CASE("Review Buffer", "[cpp][i18n]")
+    {
+    SECTION("Same As Copy")
+        {
+        const wchar_t* code = LR"(/* a comment with "quotes" */
+auto var = _("Hello, world"); // "Not a string"
+    MessageBox(_("Printer not ready"));
+    wxString str = wxT("Hello there, world!");)";
+
+        cpp_i18n_review cpp(false);
+        cpp.set_style(all_l10n_checks);
+        cpp(code, L"file1.cpp");
+
+        cpp_i18n_review bufferCpp(false);
+        bufferCpp.set_style(all_l10n_checks);
+        std::wstring buffer{ code };
+        bufferCpp.review_buffer(buffer, L"file1.cpp");
+
+        REQUIRE(cpp.get_localizable_strings().size() == 2);
+        REQUIRE(bufferCpp.get_localizable_strings().size() == 2);
+        for (size_t i = 0; i < cpp.get_localizable_strings().size(); ++i)
+            {
+            CHECK(cpp.get_localizable_strings()[i].m_string ==
+                  bufferCpp.get_localizable_strings()[i].m_string);
+            CHECK(cpp.get_localizable_strings()[i].m_line ==
+                  bufferCpp.get_localizable_strings()[i].m_line);
+            CHECK(cpp.get_localizable_strings()[i].m_column ==
+                  bufferCpp.get_localizable_strings()[i].m_column);
+            }
+        CHECK(cpp.get_not_available_for_localization_strings().size() ==
+              bufferCpp.get_not_available_for_localization_strings().size());
+        // comments are blanked out of the buffer, but line breaks are kept
+        CHECK(buffer.find(L"a comment") == std::wstring::npos);
+        CHECK(std::count(buffer.cbegin(), buffer.cend(), L'\n') == 3);
+        }
+    }
+
+TEST_CASE("Changed Lines", "[cpp][i18n]")
+    {
+    SECTION("Read Diff")
+        {
+        const std::string_view diffText{ "diff --git a/src/app.cpp b/src/app.cpp\n"
+                                         "index 1234567..89abcde 100644\n"
+                                         "--- a/src/app.cpp\n"
+                                         "+++ b/src/app.cpp\n"
+                                         "@@ -1,4 +1,5 @@\n"
+                                         " int main()\n"
+                                         "-    {\n"
+                                         "+    {\n"
+                                         "+++ counter;\n"
+                                         "     return 0;\n"
+                                         "     }\n"
+                                         "@@ -20 +21,2 @@ void func()\n"
+                                         "-old\n"
+                                         "+new\n"
+                                         "+newer\n"
+                                         "\\ No newline at end of file\n"
+                                         "diff --git a/removed.cpp b/removed.cpp\n"
+                                         "--- a/removed.cpp\n"
+                                         "+++ /dev/null\n"
+                                         "@@ -1 +0,0 @@\n"
+                                         "-int i;\n"
+                                         "diff --git a/trimmed.cpp b/trimmed.cpp\n"
+                                         "--- a/trimmed.cpp\n"
+                                         "+++ b/trimmed.cpp\n"
+                                         "@@ -3,2 +3 @@\n"
+                                         " int i;\n"
+                                         "-int j;\n" };
+        const auto changedLines = read_unified_diff(diffText, L"project");
+        REQUIRE(changedLines.size() == 1);
+        const auto changedFile =
+            changedLines.find(std::filesystem::path{ L"project/src/app.cpp" }.lexically_normal());
+        REQUIRE(changedFile != changedLines.cend());
+        CHECK(changedFile->second == line_ranges{ { 2, 3 }, { 21, 22 } });
+        CHECK(is_line_in_ranges(changedFile->second, 3));
+        CHECK(is_line_in_ranges(changedFile->second, 21));
+        CHECK_FALSE(is_line_in_ranges(changedFile->second, 1));
+        CHECK_FALSE(is_line_in_ranges(changedFile->second, 4));
+        CHECK_FALSE(is_line_in_ranges(changedFile->second, 23));
+        }
+
+    SECTION("Read Diff Paths")
+        {
+        // quoted paths with escapes (\303\251 is é in UTF-8)
+        const std::string_view quotedDiff{ "diff --git \"a/\\303\\251.cpp\" \"b/\\303\\251.cpp\"\n"
+                                           "--- \"a/\\303\\251.cpp\"\n"
+                                           "+++ \"b/\\303\\251.cpp\"\n"
+                                           "@@ -1 +1 @@\n"
+                                           "-int i;\n"
+                                           "+int j;\n"
+                                           "diff --git \"a/tab\\there \\\"q\\\".cpp\" "
+                                           "\"b/tab\\there \\\"q\\\".cpp\"\n"
+                                           "--- /dev/null\n"
+                                           "+++ \"b/tab\\there \\\"q\\\".cpp\"\n"
+                                           "@@ -0,0 +1 @@\n"
+                                           "+int i;\n" };
+        auto changedLines = read_unified_diff(quotedDiff, L"project");
+        CHECK(changedLines.size() == 2);
+        CHECK(changedLines.contains(
+            std::filesystem::path{ u8"project/\u00E9.cpp" }.lexically_normal()));
+        CHECK(changedLines.contains(
+            std::filesystem::path{ L"project/tab\there \"q\".cpp" }.lexically_normal()));
+
+        // without git's prefixes, a "b" folder is kept
+        const std::string_view noPrefixDiff{ "diff --git b/app.cpp b/app.cpp\n"
+                                             "--- b/app.cpp\n"
+                                             "+++ b/app.cpp\n"
+                                             "@@ -1 +1 @@\n"
+                                             "-int i;\n"
+                                             "+int j;\n" };
+        changedLines = read_unified_diff(noPrefixDiff, L"project");
+        CHECK(changedLines.contains(
+            std::filesystem::path{ L"project/b/app.cpp" }.lexically_normal()));
+
+        // a diff not from git
+        const std::string_view plainDiff{ "--- b/app.cpp\t2025-01-01 10:00:00\n"
+                                          "+++ b/app.cpp\t2025-01-02 10:00:00\n"
+                                          "@@ -1 +1 @@\n"
+                                          "-int i;\n"
+                                          "+int j;\n" };
+        changedLines = read_unified_diff(plainDiff, L"project");
+        CHECK(changedLines.contains(
+            std::filesystem::path{ L"project/b/app.cpp" }.lexically_normal()));
+        }
+
+    SECTION("Line Checks")
+        {
+        const wchar_t* code = L"int\ti;\nint\tj;\nint\tk;\n";
+        cpp_i18n_review cpp(false);
+        cpp.set_style(check_tabs);
+        cpp.set_changed_lines(std::make_shared<const changed_lines_map>(
+            changed_lines_map{ { L"file1.cpp", line_ranges{ { 2, 2 } } } }));
+        cpp(code, L"file1.cpp");
+        REQUIRE(cpp.get_tabs().size() == 1);
+        CHECK(cpp.get_tabs()[0].m_line == 2);
+
+        // files that weren't changed aren't checked at all
+        cpp.clear_results();
+        cpp(code, L"file2.cpp");
+        CHECK(cpp.get_tabs().empty());
+        }
+
+    SECTION("Cache Keys")
+        {
+        cpp_i18n_review cpp(false);
+        const cpp_i18n_review cpp2(false);
+        const uint64_t contentHash{ results_cache::hash_content("int i;") };
+        CHECK(cpp.combine_changed_lines_hash(contentHash, L"file1.cpp") == contentHash);
+        cpp.set_changed_lines(std::make_shared<const changed_lines_map>(
+            changed_lines_map{ { L"file1.cpp", line_ranges{ { 2, 2 } } },
+                               { L"file2.cpp", line_ranges{ { 5, 8 } } } }));
+        // a file's changed lines are part of its own key, not the settings
+        CHECK(cpp.get_settings_hash() == cpp2.get_settings_hash());
+        const uint64_t file1Hash{ cpp.combine_changed_lines_hash(contentHash, L"file1.cpp") };
+        const uint64_t file2Hash{ cpp.combine_changed_lines_hash(contentHash, L"file2.cpp") };
+        const uint64_t file3Hash{ cpp.combine_changed_lines_hash(contentHash, L"file3.cpp") };
+        CHECK(file1Hash != contentHash);
+        CHECK(file1Hash != file2Hash);
+        CHECK(file3Hash != contentHash);
+        CHECK(file3Hash != file1Hash);
+        // changing another file's lines doesn't change this one's key
+        cpp.set_changed_lines(std::make_shared<const changed_lines_map>(
+            changed_lines_map{ { L"file1.cpp", line_ranges{ { 2, 2 } } },
+                               { L"file2.cpp", line_ranges{ { 6, 8 } } } }));
+        CHECK(cpp.combine_changed_lines_hash(contentHash, L"file1.cpp") == file1Hash);
+        CHECK(cpp.combine_changed_lines_hash(contentHash, L"file2.cpp") != file2Hash);
+        }
+
+    SECTION("Remove Results")
+        {
+        const wchar_t* code = LR"(auto var = _("Hello, world");
+auto var2 = _("Goodbye, world");
+auto var3 = _("Hello again, world");)";
+        cpp_i18n_review cpp(false);
+        cpp.set_style(all_l10n_checks);
+        cpp.set_changed_lines(std::make_shared<const changed_lines_map>(
+            changed_lines_map{ { L"file1.cpp", line_ranges{ { 2, 3 } } } }));
+        cpp(code, L"file1.cpp");
+        cpp.review_strings([](size_t) {}, [](size_t, const std::filesystem::path&)
+                           { return true; });
+        CHECK(cpp.get_localizable_strings().size() == 3);
+        cpp.remove_results_outside_changed_lines();
+        REQUIRE(cpp.get_localizable_strings().size() == 2);
+        CHECK(cpp.get_localizable_strings()[0].m_line == 2);
+        CHECK(cpp.get_localizable_strings()[1].m_line == 3);
+        }
+    }
+
+TEST_CASE("Check Profile", "[cpp][i18n]")
+    {
+    SECTION("Counters")
+        {
+        check_profile profile;
+        profile.get_counter(check_l10n_contains_url).add(std::chrono::milliseconds{ 2 }, 3);
+        profile.get_counter(check_l10n_contains_url).add(std::chrono::milliseconds{ 1 }, 1);
+        // multiple flags are recorded under the lowest one
+        profile.get_counter(check_number_assigned_to_id | check_duplicate_value_assigned_to_ids)
+            .add(std::chrono::milliseconds{ 1 }, 1);
+        profile.get_counter(profile_phase::scan).add(std::chrono::milliseconds{ 5 }, 2);
+        profile.add_scratch_usage(10, 1);
+        profile.add_scratch_usage(5, 0);
+
+        CHECK(profile.get_counter(check_l10n_contains_url).m_calls == 2);
+        CHECK(profile.get_counter(check_l10n_contains_url).m_items == 4);
+        CHECK(profile.get_counter(check_l10n_contains_url).m_nanoseconds == 3'000'000);
+        CHECK(profile.get_counter(check_number_assigned_to_id).m_calls == 1);
+        CHECK(profile.get_counter(check_duplicate_value_assigned_to_ids).m_calls == 0);
+
+        const std::string json{ profile.format_json() };
+        CHECK(json.find(R"({"name":"scan","milliseconds":5.000,"calls":1,"items":2})") !=
+              std::string::npos);
+        CHECK(json.find(R"({"name":"check_l10n_contains_url","milliseconds":3.000,"calls":2,)"
+                        R"("items":4})") != std::string::npos);
+        // checks that weren't run aren't included
+        CHECK(json.find("check_tabs") == std::string::npos);
+        CHECK(json.find(R"("scratch":{"files":2,"allocations":15,"heap_allocations":1})") !=
+              std::string::npos);
+        const std::wstring table{ profile.format_table() };
+        CHECK(table.find(L"check_l10n_contains_url") != std::wstring::npos);
+        CHECK(table.find(L"check_tabs") == std::wstring::npos);
+
+        profile.clear();
+        CHECK(profile.get_counter(check_l10n_contains_url).m_calls == 0);
+        CHECK(profile.get_counter(profile_phase::scan).m_calls == 0);
+        CHECK(profile.get_scratch_allocations() == 0);
+        CHECK(profile.get_scratch_heap_allocations() == 0);
+        }
+
+    SECTION("Analyzer")
+        {
+        check_profile profile;
+        cpp_i18n_review cpp(false);
+        cpp.set_profile(&profile);
+        cpp(LR"(auto var = _("Visit https://www.example.com for more information");
+auto var2 = _("Hello, world");
+MessageBox("Printer not ready");
+_tcscpy(buffer, L"text");)",
+            L"file.cpp");
+        cpp.review_strings([](size_t) {}, [](size_t, const std::filesystem::path&)
+                           { return true; });
+        if constexpr (check_profile::is_available())
+            {
+            CHECK(profile.get_counter(check_l10n_contains_url).m_calls == 2);
+            CHECK(profile.get_counter(check_deprecated_macros).m_calls == 1);
+            CHECK(profile.get_counter(check_not_available_for_l10n).m_calls >= 1);
+            // the copy of the file (at least) is made in the scratch arena
+            CHECK(profile.get_scratch_allocations() >= 1);
+            CHECK(profile.get_scratch_heap_allocations() == 0);
+            }
+
+        // clones share the profile
+        CHECK(cpp.clone()->get_profile() == &profile);
+        }
+    }
+
+TEST_CASE("Classification Cache", "[cpp][i18n]")
+    {
+    SECTION("Verdicts")
+        {
+        classification_cache cache;
+        size_t classifyCount{ 0 };
+        const auto isAmbiguous = [&classifyCount](std::wstring_view str)
+            {
+            ++classifyCount;
+            return i18n_review::is_string_ambiguous(str);
+            };
+        // one long word is probably syntax that needs context
+        const std::wstring longWord{ L"DocumentWindowPlacementPreferences" };
+        CHECK(cache.classify(longWord, string_verdict::ambiguous,
+                             [&]() { return isAmbiguous(longWord); }));
+        CHECK(cache.classify(longWord, string_verdict::ambiguous,
+                             [&]() { return isAmbiguous(longWord); }));
+        CHECK_FALSE(cache.classify(L"Open the file", string_verdict::ambiguous,
+                                   [&]() { return isAmbiguous(L"Open the file"); }));
+        CHECK(classifyCount == 2);
+        CHECK(cache.size() == 2);
+        CHECK(cache.get_hit_count() == 1);
+        CHECK(cache.get_miss_count() == 2);
+        // other verdicts for the same string are classified separately
+        CHECK_FALSE(cache.classify(longWord, string_verdict::multipart, []() { return false; }));
+        CHECK(cache.size() == 2);
+        CHECK(cache.get_miss_count() == 3);
+
+        // the untranslatable verdicts remember the translatable content's length also
+        CHECK(cache.classify_untranslatable(L"<b>Bold</b>", false,
+                                            []() { return std::make_pair(false, 4); }) ==
+              std::make_pair(false, size_t{ 4 }));
+        CHECK(cache.classify_untranslatable(L"<b>Bold</b>", false,
+                                            []() { return std::make_pair(true, 0); }) ==
+              std::make_pair(false, size_t{ 4 }));
+        CHECK(cache.classify_untranslatable(L"<b>Bold</b>", true,
+                                            []() { return std::make_pair(true, 11); }) ==
+              std::make_pair(true, size_t{ 11 }));
+
+        cache.clear();
+        CHECK(cache.size() == 0);
+        CHECK(cache.get_hit_count() == 0);
+        }
+
+    SECTION("Analyzer")
+        {
+        const wchar_t* code = LR"code(auto var = _("OK"); auto var2 = _("OK");
+auto var3 = _("Visit https://www.example.com for more information");
+auto var4 = _("Visit https://www.example.com for more information");
+auto var5 = _("Item(s)"); auto var6 = _("Item(s)");
+auto var7 = _("<span>"); auto var8 = _("<span>");
+MessageBox("Printer not ready"); MessageBox("Printer not ready");)code";
+        const auto review = [code](cpp_i18n_review& cpp)
+            {
+            cpp.set_style(all_i18n_checks);
+            cpp(code, L"file.cpp");
+            cpp.review_strings([](size_t) {}, [](size_t, const std::filesystem::path&)
+                               { return true; });
+            };
+
+        cpp_i18n_review cpp(false);
+        review(cpp);
+        cpp_i18n_review cachedCpp(false);
+        auto cache = std::make_shared<classification_cache>();
+        cachedCpp.set_classification_cache(cache);
+        review(cachedCpp);
+
+        CHECK(cachedCpp.get_unsafe_localizable_strings().size() ==
+              cpp.get_unsafe_localizable_strings().size());
+        CHECK(cachedCpp.get_unsafe_localizable_strings().size() == 2);
+        CHECK(cachedCpp.get_localizable_strings_with_urls().size() ==
+              cpp.get_localizable_strings_with_urls().size());
+        CHECK(cachedCpp.get_localizable_strings_with_urls().size() == 2);
+        CHECK(cachedCpp.get_faux_plural_strings().size() ==
+              cpp.get_faux_plural_strings().size());
+        CHECK(cachedCpp.get_faux_plural_strings().size() == 2);
+        CHECK(cachedCpp.get_localizable_strings_ambiguous_needing_context().size() ==
+              cpp.get_localizable_strings_ambiguous_needing_context().size());
+        CHECK(cachedCpp.get_not_available_for_localization_strings().size() ==
+              cpp.get_not_available_for_localization_strings().size());
+        // each duplicate string is only classified once
+        CHECK(cache->size() == 5);
+        CHECK(cache->get_hit_count() >= 5);
+
+        // clones share the cache
+        CHECK(cachedCpp.clone()->get_classification_cache() == cache.get());
+        CHECK(cpp.get_classification_cache() == nullptr);
+        }
+
+    SECTION("Threads")
+        {
+        classification_cache cache;
+        const std::vector<std::wstring> strings{ L"OK", L"Cancel", L"%s: %s",
+                                                 L"Open the file", L"N/A" };
+        std::atomic<size_t> mismatches{ 0 };
+            {
+            std::vector<std::jthread> threads;
+            for (size_t i = 0; i < 4; ++i)
+                {
+                threads.emplace_back(
+                    [&cache, &strings, &mismatches]()
+                    {
+                        for (size_t j = 0; j < 1000; ++j)
+                            {
+                            const auto& str = strings[j % strings.size()];
+                            if (cache.classify(str, string_verdict::ambiguous,
+                                               [&str]()
+                                               { return i18n_review::is_string_ambiguous(str); }) !=
+                                i18n_review::is_string_ambiguous(str))
+                                {
+                                ++mismatches;
+                                }
+                            }
+                    });
+                }
+            }
+        CHECK(mismatches == 0);
+        CHECK(cache.size() == strings.size());
+        CHECK(cache.get_hit_count() + cache.get_miss_count() == 4000);
+        }
+    }
+
+TEST_CASE("Rule Set", "[cpp][i18n]")
+    {
+    SECTION("Shared")
+        {
+        const cpp_i18n_review cpp(false);
+        const cpp_i18n_review cpp2(false);
+        const cpp_i18n_review verboseCpp(true);
+        const cpp_i18n_review verboseCpp2(true);
+        // analyzers share the rules, rather than building their own
+        CHECK(&cpp.get_rules() == &cpp2.get_rules());
+        CHECK(&cpp.get_rules() == i18n_review::get_default_rules(false).get());
+        CHECK(&verboseCpp.get_rules() == &verboseCpp2.get_rules());
+        CHECK(&cpp.get_rules() != &verboseCpp.get_rules());
+        CHECK(&cpp.clone()->get_rules() == &cpp.get_rules());
+        // verbose rules include legacy functions
+        CHECK(cpp.get_rules().m_deprecated_string_functions.contains(L"wxMin") == false);
+        CHECK(verboseCpp.get_rules().m_deprecated_string_functions.contains(L"wxMin"));
+        CHECK(cpp.get_rules().m_localization_functions.contains(L"_"));
+        CHECK(verboseCpp.get_rules().m_localization_functions.contains(L"_"));
+        CHECK(&cpp.get_ignored_variable_patterns() == &cpp2.get_ignored_variable_patterns());
+        CHECK_FALSE(cpp.get_ignored_variable_patterns().empty());
+        }
+
+    SECTION("Customized")
+        {
+        cpp_i18n_review cpp(false);
+        const cpp_i18n_review cpp2(false);
+            {
+            // the analyzer's copy of the name outlives the client's string
+            const std::wstring functionName{ L"MyTraceFunction" };
+            cpp.add_function_to_ignore(functionName);
+            }
+        CHECK(&cpp.get_rules() != &cpp2.get_rules());
+        CHECK(cpp.get_rules().m_internal_functions.contains(L"MyTraceFunction"));
+        CHECK(cpp2.get_rules().m_internal_functions.contains(L"MyTraceFunction") == false);
+        CHECK(i18n_review::get_default_rules(false)->m_internal_functions.contains(
+                  L"MyTraceFunction") == false);
+        // clones share the customized rules
+        CHECK(&cpp.clone()->get_rules() == &cpp.get_rules());
+        // further customizations change the analyzer's own copy
+        const rule_set* const customizedRules{ &cpp.get_rules() };
+        const size_t patternCount{ cpp2.get_ignored_variable_patterns().size() };
+        cpp.add_variable_name_pattern_to_ignore(L"^debugMsg.*");
+        cpp.add_variable_type_to_ignore(L"MyLogger");
+        cpp.add_font_name_to_ignore(L"My Font");
+        cpp.add_file_extension_to_ignore(L"myext");
+        CHECK(&cpp.get_rules() == customizedRules);
+        CHECK(cpp.get_ignored_variable_patterns().size() == patternCount + 1);
+        CHECK(cpp2.get_ignored_variable_patterns().size() == patternCount);
+        CHECK(cpp.get_ignored_variable_types().contains(L"MyLogger"));
+        CHECK(cpp2.get_ignored_variable_types().contains(L"MyLogger") == false);
+        CHECK(cpp.is_font_name(L"my font"));
+        CHECK(cpp2.is_font_name(L"my font") == false);
+        CHECK(cpp.is_file_extension(L"MYEXT"));
+        CHECK(cpp2.is_file_extension(L"MYEXT") == false);
+
+        cpp(LR"(MyTraceFunction("Printer is not ready, please check the connection");)",
+            L"file.cpp");
+        cpp.review_strings([](size_t) {}, [](size_t, const std::filesystem::path&)
+                           { return true; });
+        CHECK(cpp.get_internal_strings().size() == 1);
+        CHECK(cpp.get_not_available_for_localization_strings().size() == 0);
+        }
+    }
+
+TEST_CASE("Scratch Arena", "[cpp][i18n]")
+    {
+    SECTION("Allocations")
+        {
+        scratch_arena arena;
+            {
+            std::pmr::vector<int> values{ arena.get_resource() };
+            values.resize(100);
+            std::pmr::wstring str{ L"This string is too long for the small string buffer",
+                                   arena.get_resource() };
+            CHECK(arena.get_allocation_count() == 2);
+            CHECK(arena.get_heap_allocation_count() == 0);
+            }
+        arena.reset();
+        CHECK(arena.get_allocation_count() == 0);
+        CHECK(arena.get_heap_allocation_count() == 0);
+        CHECK(arena.get_buffer_size() == scratch_arena::INITIAL_BUFFER_SIZE);
+        }
+
+    SECTION("Growth")
+        {
+        scratch_arena arena;
+        const size_t largeSize{ scratch_arena::INITIAL_BUFFER_SIZE * 3 };
+            {
+            std::pmr::vector<std::byte> buffer{ largeSize, arena.get_resource() };
+            CHECK(arena.get_heap_allocation_count() == 1);
+            }
+        // the buffer grows to fit what the last file needed...
+        arena.reset();
+        CHECK(arena.get_buffer_size() >= largeSize);
+        CHECK(arena.get_buffer_size() <= scratch_arena::MAX_BUFFER_SIZE);
+        // ...so the next file of that size doesn't need the heap
+            {
+            std::pmr::vector<std::byte> buffer{ largeSize, arena.get_resource() };
+            CHECK(arena.get_allocation_count() == 1);
+            CHECK(arena.get_heap_allocation_count() == 0);
+            }
+        arena.reset();
+        }
+
+    SECTION("Copy")
+        {
+        scratch_arena arena;
+        std::pmr::wstring str{ L"This string is too long for the small string buffer",
+                               arena.get_resource() };
+        // a copy is a new arena
+        const scratch_arena copy{ arena };
+        CHECK(arena.get_allocation_count() == 1);
+        CHECK(copy.get_allocation_count() == 0);
+        }
+
+    SECTION("Analyzer")
+        {
+        // results outlive the file's scratch memory
+        cpp_i18n_review cpp(false);
+        cpp.set_style(review_style::all_i18n_checks);
+        cpp(LR"(UINT ID_EXPORT{ 1000 };
+UINT ID_PRINT{ 1000 };
+auto var = _("Printer is not ready, please check the connection");)",
+            L"file1.cpp");
+        cpp(LR"(auto var2 = _("Printer is ready, please close the dialog");)", L"file2.cpp");
+        cpp.review_strings([](size_t) {}, [](size_t, const std::filesystem::path&)
+                           { return true; });
+        REQUIRE(cpp.get_localizable_strings().size() == 2);
+        CHECK(cpp.get_localizable_strings()[0].m_string ==
+              L"Printer is not ready, please check the connection");
+        CHECK(cpp.get_localizable_strings()[1].m_string ==
+              L"Printer is ready, please close the dialog");
+        CHECK(cpp.get_duplicates_value_assigned_to_ids().size() == 1);
+        }
+    }
+
 // NOLINTEND
 // clang-format on
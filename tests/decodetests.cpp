@@ -1,4 +1,5 @@
 #include "../src/i18n_string_util.h"
+#include "../src/text_decode.h"
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
@@ -60,5 +61,180 @@ TEST_CASE("Text decode", "[decode]")
         CHECK(str == L"F\\u2H6f/G\\u266");
         }
     }
+
+TEST_CASE("UTF-8 decode", "[decode]")
+    {
+    SECTION("Empty")
+        {
+        std::wstring str{ L"leftover" };
+        CHECK(i18n_check::decode_utf8("", str));
+        CHECK(str.empty());
+        CHECK(i18n_check::is_valid_utf8(""));
+        }
+
+    SECTION("ASCII")
+        {
+        std::wstring str;
+        CHECK(i18n_check::decode_utf8("Hello, world!\r\nThis is a longer line of text.", str));
+        CHECK(str == L"Hello, world!\r\nThis is a longer line of text.");
+        }
+
+    SECTION("Multibyte")
+        {
+        std::wstring str;
+        // £, €, and a musical G clef (outside of the BMP)
+        CHECK(i18n_check::decode_utf8("Price: \xC2\xA3" "5 or \xE2\x82\xAC" "6 \xF0\x9D\x84\x9E.", str));
+        if constexpr (sizeof(wchar_t) == 2)
+            {
+            CHECK(str == L"Price: \u00A35 or \u20AC6 \xD834\xDD1E.");
+            }
+        else
+            {
+            CHECK(str == L"Price: \u00A35 or \u20AC6 \U0001D11E.");
+            }
+        }
+
+    SECTION("Non-ASCII At Every Position")
+        {
+        // long enough to go through the vectorized paths, with the
+        // multibyte character moving through every position of them
+        const std::string asciiText(100, 'a');
+        for (size_t i = 0; i <= asciiText.length(); ++i)
+            {
+            std::string text{ asciiText };
+            text.insert(i, "\xC3\xA9");
+            std::wstring expected(asciiText.length(), L'a');
+            expected.insert(i, 1, L'\u00E9');
+
+            std::wstring str;
+            CHECK(i18n_check::decode_utf8(text, str));
+            CHECK(str == expected);
+            CHECK(i18n_check::is_valid_utf8(text));
+            CHECK(i18n_check::encode_utf8(str) == text);
+
+            // an invalid byte anywhere should be caught
+            text[i] = '\xFF';
+            CHECK_FALSE(i18n_check::decode_utf8(text, str));
+            CHECK_FALSE(i18n_check::is_valid_utf8(text));
+            }
+        }
+
+    SECTION("BOM")
+        {
+        CHECK(i18n_check::has_utf8_bom("\xEF\xBB\xBFtext"));
+        CHECK_FALSE(i18n_check::has_utf8_bom("text"));
+        CHECK_FALSE(i18n_check::has_utf8_bom("\xEF\xBB"));
+        }
+
+    SECTION("Encode")
+        {
+        CHECK(i18n_check::encode_utf8(L"").empty());
+        CHECK(i18n_check::encode_utf8(L"Price: \u00A35 or \u20AC6.") ==
+              "Price: \xC2\xA3" "5 or \xE2\x82\xAC" "6.");
+        // surrogate pairs are combined, even if wchar_t is 32-bit
+        std::wstring str{ L"G clef: " };
+        str += static_cast<wchar_t>(0xD834);
+        str += static_cast<wchar_t>(0xDD1E);
+        CHECK(i18n_check::encode_utf8(str) == "G clef: \xF0\x9D\x84\x9E");
+        // unpaired surrogate
+        str.pop_back();
+        CHECK(i18n_check::encode_utf8(str) == "G clef: \xEF\xBF\xBD");
+        }
+
+    SECTION("Invalid")
+        {
+        std::wstring str;
+        // Windows-1252 text
+        CHECK_FALSE(i18n_check::decode_utf8("Caf\xE9 menu", str));
+        CHECK(str.empty());
+        CHECK_FALSE(i18n_check::is_valid_utf8("Caf\xE9 menu"));
+        // truncated sequence
+        CHECK_FALSE(i18n_check::is_valid_utf8("Price: \xE2\x82"));
+        // stray continuation byte
+        CHECK_FALSE(i18n_check::is_valid_utf8("\x82text"));
+        // overlong
+        CHECK_FALSE(i18n_check::is_valid_utf8("\xC0\xAF"));
+        CHECK_FALSE(i18n_check::is_valid_utf8("\xE0\x80\xAF"));
+        // surrogate
+        CHECK_FALSE(i18n_check::is_valid_utf8("\xED\xA0\x80"));
+        // beyond U+10FFFF
+        CHECK_FALSE(i18n_check::is_valid_utf8("\xF4\x90\x80\x80"));
+        CHECK(i18n_check::is_valid_utf8("\xF4\x8F\xBF\xBF"));
+        }
+    }
+
+TEST_CASE("Encoding detection", "[decode]")
+    {
+    using namespace i18n_check;
+
+    SECTION("UTF-8")
+        {
+        const auto decoded = decode_text("Price: \xE2\x82\xAC" "5");
+        CHECK(decoded.m_encoding == text_encoding::utf8);
+        CHECK_FALSE(decoded.m_has_utf8_bom);
+        CHECK(decoded.m_text == L"Price: \u20AC5");
+        }
+
+    SECTION("UTF-8 BOM")
+        {
+        const auto decoded = decode_text("\xEF\xBB\xBFPrice: \xE2\x82\xAC" "5");
+        CHECK(decoded.m_encoding == text_encoding::utf8);
+        CHECK(decoded.m_has_utf8_bom);
+        CHECK(decoded.m_text == L"Price: \u20AC5");
+        }
+
+    SECTION("UTF-16")
+        {
+        const auto littleEndian = decode_text(std::string_view{ "\xFF\xFEH\0i\0\xAC\x20", 8 });
+        CHECK(littleEndian.m_encoding == text_encoding::utf16_little_endian);
+        CHECK(littleEndian.m_text == L"Hi\u20AC");
+
+        const auto bigEndian = decode_text(std::string_view{ "\xFE\xFF\0H\0i\x20\xAC", 8 });
+        CHECK(bigEndian.m_encoding == text_encoding::utf16_big_endian);
+        CHECK(bigEndian.m_text == L"Hi\u20AC");
+
+        // surrogate pair (a musical G clef), and then an unpaired surrogate
+        const auto surrogates = decode_utf16(std::string_view{ "\x34\xD8\x1E\xDD\x34\xD8", 6 }, true);
+        if constexpr (sizeof(wchar_t) == 2)
+            {
+            CHECK(surrogates == L"\xD834\xDD1E\xFFFD");
+            }
+        else
+            {
+            CHECK(surrogates == L"\U0001D11E\uFFFD");
+            }
+        }
+
+    SECTION("Legacy")
+        {
+        // Windows-1252 text, which isn't valid UTF-8
+        const std::string text{ "\x93" "Caf\xE9" "\x94 costs \x80" "5" };
+        auto decoded = decode_text(text);
+        CHECK(decoded.m_encoding == text_encoding::windows_1252);
+        CHECK(decoded.m_text == L"\u201C" L"Caf\u00E9" L"\u201D costs \u20AC" L"5");
+
+        decoded = decode_text(text, text_encoding::iso_8859_1);
+        CHECK(decoded.m_encoding == text_encoding::iso_8859_1);
+        CHECK(decoded.m_text == L"\u0093" L"Caf\u00E9" L"\u0094 costs \u0080" L"5");
+
+        CHECK(decode_legacy_text("\xA4\xBD\xE9", text_encoding::iso_8859_15) == L"\u20AC\u0153\u00E9");
+        CHECK(decode_legacy_text("\xA4\xBD\xE9", text_encoding::iso_8859_1) == L"\u00A4\u00BD\u00E9");
+        // unassigned values are left as control codes
+        CHECK(decode_legacy_text("\x81\x8D", text_encoding::windows_1252) == L"\u0081\u008D");
+        // long enough to go through the vectorized ASCII paths
+        const std::string longText{ std::string(40, 'a') + "\xE9" + std::string(40, 'b') };
+        CHECK(decode_legacy_text(longText, text_encoding::windows_1252) ==
+              std::wstring(40, L'a') + L"\u00E9" + std::wstring(40, L'b'));
+        }
+
+    SECTION("Encoding Names")
+        {
+        CHECK(get_legacy_encoding_from_name("Windows-1252") == text_encoding::windows_1252);
+        CHECK(get_legacy_encoding_from_name("iso-8859-15") == text_encoding::iso_8859_15);
+        CHECK(get_legacy_encoding_from_name("latin1") == text_encoding::iso_8859_1);
+        CHECK_FALSE(get_legacy_encoding_from_name("utf-8"));
+        CHECK(get_encoding_name(text_encoding::windows_1252) == L"Windows-1252");
+        }
+    }
 // NOLINTEND
 // clang-format on
@@ -0,0 +1,86 @@
+#include "../src/input.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace i18n_check;
+using namespace Catch::Matchers;
+
+// clang-format off
+TEST_CASE("Files to Analyze", "[input]")
+    {
+    const auto rootFolder{ std::filesystem::temp_directory_path() / L"quneiform-input-test" };
+    std::filesystem::remove_all(rootFolder);
+    for (const auto& folder : { L"src/detail", L"third_party/lib/nested", L"build" })
+        {
+        std::filesystem::create_directories(rootFolder / folder);
+        }
+    for (const auto& file : { L"main.cpp", L"notes.txt", L"src/app.cpp", L"src/app.h",
+                              L"src/detail/impl.cpp", L"src/generated.cpp",
+                              L"third_party/lib/lib.cpp", L"third_party/lib/nested/deep.cpp",
+                              L"build/CMakeCXXCompilerId.cpp", L"build/moc.cpp" })
+        {
+        std::ofstream(rootFolder / file) << "int i;\n";
+        }
+
+    const auto relativeFiles = [&rootFolder](const std::vector<std::filesystem::path>& files)
+    {
+        std::vector<std::wstring> relFiles;
+        for (const auto& file : files)
+            {
+            relFiles.push_back(file.lexically_relative(rootFolder).generic_wstring());
+            }
+        std::sort(relFiles.begin(), relFiles.end());
+        return relFiles;
+    };
+
+    SECTION("No Exclusions")
+        {
+        CHECK(relativeFiles(get_files_to_analyze(rootFolder, {}, {})) ==
+              std::vector<std::wstring>{ L"build/moc.cpp", L"main.cpp", L"src/app.cpp",
+                                         L"src/app.h", L"src/detail/impl.cpp",
+                                         L"src/generated.cpp", L"third_party/lib/lib.cpp",
+                                         L"third_party/lib/nested/deep.cpp" });
+        }
+
+    SECTION("Exclusions")
+        {
+        const auto excludedInfo = get_paths_files_to_exclude(
+            rootFolder, { L"third_party", L"build/", L"src/generated.cpp", L"missing" });
+        // subfolders of excluded folders are skipped while reading, not listed up front
+        CHECK(excludedInfo.m_excludedPaths.size() == 2);
+        CHECK(excludedInfo.m_excludedFiles.size() == 1);
+        CHECK(relativeFiles(get_files_to_analyze(rootFolder, excludedInfo.m_excludedPaths,
+                                                 excludedInfo.m_excludedFiles)) ==
+              std::vector<std::wstring>{ L"main.cpp", L"src/app.cpp", L"src/app.h",
+                                         L"src/detail/impl.cpp" });
+
+        // nested excluded folder
+        const auto nestedExcludedInfo =
+            get_paths_files_to_exclude(rootFolder, { L"src/detail" });
+        CHECK(relativeFiles(get_files_to_analyze(rootFolder, nestedExcludedInfo.m_excludedPaths,
+                                                 nestedExcludedInfo.m_excludedFiles)).size() == 7);
+
+        // individual files
+        CHECK(is_file_to_analyze(rootFolder / L"src/app.cpp", excludedInfo.m_excludedPaths,
+                                 excludedInfo.m_excludedFiles));
+        CHECK_FALSE(is_file_to_analyze(rootFolder / L"third_party/lib/nested/deep.cpp",
+                                       excludedInfo.m_excludedPaths,
+                                       excludedInfo.m_excludedFiles));
+        CHECK_FALSE(is_file_to_analyze(rootFolder / L"src/./generated.cpp",
+                                       excludedInfo.m_excludedPaths,
+                                       excludedInfo.m_excludedFiles));
+        CHECK_FALSE(is_file_to_analyze(rootFolder / L"notes.txt", excludedInfo.m_excludedPaths,
+                                       excludedInfo.m_excludedFiles));
+        }
+
+    std::filesystem::remove_all(rootFolder);
+    }
+
+// NOLINTEND
+// clang-format on
@@ -0,0 +1,155 @@
+#include "../src/lsp/json.h"
+#include "../src/lsp/lsp_protocol.h"
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+
+// NOLINTBEGIN
+using namespace i18n_check;
+
+// clang-format off
+TEST_CASE("JSON", "[lsp]")
+    {
+    SECTION("Parse")
+        {
+        const auto value = json_value::parse(
+            R"( {"id": 7, "method": "initialize", "params": {"rootUri": null, "flags": [true, false]}} )");
+        CHECK(value["id"].as_number() == 7);
+        CHECK(value["method"].as_string() == "initialize");
+        CHECK(value["params"]["rootUri"].is_null());
+        REQUIRE(value["params"]["flags"].as_array().size() == 2);
+        CHECK(value["params"]["flags"].as_array()[0].as_bool());
+        CHECK_FALSE(value["params"]["flags"].as_array()[1].as_bool());
+        // missing members are null
+        CHECK(value["params"]["missing"]["deeper"].is_null());
+        CHECK_THROWS(value["method"].as_number());
+        }
+
+    SECTION("Parse Escapes")
+        {
+        const auto value = json_value::parse(R"("line\n\"quoted\" é 😀")");
+        CHECK(value.as_string() == "line\n\"quoted\" \xC3\xA9 \xF0\x9F\x98\x80");
+        }
+
+    SECTION("Parse Malformed")
+        {
+        CHECK_THROWS(json_value::parse(R"({"id": 1)"));
+        CHECK_THROWS(json_value::parse(R"({"id" 1})"));
+        CHECK_THROWS(json_value::parse(R"("unterminated)"));
+        CHECK_THROWS(json_value::parse(R"([1, 2] extra)"));
+        CHECK_THROWS(json_value::parse(""));
+        CHECK_THROWS(json_value::parse(std::string(1'000, '[')));
+        }
+
+    SECTION("Dump")
+        {
+        json_value value{ json_value::object{} };
+        value["id"] = 3;
+        value["result"] = nullptr;
+        value["message"] = "tab\there \"quoted\"";
+        value["range"] = json_value::array{ 1.5, true };
+        CHECK(value.dump() ==
+              R"({"id":3,"result":null,"message":"tab\there \"quoted\"","range":[1.5,true]})");
+        // round trip
+        CHECK(json_value::parse(value.dump()).dump() == value.dump());
+        }
+    }
+
+TEST_CASE("LSP Protocol", "[lsp]")
+    {
+    SECTION("URIs")
+        {
+#ifndef _WIN32
+        CHECK(uri_to_path("file:///home/user/my%20project/a.cpp") ==
+              std::filesystem::path{ "/home/user/my project/a.cpp" });
+        CHECK(path_to_uri(std::filesystem::path{ "/home/user/my project/a.cpp" }) ==
+              "file:///home/user/my%20project/a.cpp");
+        CHECK(uri_to_path(path_to_uri(std::filesystem::path{ "/tmp/a#b/c.cpp" })) ==
+              std::filesystem::path{ "/tmp/a#b/c.cpp" });
+#endif
+        CHECK(uri_to_path("https://example.com/a.cpp").empty());
+        }
+
+    SECTION("Read Messages")
+        {
+        std::istringstream input{ "Content-Length: 8\r\n"
+                                  "Content-Type: application/vscode-jsonrpc; charset=utf-8\r\n"
+                                  "\r\n"
+                                  R"({"id":1})"
+                                  "Content-Length: 2\r\n\r\n{}" };
+        CHECK(read_lsp_message(input) == std::optional<std::string>{ R"({"id":1})" });
+        CHECK(read_lsp_message(input) == std::optional<std::string>{ "{}" });
+        CHECK_FALSE(read_lsp_message(input).has_value());
+        }
+
+    SECTION("Read Malformed Messages")
+        {
+        std::istringstream missingLength{ "Content-Type: text\r\n\r\n{}" };
+        CHECK_THROWS(read_lsp_message(missingLength));
+        std::istringstream badLength{ "Content-Length: many\r\n\r\n{}" };
+        CHECK_THROWS(read_lsp_message(badLength));
+        // content that is cut off is treated as the end of the input
+        std::istringstream truncated{ "Content-Length: 20\r\n\r\n{}" };
+        CHECK_FALSE(read_lsp_message(truncated).has_value());
+        }
+
+    SECTION("Write Messages")
+        {
+        std::ostringstream output;
+        json_value message{ json_value::object{} };
+        message["id"] = 2;
+        write_lsp_message(output, message);
+        CHECK(output.str() == "Content-Length: 8\r\n\r\n{\"id\":2}");
+        }
+
+    SECTION("Document Text")
+        {
+        const auto opened = json_value::parse(
+            R"({"textDocument": {"uri": "file:///a.cpp", "text": "int x;"}})");
+        REQUIRE(get_document_text("textDocument/didOpen", opened) != nullptr);
+        CHECK(*get_document_text("textDocument/didOpen", opened) == "int x;");
+        // the last change is the full text
+        const auto changed = json_value::parse(
+            R"({"contentChanges": [{"text": "int x;"}, {"text": "int y;"}]})");
+        REQUIRE(get_document_text("textDocument/didChange", changed) != nullptr);
+        CHECK(*get_document_text("textDocument/didChange", changed) == "int y;");
+        // malformed changes
+        CHECK(get_document_text("textDocument/didChange",
+                                json_value::parse(R"({"contentChanges": []})")) == nullptr);
+        CHECK(get_document_text("textDocument/didChange",
+                                json_value::parse(R"({"contentChanges": {"text": "x"}})")) == nullptr);
+        CHECK(get_document_text("textDocument/didChange",
+                                json_value::parse(R"({"contentChanges": [{"text": 5}]})")) == nullptr);
+        CHECK(get_document_text("textDocument/didChange", json_value::parse("{}")) == nullptr);
+        CHECK(get_document_text("textDocument/didOpen",
+                                json_value::parse(R"({"textDocument": {}})")) == nullptr);
+        CHECK(get_document_text("textDocument/didClose", opened) == nullptr);
+        }
+
+    SECTION("UTF-16 Lengths")
+        {
+        CHECK(utf16_length(L"") == 0);
+        CHECK(utf16_length(L"caf\u00E9") == 4);
+        // characters outside of the BMP are surrogate pairs
+        CHECK(utf16_length(L"a\U0001F600b") == 4);
+        }
+
+    SECTION("Issue Lengths")
+        {
+        // strings are measured in the source, up to their closing quote
+        const std::wstring_view line{ LR"(    auto x = _(L"Say \"hi\"  ");)" };
+        CHECK(get_issue_length(line, 17) == 12);
+        CHECK(get_issue_length(LR"(x = L"";)", 6) == 0);
+        // a string continuing onto the next line
+        CHECK(get_issue_length(LR"(x = "abc\)", 5) == 4);
+        // C# verbatim strings escape quotes by doubling them
+        CHECK(get_issue_length(LR"(x = @"C:\a ""b""";)", 6) == 10);
+        // whitespace and names
+        CHECK(get_issue_length(L"\t\tint x;", 0) == 2);
+        CHECK(get_issue_length(L"x = 1;   ", 6) == 3);
+        CHECK(get_issue_length(L"    strcpy(a, b);", 4) == 6);
+        CHECK(get_issue_length(L"x = (1);", 4) == 1);
+        CHECK(get_issue_length(L"x;", 5) == 0);
+        }
+    }
+// NOLINTEND
+// clang-format on
@@ -0,0 +1,273 @@
+#include "../src/cpp_i18n_review.h"
+#include "../src/regex_pattern.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+// NOLINTBEGIN
+// clang-format off
+
+using namespace i18n_check;
+
+// Strings that may be found in source code, labelled with whether they are
+// untranslatable (true) or meant for translation (false).
+static const std::vector<std::pair<std::wstring, bool>> LABELLED_STRINGS{
+    { L"Open Project", false },
+    { L"Could not open the file. Please make sure that it exists.", false },
+    { L"Item(s)", false },
+    { L"%d%%", false },
+    { L"N/A", false },
+    { L"<enter comment here>", false },
+    { L"Visit our website www.example.com for more information.", false },
+    { L"Call (555) 555-5555 to order.", false },
+    { L"Résumé téléchargé avec succès.", false },
+    { L"Saved &amp; closed.", false },
+    { L"LoadProject(path)", true },
+    { L"GetValue(", true },
+    { L"<span>", true },
+    { L"<div class='header'>", true },
+    { L"&ldquo;", true },
+    { L"&#8220;", true },
+    { L"#FFFFFF", true },
+    { L"#hashtag", true },
+    { L"CTRL+SHIFT+S", true },
+    { L"Lorem ipsum dolor sit amet", true },
+    { L"The quick brown fox jumps over the lazy dog", true },
+    { L"SELECT * FROM customers WHERE id = 1", true },
+    { L"CREATE TABLE products (id INTEGER)", true },
+    { L"ASSERT_VALID", true },
+    { L"3.14", true },
+    { L"{8C4F7B2A-1D3E-4F5A-9B6C-7D8E9F0A1B2C}", true },
+    { L"wxID_OK", true },
+    { L"std::vector", true },
+};
+
+// the built-in patterns that are only checked for whether they match
+static const std::vector<std::pair<std::wstring, std::regex_constants::syntax_option_type>> BUILT_IN_PATTERNS{
+    { LR"(((http|ftp)s?:\/\/)?(www\.)[-a-zA-Z0-9@:%._\+~#=]{1,256}\.[a-zA-Z0-9()]{1,6}\b([-a-zA-Z0-9()@:%_\+.~#?&//=]*))", std::regex_constants::ECMAScript },
+    { LR"((\+\d{1,2}\s)?\(?\d{3}\)?[\s.-]\d{3}[\s.-]\d{4})", std::regex_constants::ECMAScript },
+    { LR"(&amp;[a-zA-Z]{3,5};)", std::regex_constants::ECMAScript },
+    { LR"(&(nbsp|amp|quot)[^;])", std::regex_constants::ECMAScript },
+    { LR"(.*(SELECT \*|CREATE TABLE|CREATE INDEX|COLLATE NOCASE|ALTER TABLE|DROP TABLE|COLLATE DATABASE_DEFAULT).*)", std::regex_constants::icase },
+    { LR"(([a-zA-Z0-9_]*|^)(ASSERT|VERIFY|PROFILE|CHECK)([a-zA-Z0-9_]*|$))", std::regex_constants::ECMAScript },
+    { LR"([[:alnum:]]{2,}[(]s[)])", std::regex_constants::ECMAScript },
+    { LR"([[:alnum:]]{2,}[(])", std::regex_constants::ECMAScript },
+    { LR"(&[a-zA-Z]{2,5};.*)", std::regex_constants::ECMAScript },
+    { LR"(&#[[:digit:]]{2,4};.*)", std::regex_constants::ECMAScript },
+    { LR"([[:alpha:]ŽžŸÀ-ÖØ-öø-ÿżźćńółęąśŻŹĆĄŚĘŁÓŃěščřžýáíéóúůďťňĎŇŤŠČŘŽÝÁÍÉÚŮĚÓАБВГДЕЁЖЗИЙКЛМНОПРСТУФХЦЧШЩЪЫЬЭЮЯабвгдеёжзийклмнопрстуфхцчшщъыьэюяІі]{2,})", std::regex_constants::ECMAScript },
+    { LR"(#[[:alnum:]]{2,})", std::regex_constants::ECMAScript },
+    { LR"((CTRL|SHIFT|CMD|ALT)([+](CTRL|SHIFT|CMD|ALT))*([+][[:alnum:]])+)", std::regex_constants::icase },
+    { LR"([[:alnum:]]{2,}[(][[:alnum:]]+(,[[:space:]]*[[:alnum:]]+)*[)])", std::regex_constants::ECMAScript },
+    { LR"([^[:alnum:]<]*<(span|object|property|div|p|ul|ol|li|img|html|[?]xml|meta|body|table|tbody|tr|td|thead|head|title|a[[:space:]]|!--|/|!DOCTYPE|br|center|dd|em|dl|dt|tt|font|form|h[[:digit:]]|hr|main|map|pre|script).*)", std::regex_constants::icase },
+    { LR"(<[a-zA-Z0-9_\-]+>[[:print:][:cntrl:]]*</[a-zA-Z0-9_\-]+>)", std::regex_constants::icase },
+    { LR"(<\/?[a-zA-Z0-9_:'"\.\[\]\/\{\}\-\\=][a-zA-Z0-9_:'"\.\[\]\/\{\}\- \\=]+\/?>)", std::regex_constants::icase },
+    { LR"(<\/?(([a-zA-Z0-9]){2,}\s+){1,}([a-zA-Z0-9]){2,}[[:punct:]]?\/?>)", std::regex_constants::icase },
+    { LR"(<[a-zA-Z][a-z\-]+>)", std::regex_constants::ECMAScript },
+    { LR"(<(span|object|property|div|p|ul|ol|li|img|html|xml|meta|body|table|tbody|tr|td|thead|head|title|br|center|dd|em|dl|dt|tt|font|form|hr|main|map|pre|script)>)", std::regex_constants::ECMAScript },
+    { LR"(([0-9]+|\{[a-z0-9]\}|%[udil]{1,2})%)", std::regex_constants::ECMAScript },
+    { L"[[:punct:]]+", std::regex_constants::ECMAScript },
+};
+
+TEST_CASE("Regex Backends", "[regex]")
+    {
+    SECTION("Built-in Patterns")
+        {
+        for (const auto& [pattern, flags] : BUILT_IN_PATTERNS)
+            {
+            const regex_pattern fastRegex{ pattern, flags };
+            const std::wregex stdRegex{ pattern, flags };
+            CHECK(fastRegex.is_linear());
+            for (const auto& [str, label] : LABELLED_STRINGS)
+                {
+                CHECK(fastRegex.matches(str) == std::regex_match(str, stdRegex));
+                CHECK(fastRegex.search(str) == std::regex_search(str, stdRegex));
+                }
+            }
+        }
+
+    SECTION("Syntax")
+        {
+        CHECK(linear_regex{ L"a(b|cd)*e" }.matches(L"abcdbe"));
+        CHECK_FALSE(linear_regex{ L"a(b|cd)*e" }.matches(L"abce"));
+        CHECK(linear_regex{ L"a(b|cd)*e" }.search(L"xxaex"));
+        CHECK(linear_regex{ L"a{2,3}" }.matches(L"aaa"));
+        CHECK_FALSE(linear_regex{ L"a{2,3}" }.matches(L"aaaa"));
+        CHECK(linear_regex{ L"a{2,}?" }.matches(L"aaaa"));
+        CHECK(linear_regex{ L"\\bword\\b" }.search(L"a word here"));
+        CHECK_FALSE(linear_regex{ L"\\bword\\b" }.search(L"swordfish"));
+        CHECK(linear_regex{ L"^start" }.search(L"start here"));
+        CHECK_FALSE(linear_regex{ L"^start" }.search(L"restart"));
+        CHECK(linear_regex{ L"end$" }.search(L"the end"));
+        CHECK_FALSE(linear_regex{ L"end$" }.search(L"the end."));
+        CHECK(linear_regex{ L"[^a-c\\d]+" }.matches(L"xyz"));
+        CHECK_FALSE(linear_regex{ L"[^a-c\\d]+" }.matches(L"xy1"));
+        CHECK(linear_regex{ L"\\u00E9t\\u00E9" }.matches(L"été"));
+        CHECK(linear_regex{ L"HELLO", true }.matches(L"hello"));
+        CHECK(linear_regex{ L"[A-Z]+", true }.matches(L"hello"));
+        CHECK_FALSE(linear_regex{ L".+" }.matches(L"two\nlines"));
+        CHECK(linear_regex{ L"[\\d\\D]+" }.matches(L"two\nlines"));
+        CHECK(linear_regex{ L"" }.matches(L""));
+        CHECK(linear_regex{ L"" }.search(L"text"));
+        }
+
+    SECTION("Fallback")
+        {
+        // backreferences and lookaheads need the standard library
+        CHECK_THROWS(linear_regex{ L"(a)\\1" });
+        CHECK_THROWS(linear_regex{ L"a(?=b)" });
+        const regex_pattern backReference{ L"(a+)b\\1" };
+        CHECK_FALSE(backReference.is_linear());
+        CHECK(backReference.matches(L"aabaa"));
+        CHECK_FALSE(backReference.matches(L"aaba"));
+        CHECK(backReference.search(L"xxabax"));
+        CHECK_FALSE(regex_pattern{ std::wregex{ L"a+" } }.is_linear());
+        CHECK_FALSE(regex_pattern{ L"a+", std::regex_constants::basic }.is_linear());
+        CHECK_THROWS_AS(regex_pattern{ L"a(" }, std::regex_error);
+        }
+
+    SECTION("Pattern Sets")
+        {
+        const regex_set regexes{ regex_source(L"[a-z]+"),
+                                 regex_source(L"(a+)b\\1"),
+                                 regex_source(L"ab+a"),
+                                 regex_source(L"HELLO", std::regex_constants::icase),
+                                 regex_source(L"[0-9]+") };
+        CHECK(regexes.size() == 5);
+        CHECK(regexes.get_linear_count() == 4);
+        // the first pattern (in the order they were added) is the one reported
+        CHECK(regexes.find_match(L"aba") == 0);
+        CHECK(regexes.find_match(L"aabaa") == 0);
+        CHECK(regexes.find_match(L"HeLLo") == 3);
+        CHECK(regexes.find_match(L"42") == 4);
+        CHECK_FALSE(regexes.find_match(L"HeLLo!").has_value());
+        // case insensitivity only applies to the pattern that asked for it
+        const regex_set caseRegexes{ regex_source(L"ABC", std::regex_constants::icase),
+                                     regex_source(L"XYZ") };
+        CHECK(caseRegexes.find_match(L"abc") == 0);
+        CHECK_FALSE(caseRegexes.find_match(L"xyz").has_value());
+        // a fallback pattern before the linear match takes precedence
+        const regex_set fallbackRegexes{ regex_source(L"(a)\\1"), regex_source(L"a+") };
+        CHECK(fallbackRegexes.find_match(L"aa") == 0);
+        CHECK(fallbackRegexes.find_match(L"aaa") == 1);
+        CHECK_FALSE(regex_set{}.find_match(L"text").has_value());
+        }
+
+    SECTION("Labelled Strings")
+        {
+        cpp_i18n_review cpp(false);
+        for (const auto& [str, label] : LABELLED_STRINGS)
+            {
+            INFO(std::string(str.cbegin(), str.cend()));
+            CHECK(cpp.is_untranslatable_string(str, false).first == label);
+            }
+        }
+    }
+
+// Hidden from the default run; run the test runner with "[benchmark]" to include these.
+TEST_CASE("Regex benchmarks", "[.][benchmark][regex]")
+    {
+    std::vector<std::wregex> stdRegexes;
+    std::vector<regex_pattern> fastRegexes;
+    for (const auto& [pattern, flags] : BUILT_IN_PATTERNS)
+        {
+        stdRegexes.emplace_back(pattern, flags);
+        fastRegexes.emplace_back(pattern, flags);
+        }
+
+    // each benchmark reviews every labelled string once, so divide by the
+    // number of strings for the per-string cost
+    BENCHMARK("Match built-in patterns (std::wregex)")
+        {
+        size_t matchCount{ 0 };
+        for (const auto& [str, label] : LABELLED_STRINGS)
+            {
+            for (const auto& reg : stdRegexes)
+                {
+                matchCount += std::regex_match(str, reg) ? 1 : 0;
+                }
+            }
+        return matchCount;
+        };
+    BENCHMARK("Match built-in patterns")
+        {
+        size_t matchCount{ 0 };
+        for (const auto& [str, label] : LABELLED_STRINGS)
+            {
+            for (const auto& reg : fastRegexes)
+                {
+                matchCount += reg.matches(str) ? 1 : 0;
+                }
+            }
+        return matchCount;
+        };
+    BENCHMARK("Search built-in patterns (std::wregex)")
+        {
+        size_t matchCount{ 0 };
+        for (const auto& [str, label] : LABELLED_STRINGS)
+            {
+            for (const auto& reg : stdRegexes)
+                {
+                matchCount += std::regex_search(str, reg) ? 1 : 0;
+                }
+            }
+        return matchCount;
+        };
+    BENCHMARK("Search built-in patterns")
+        {
+        size_t matchCount{ 0 };
+        for (const auto& [str, label] : LABELLED_STRINGS)
+            {
+            for (const auto& reg : fastRegexes)
+                {
+                matchCount += reg.search(str) ? 1 : 0;
+                }
+            }
+        return matchCount;
+        };
+
+    regex_set regexSet;
+    for (const auto& [pattern, flags] : BUILT_IN_PATTERNS)
+        {
+        regexSet.add(regex_source(pattern, flags));
+        }
+    BENCHMARK("Match built-in patterns one at a time")
+        {
+        size_t matchCount{ 0 };
+        for (const auto& [str, label] : LABELLED_STRINGS)
+            {
+            for (const auto& reg : fastRegexes)
+                {
+                if (reg.matches(str))
+                    {
+                    ++matchCount;
+                    break;
+                    }
+                }
+            }
+        return matchCount;
+        };
+    BENCHMARK("Match built-in patterns as a set")
+        {
+        size_t matchCount{ 0 };
+        for (const auto& [str, label] : LABELLED_STRINGS)
+            {
+            matchCount += regexSet.find_match(str).has_value() ? 1 : 0;
+            }
+        return matchCount;
+        };
+
+    cpp_i18n_review cpp(false);
+    BENCHMARK("Classify strings")
+        {
+        size_t untranslatableCount{ 0 };
+        for (const auto& [str, label] : LABELLED_STRINGS)
+            {
+            untranslatableCount += cpp.is_untranslatable_string(str, false).first ? 1 : 0;
+            }
+        return untranslatableCount;
+        };
+    }
+// NOLINTEND
+// clang-format on
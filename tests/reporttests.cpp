@@ -0,0 +1,74 @@
+#include "../src/report_writer.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <sstream>
+#include <string>
+
+// NOLINTBEGIN
+using namespace i18n_check;
+using namespace Catch::Matchers;
+
+// clang-format off
+TEST_CASE("Report Writer", "[report]")
+    {
+    // rows end with the platform's newline
+#ifdef _WIN32
+    const std::string newLine{ "\r\n" };
+#else
+    const std::string newLine{ "\n" };
+#endif
+
+    SECTION("CSV Row")
+        {
+        CHECK(report_writer::to_csv_row(L"File\tLine\tColumn\tValue\tExplanation\tWarning ID") ==
+              L"File,Line,Column,Value,Explanation,Warning ID");
+        // the path's escaped backslashes are unescaped, quotes are doubled,
+        // and the tab in the explanation stays in the explanation
+        CHECK(report_writer::to_csv_row(
+                  LR"("C:\\src\\a.cpp")"
+                  L"\t12\t5\t"
+                  LR"("Say "hi", friend")"
+                  L"\t\"Explanation\twith tab\"\t[suspectL10NString]") ==
+              LR"("C:\src\a.cpp",12,5,"Say ""hi"", friend",)"
+              L"\"Explanation\twith tab\",[suspectL10NString]");
+        CHECK(report_writer::to_csv_row(L"\"a.cpp\"\t\t\t\"\"\t\"Empty value.\"\t[nonUTF8File]") ==
+              L"\"a.cpp\",,,\"\",\"Empty value.\",[nonUTF8File]");
+        // not a full row, but still quoted where needed
+        CHECK(report_writer::to_csv_row(L"a\tb,c") == L"a,\"b,c\"");
+        }
+
+    SECTION("Streaming")
+        {
+        std::ostringstream output;
+            {
+            report_writer writer{ output, report_format::tab_delimited };
+            std::wostream report{ &writer };
+            report << L"\"a.cpp\"\t1\t\t\"caf\u00E9\"";
+            // nothing is written until the row is finished
+            report.flush();
+            CHECK(output.str().empty());
+            report << L"\t\"Explanation.\"\t[suspectL10NString]\n\"b.cpp\"";
+            CHECK(output.str() ==
+                  "\"a.cpp\"\t1\t\t\"caf\xC3\xA9\"\t\"Explanation.\"\t[suspectL10NString]" +
+                      newLine);
+            }
+        // the last row is written when the writer is destroyed
+        CHECK(output.str().ends_with(newLine + "\"b.cpp\""));
+        }
+
+    SECTION("Streaming CSV")
+        {
+        std::ostringstream output;
+            {
+            report_writer writer{ output, report_format::csv };
+            std::wostream report{ &writer };
+            report << L"File\tLine\tColumn\tValue\tExplanation\tWarning ID\n";
+            report << L"\"a.cpp\"\t" << 3 << L"\t" << 7 << L"\t\"x, y\"\t\"Why.\"\t[id]\n";
+            }
+        CHECK(output.str() == "File,Line,Column,Value,Explanation,Warning ID" + newLine +
+                                  "\"a.cpp\",3,7,\"x, y\",\"Why.\",[id]" + newLine);
+        }
+    }
+
+// NOLINTEND
+// clang-format on
@@ -0,0 +1,126 @@
+#include "../src/structural_index.h"
+#include "../src/token_stream.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace i18n_check;
+using namespace Catch::Matchers;
+
+// clang-format off
+TEST_CASE("Token Stream", "[scanner]")
+    {
+    using token_type = token_stream::token_type;
+    const auto getTypesAndText = [](const token_stream& tokens)
+    {
+        std::vector<std::pair<token_type, std::wstring>> results;
+        for (const auto& token : tokens)
+            {
+            results.emplace_back(token.m_type, std::wstring{ tokens.get_text(token) });
+            }
+        return results;
+    };
+
+    SECTION("Code")
+        {
+        const token_stream tokens{ L"auto val = GetValue(1'000UL, 1e-5, .5f);" };
+        const std::vector<std::pair<token_type, std::wstring>> expected{
+            { token_type::identifier, L"auto" },   { token_type::identifier, L"val" },
+            { token_type::punctuation, L"=" },     { token_type::identifier, L"GetValue" },
+            { token_type::punctuation, L"(" },     { token_type::number, L"1'000UL" },
+            { token_type::punctuation, L"," },     { token_type::number, L"1e-5" },
+            { token_type::punctuation, L"," },     { token_type::number, L".5f" },
+            { token_type::punctuation, L")" },     { token_type::punctuation, L";" }
+        };
+        CHECK(getTypesAndText(tokens) == expected);
+        CHECK(tokens.get_tokens()[3].m_position == 11);
+        CHECK(tokens.get_tokens()[3].m_length == 8);
+        }
+
+    SECTION("Literals")
+        {
+        const token_stream tokens{
+            LR"src(L"a \"quote\"" u8'x' '\'' R"delim(a )" b)delim" Lx"text" "unterminated
+next)src"
+        };
+        const std::vector<std::pair<token_type, std::wstring>> expected{
+            { token_type::string_literal, LR"(L"a \"quote\"")" },
+            { token_type::char_literal, L"u8'x'" },
+            { token_type::char_literal, LR"('\'')" },
+            { token_type::string_literal, LR"src(R"delim(a )" b)delim")src" },
+            { token_type::identifier, L"Lx" },
+            { token_type::string_literal, L"\"text\"" },
+            { token_type::string_literal, L"\"unterminated" },
+            { token_type::identifier, L"next" }
+        };
+        CHECK(getTypesAndText(tokens) == expected);
+        }
+
+    SECTION("Comments And Preprocessor")
+        {
+        const token_stream tokens{ L"#define ID_OK 5 // the ID\n  # include <a>\nx /* y */ #z" };
+        const std::vector<std::pair<token_type, std::wstring>> expected{
+            { token_type::preprocessor, L"#define" },  { token_type::identifier, L"ID_OK" },
+            { token_type::number, L"5" },              { token_type::comment, L"// the ID" },
+            { token_type::preprocessor, L"# include" }, { token_type::punctuation, L"<" },
+            { token_type::identifier, L"a" },          { token_type::punctuation, L">" },
+            { token_type::identifier, L"x" },          { token_type::comment, L"/* y */" },
+            { token_type::punctuation, L"#" },         { token_type::identifier, L"z" }
+        };
+        CHECK(getTypesAndText(tokens) == expected);
+        }
+
+    SECTION("Empty")
+        {
+        const token_stream tokens{ L"  \n\t " };
+        CHECK(tokens.get_tokens().empty());
+        }
+    }
+
+TEST_CASE("Structural Index", "[scanner]")
+    {
+    SECTION("Find Next")
+        {
+        // quotes in the first block, the second (full) block, and the partial block at the end
+        std::wstring text(150, L'x');
+        text[3] = L'"';
+        text[70] = L'"';
+        text[71] = L'/';
+        text[149] = L'"';
+        const structural_index index{ text, L"\"/" };
+        CHECK(index.get_count() == 4);
+        CHECK(index.find_next(0) == 3);
+        CHECK(index.find_next(3) == 3);
+        CHECK(index.find_next(4) == 70);
+        CHECK(index.find_next(71) == 71);
+        CHECK(index.find_next(72) == 149);
+        CHECK(index.find_next(150) == 150);
+        CHECK(index.find_next(1'000) == 150);
+        }
+
+    SECTION("Nothing Found")
+        {
+        const std::wstring text(200, L'x');
+        const structural_index index{ text, L"\"" };
+        CHECK(index.get_count() == 0);
+        CHECK(index.find_next(0) == 200);
+        }
+
+    SECTION("Empty")
+        {
+        const structural_index index{ L"", L"\"" };
+        CHECK(index.get_count() == 0);
+        CHECK(index.find_next(0) == 0);
+        }
+
+    SECTION("Too Many Characters")
+        {
+        CHECK_THROWS(structural_index{ L"text", L"abcdefghijklmnopq" });
+        }
+    }
+
+// NOLINTEND
+// clang-format on
@@ -1201,6 +1201,63 @@ TEST_CASE("StrNChr", "[stringutil][StrNChr]")
         }
     };
 
+TEST_CASE("Find In Range", "[stringutil][find_in_range]")
+    {
+    SECTION("Character")
+        {
+        const std::wstring text{ L"hello, world" };
+        const wchar_t* const first = text.c_str();
+        CHECK(string_util::find_in_range(first, first + text.length(), L',') == first + 5);
+        CHECK(string_util::find_in_range(first, first + text.length(), L'd') == first + 11);
+        // the end of the range is not searched
+        CHECK(string_util::find_in_range(first, first + 5, L',') == nullptr);
+        CHECK(string_util::find_in_range(first, first + text.length(), L'z') == nullptr);
+        CHECK(string_util::find_in_range(first, first, L'h') == nullptr);
+        CHECK(string_util::find_in_range<const wchar_t>(nullptr, nullptr, L'h') == nullptr);
+        }
+    SECTION("Embedded Null")
+        {
+        // unlike wcschr, the search goes past nulls to the end of the range
+        const wchar_t text[]{ L'a', L'\0', L'b', L'c' };
+        CHECK(string_util::find_in_range(text, text + 4, L'c') == text + 3);
+        }
+    SECTION("Mutable")
+        {
+        wchar_t text[]{ L"a*/b" };
+        wchar_t* found = string_util::find_in_range(text, text + 4, std::wstring_view{ L"*/" });
+        REQUIRE(found == text + 1);
+        *found = L' ';
+        CHECK(std::wstring{ text } == L"a /b");
+        }
+    SECTION("String")
+        {
+        const std::wstring text{ L"/* a * b */ c */" };
+        const wchar_t* const first = text.c_str();
+        CHECK(string_util::find_in_range(first + 2, first + text.length(),
+                                         std::wstring_view{ L"*/" }) == first + 9);
+        // must be entirely in the range
+        CHECK(string_util::find_in_range(first + 2, first + 10, std::wstring_view{ L"*/" }) ==
+              nullptr);
+        CHECK(string_util::find_in_range(first, first + text.length(),
+                                         std::wstring_view{ L"*//" }) == nullptr);
+        CHECK(string_util::find_in_range(first, first + text.length(), std::wstring_view{}) ==
+              nullptr);
+        }
+    SECTION("First Of")
+        {
+        const std::wstring text{ L"// comment\r\nnext\n" };
+        const wchar_t* const first = text.c_str();
+        CHECK(string_util::find_first_of_in_range(first, first + text.length(),
+                                                  std::wstring_view{ L"\n\r" }) == first + 10);
+        CHECK(string_util::find_first_of_in_range(first + 12, first + text.length(),
+                                                  std::wstring_view{ L"\n\r" }) == first + 16);
+        CHECK(string_util::find_first_of_in_range(first, first + 10,
+                                                  std::wstring_view{ L"\n\r" }) == nullptr);
+        CHECK(string_util::find_first_of_in_range(first, first + text.length(),
+                                                  std::wstring_view{}) == nullptr);
+        }
+    }
+
 TEST_CASE("StrtodEx", "[stringutil][StrtodEx]")
     {
     SECTION("Null")
@@ -0,0 +1,138 @@
+#include "../src/text_decode.h"
+#include "../src/utfcpp/source/utf8.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+// NOLINTBEGIN
+// clang-format off
+
+// Mostly-ASCII C++ source code, roughly 1 MB.
+static std::string make_source_code()
+    {
+    const std::string block{
+        "// Opens the file and reads its content.\n"
+        "bool MainFrame::OnOpen(wxCommandEvent& event)\n"
+        "    {\n"
+        "    wxFileDialog dialog(this, _(\"Open Project\"), wxString{}, wxString{},\n"
+        "                        _(\"Project files (*.xml)|*.xml\"), wxFD_OPEN);\n"
+        "    if (dialog.ShowModal() != wxID_OK)\n"
+        "        {\n"
+        "        wxLogWarning(L\"Could not open \\u201C%s\\u201D.\", dialog.GetPath());\n"
+        "        return false;\n"
+        "        }\n"
+        "    return LoadProject(dialog.GetPath()); // \xC2\xA9 2025\n"
+        "    }\n\n" };
+    std::string text;
+    while (text.length() < 1024 * 1024)
+        {
+        text += block;
+        }
+    return text;
+    }
+
+// A Simplified Chinese PO file, roughly 1 MB.
+static std::string make_cjk_po_file()
+    {
+    const std::string block{
+        "#: ../src/gui/i18nframe.cpp:1602\n"
+        "msgid \"Reviewing files for l10n/i18n issues...\"\n"
+        "msgstr \"\xE6\xAD\xA3\xE5\x9C\xA8\xE6\xA3\x80\xE6\x9F\xA5\xE6\x96\x87\xE4\xBB\xB6"
+        "\xE4\xB8\xAD\xE7\x9A\x84\xE6\x9C\xAC\xE5\x9C\xB0\xE5\x8C\x96\xE9\x97\xAE\xE9\xA2\x98"
+        "\xE2\x80\xA6\xE2\x80\xA6\"\n\n"
+        "#: ../src/gui/i18nframe.cpp:1610\n"
+        "msgid \"Analyzing Files\"\n"
+        "msgstr \"\xE6\xAD\xA3\xE5\x9C\xA8\xE5\x88\x86\xE6\x9E\x90\xE6\x96\x87\xE4\xBB\xB6"
+        "\xEF\xBC\x8C\xE8\xAF\xB7\xE7\xA8\x8D\xE5\x80\x99\xE3\x80\x82\"\n\n" };
+    std::string text;
+    while (text.length() < 1024 * 1024)
+        {
+        text += block;
+        }
+    return text;
+    }
+
+// The previous approach: validate, then convert through a std::u16string.
+static std::wstring utfcpp_decode(const std::string& text)
+    {
+    std::wstring buffer;
+    if (!utf8::is_valid(text.cbegin(), text.cend()))
+        {
+        return buffer;
+        }
+    const std::u16string utf16Text = utf8::utf8to16(text);
+    buffer.reserve(utf16Text.length());
+    for (const auto& ch : utf16Text)
+        {
+        buffer += static_cast<wchar_t>(ch);
+        }
+    return buffer;
+    }
+
+static std::string utfcpp_encode(const std::wstring& text)
+    {
+    std::string buffer;
+    if constexpr (sizeof(wchar_t) == sizeof(uint16_t))
+        {
+        utf8::utf16to8(text.cbegin(), text.cend(), std::back_inserter(buffer));
+        }
+    else
+        {
+        utf8::utf32to8(text.cbegin(), text.cend(), std::back_inserter(buffer));
+        }
+    return buffer;
+    }
+
+// Hidden from the default run; run the test runner with "[benchmark]" to include these.
+TEST_CASE("UTF-8 benchmarks", "[.][benchmark][decode]")
+    {
+    const std::string sourceCode{ make_source_code() };
+    const std::string poFile{ make_cjk_po_file() };
+
+    std::wstring decodedSourceCode;
+    REQUIRE(i18n_check::decode_utf8(sourceCode, decodedSourceCode));
+    std::wstring decodedPoFile;
+    REQUIRE(i18n_check::decode_utf8(poFile, decodedPoFile));
+    // the results should be the same, other than characters outside of the BMP
+    // (which there are none of here)
+    REQUIRE(decodedSourceCode == utfcpp_decode(sourceCode));
+    REQUIRE(decodedPoFile == utfcpp_decode(poFile));
+
+    BENCHMARK("Decode source code (utfcpp)")
+        {
+        return utfcpp_decode(sourceCode);
+        };
+    BENCHMARK("Decode source code")
+        {
+        std::wstring text;
+        return i18n_check::decode_utf8(sourceCode, text);
+        };
+    BENCHMARK("Decode CJK PO file (utfcpp)")
+        {
+        return utfcpp_decode(poFile);
+        };
+    BENCHMARK("Decode CJK PO file")
+        {
+        std::wstring text;
+        return i18n_check::decode_utf8(poFile, text);
+        };
+
+    BENCHMARK("Encode source code (utfcpp)")
+        {
+        return utfcpp_encode(decodedSourceCode);
+        };
+    BENCHMARK("Encode source code")
+        {
+        return i18n_check::encode_utf8(decodedSourceCode);
+        };
+    BENCHMARK("Encode CJK PO file (utfcpp)")
+        {
+        return utfcpp_encode(decodedPoFile);
+        };
+    BENCHMARK("Encode CJK PO file")
+        {
+        return i18n_check::encode_utf8(decodedPoFile);
+        };
+    }
+// NOLINTEND
+// clang-format on